@@ -0,0 +1,163 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/DecomposedGeometry.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/GeometrySet.h>
+
+#include <utility>
+
+namespace SFCGAL {
+
+namespace {
+void assertValidity( const Geometry& g, detail::dim_t<2> )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+}
+
+void assertValidity( const Geometry& g, detail::dim_t<3> )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( g );
+}
+}
+
+///
+///
+///
+template <int Dim>
+DecomposedGeometry<Dim>::DecomposedGeometry():
+    _geometrySet( new detail::GeometrySet<Dim>() )
+{
+}
+
+///
+///
+///
+template <int Dim>
+DecomposedGeometry<Dim>::DecomposedGeometry( const Geometry& g )
+{
+    assertValidity( g, detail::dim_t<Dim>() );
+    _geometrySet.reset( new detail::GeometrySet<Dim>( g ) );
+}
+
+///
+///
+///
+template <int Dim>
+DecomposedGeometry<Dim>::DecomposedGeometry( const Geometry& g, algorithm::NoValidityCheck ):
+    _geometrySet( new detail::GeometrySet<Dim>( g ) )
+{
+}
+
+///
+///
+///
+template <int Dim>
+DecomposedGeometry<Dim>::DecomposedGeometry( detail::GeometrySet<Dim>&& geometrySet ):
+    _geometrySet( new detail::GeometrySet<Dim>( std::move( geometrySet ) ) )
+{
+    // results are read only, they may be shared between threads
+    _geometrySet->flush();
+}
+
+///
+///
+///
+template <int Dim>
+DecomposedGeometry<Dim>::DecomposedGeometry( const DecomposedGeometry& other ):
+    _geometrySet( new detail::GeometrySet<Dim>( *other._geometrySet ) )
+{
+}
+
+///
+///
+///
+template <int Dim>
+DecomposedGeometry<Dim>::DecomposedGeometry( DecomposedGeometry&& other ):
+    _geometrySet( std::move( other._geometrySet ) )
+{
+    // the moved from object stays usable
+    other._geometrySet.reset( new detail::GeometrySet<Dim>() );
+}
+
+///
+///
+///
+template <int Dim>
+DecomposedGeometry<Dim>& DecomposedGeometry<Dim>::operator=( const DecomposedGeometry& other )
+{
+    if ( this != &other ) {
+        _geometrySet.reset( new detail::GeometrySet<Dim>( *other._geometrySet ) );
+    }
+
+    return *this;
+}
+
+///
+///
+///
+template <int Dim>
+DecomposedGeometry<Dim>& DecomposedGeometry<Dim>::operator=( DecomposedGeometry&& other )
+{
+    std::swap( _geometrySet, other._geometrySet );
+    return *this;
+}
+
+///
+///
+///
+template <int Dim>
+DecomposedGeometry<Dim>::~DecomposedGeometry()
+{
+}
+
+///
+///
+///
+template <int Dim>
+bool DecomposedGeometry<Dim>::isEmpty() const
+{
+    return _geometrySet->dimension() < 0;
+}
+
+///
+///
+///
+template <int Dim>
+int DecomposedGeometry<Dim>::dimension() const
+{
+    return _geometrySet->dimension();
+}
+
+///
+///
+///
+template <int Dim>
+std::unique_ptr< Geometry > DecomposedGeometry<Dim>::recompose() const
+{
+    return _geometrySet->recompose();
+}
+
+template class DecomposedGeometry<2>;
+template class DecomposedGeometry<3>;
+
+}//namespace SFCGAL
@@ -0,0 +1,117 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DECOMPOSED_GEOMETRY_H_
+#define _SFCGAL_DECOMPOSED_GEOMETRY_H_
+
+#include <SFCGAL/config.h>
+
+#include <memory>
+
+namespace SFCGAL {
+
+class Geometry;
+namespace detail {
+template <int Dim> class GeometrySet;
+}
+namespace algorithm {
+struct NoValidityCheck;
+}
+
+/**
+ * A Geometry decomposed in points, segments, surfaces and volumes (detail::GeometrySet).
+ *
+ * The boolean operations and predicates taking DecomposedGeometry operands
+ * (algorithm::intersection, algorithm::union_, algorithm::difference, algorithm::intersects
+ * and algorithm::covers) work on the decompositions and return a decomposition, so that
+ * operations can be chained without building a Geometry for every intermediate result :
+ *
+ * \code
+ * DecomposedGeometry<2> a( ga ), b( gb ), c( gc );
+ * std::unique_ptr< Geometry > result = algorithm::intersection( algorithm::union_( a, b ), c ).recompose();
+ * \endcode
+ *
+ * Dim is 2 for the 2D operations (z ignored) and 3 for the 3D ones.
+ */
+template <int Dim>
+class SFCGAL_API DecomposedGeometry {
+public:
+    /**
+     * Empty decomposition
+     */
+    DecomposedGeometry();
+
+    /**
+     * Decomposes a Geometry
+     * @pre g is a valid geometry
+     */
+    explicit DecomposedGeometry( const Geometry& g );
+
+    /**
+     * Decomposes a Geometry. No validity check variant
+     * @pre g is a valid geometry
+     * @warning No actual validity check is done.
+     */
+    DecomposedGeometry( const Geometry& g, algorithm::NoValidityCheck );
+
+    /**
+     * Takes a decomposition
+     */
+    explicit DecomposedGeometry( detail::GeometrySet<Dim>&& geometrySet );
+
+    DecomposedGeometry( const DecomposedGeometry& other );
+    DecomposedGeometry( DecomposedGeometry&& other );
+    DecomposedGeometry& operator=( const DecomposedGeometry& other );
+    DecomposedGeometry& operator=( DecomposedGeometry&& other );
+
+    ~DecomposedGeometry();
+
+    /**
+     * Tests if the decomposition has no primitive
+     */
+    bool isEmpty() const;
+
+    /**
+     * Dimension of the largest primitive, -1 if empty
+     */
+    int dimension() const;
+
+    /**
+     * Builds the Geometry
+     */
+    std::unique_ptr< Geometry > recompose() const;
+
+    /**
+     * Decomposition accessors
+     */
+    const detail::GeometrySet<Dim>& geometrySet() const {
+        return *_geometrySet;
+    }
+    detail::GeometrySet<Dim>& geometrySet() {
+        return *_geometrySet;
+    }
+
+private:
+    std::unique_ptr< detail::GeometrySet<Dim> > _geometrySet;
+};
+
+}//namespace SFCGAL
+
+#endif
@@ -21,6 +21,7 @@
 #include <SFCGAL/Geometry.h>
 
 #include <SFCGAL/Point.h>
+#include <SFCGAL/GeometryArena.h>
 #include <SFCGAL/GeometryVisitor.h>
 #include <SFCGAL/detail/io/WktWriter.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
@@ -37,6 +38,50 @@
 
 namespace SFCGAL {
 
+///
+///
+///
+void* Geometry::operator new( size_t size )
+{
+    GeometryArena* arena = GeometryArenaScope::current();
+    return arena ? arena->allocate( size ) : ::operator new( size ) ;
+}
+
+///
+///
+///
+void Geometry::operator delete( void* p )
+{
+    if ( p == NULL ) {
+        return ;
+    }
+
+    GeometryArena* arena = GeometryArena::owner( p );
+
+    if ( arena ) {
+        arena->deallocate( p );
+    }
+    else {
+        ::operator delete( p );
+    }
+}
+
+///
+///
+///
+void* Geometry::operator new[]( size_t size )
+{
+    return Geometry::operator new( size );
+}
+
+///
+///
+///
+void Geometry::operator delete[]( void* p )
+{
+    Geometry::operator delete( p );
+}
+
 ///
 ///
 ///
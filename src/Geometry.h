@@ -137,6 +137,41 @@ public:
      */
     virtual ~Geometry() = default;
 
+    /**
+     * @brief Allocates geometries in the arena of the current GeometryArenaScope if any,
+     * on the heap otherwise
+     * @ingroup detail
+     */
+    static void* operator new( size_t size );
+    /**
+     * @brief Gives the memory back to the heap or notifies the arena
+     * @ingroup detail
+     */
+    static void  operator delete( void* p );
+    /**
+     * @brief Array form of operator new, same placement rules
+     * @ingroup detail
+     */
+    static void* operator new[]( size_t size );
+    /**
+     * @brief Array form of operator delete
+     * @ingroup detail
+     */
+    static void  operator delete[]( void* p );
+    /**
+     * @brief placement new (hidden by the class specific operator new otherwise)
+     * @ingroup detail
+     */
+    static void* operator new( size_t, void* p ) {
+        return p;
+    }
+    /**
+     * @brief placement delete
+     * @ingroup detail
+     */
+    static void  operator delete( void*, void* ) {
+    }
+
     /**
      * @brief Get a deep copy of the geometry
      */
@@ -0,0 +1,244 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/GeometryArena.h>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <new>
+
+namespace SFCGAL {
+
+namespace {
+const size_t ARENA_ALIGNMENT = alignof( std::max_align_t ) ;
+
+thread_local GeometryArena* currentArena = NULL ;
+
+///
+/// Blocks of all the arenas sorted by address, so that the arena of a geometry can be
+/// found by the thread that deletes it
+///
+struct BlockRegistry {
+    typedef std::map< const char*, std::pair< size_t, GeometryArena* > > Blocks ;
+
+    std::mutex mutex ;
+    Blocks blocks ;
+    // read without the lock to skip the search when no arena holds memory
+    std::atomic< size_t > size ;
+
+    BlockRegistry(): size( 0 ) {}
+};
+
+BlockRegistry& blockRegistry()
+{
+    // never destroyed, arenas may outlive the static objects of this file
+    static BlockRegistry* registry = new BlockRegistry ;
+    return *registry ;
+}
+
+size_t alignedSize( size_t size )
+{
+    return ( size + ARENA_ALIGNMENT - 1 ) & ~( ARENA_ALIGNMENT - 1 ) ;
+}
+}
+
+///
+///
+///
+GeometryArena::GeometryArena( size_t blockSize ):
+    _blockSize( alignedSize( std::max( blockSize, ARENA_ALIGNMENT ) ) ),
+    _current( NULL ),
+    _remaining( 0 ),
+    _numLiveObjects( 0 )
+{
+}
+
+///
+///
+///
+GeometryArena::~GeometryArena()
+{
+    release();
+}
+
+///
+///
+///
+void* GeometryArena::allocate( size_t size )
+{
+    size = alignedSize( std::max( size, size_t( 1 ) ) );
+
+    if ( size > _remaining ) {
+        // large objects get their own block, the current block is kept for the next ones
+        const size_t blockSize = std::max( size, _blockSize );
+        char* block = static_cast< char* >( ::operator new( blockSize ) );
+
+        try {
+            _blocks.push_back( std::make_pair( block, blockSize ) );
+
+            BlockRegistry& registry = blockRegistry();
+            std::lock_guard< std::mutex > lock( registry.mutex );
+            registry.blocks.insert( std::make_pair( block, std::make_pair( blockSize, this ) ) );
+            registry.size = registry.blocks.size();
+        }
+        catch ( ... ) {
+            if ( ! _blocks.empty() && _blocks.back().first == block ) {
+                _blocks.pop_back();
+            }
+
+            ::operator delete( block );
+            throw ;
+        }
+
+        if ( blockSize > _blockSize ) {
+            ++_numLiveObjects ;
+            return block ;
+        }
+
+        _current   = block ;
+        _remaining = blockSize ;
+    }
+
+    void* result = _current ;
+    _current   += size ;
+    _remaining -= size ;
+    ++_numLiveObjects ;
+    return result ;
+}
+
+///
+///
+///
+void GeometryArena::deallocate( void* )
+{
+    BOOST_ASSERT( _numLiveObjects > 0 );
+    --_numLiveObjects ;
+}
+
+///
+///
+///
+void GeometryArena::release()
+{
+    BOOST_ASSERT( _numLiveObjects == 0 );
+
+    if ( ! _blocks.empty() ) {
+        BlockRegistry& registry = blockRegistry();
+        std::lock_guard< std::mutex > lock( registry.mutex );
+
+        for ( size_t i = 0; i < _blocks.size(); i++ ) {
+            registry.blocks.erase( _blocks[i].first );
+        }
+
+        registry.size = registry.blocks.size();
+    }
+
+    for ( size_t i = 0; i < _blocks.size(); i++ ) {
+        ::operator delete( _blocks[i].first );
+    }
+
+    _blocks.clear();
+    _current   = NULL ;
+    _remaining = 0 ;
+}
+
+///
+///
+///
+size_t GeometryArena::capacity() const
+{
+    size_t result = 0 ;
+
+    for ( size_t i = 0; i < _blocks.size(); i++ ) {
+        result += _blocks[i].second ;
+    }
+
+    return result ;
+}
+
+///
+///
+///
+bool GeometryArena::owns( const void* p ) const
+{
+    return owner( p ) == this ;
+}
+
+///
+///
+///
+GeometryArena* GeometryArena::owner( const void* p )
+{
+    BlockRegistry& registry = blockRegistry();
+
+    if ( registry.size == 0 ) {
+        return NULL ;
+    }
+
+    const char* address = static_cast< const char* >( p );
+
+    std::lock_guard< std::mutex > lock( registry.mutex );
+
+    // the last block starting at or before p
+    BlockRegistry::Blocks::const_iterator it = registry.blocks.upper_bound( address );
+
+    if ( it == registry.blocks.begin() ) {
+        return NULL ;
+    }
+
+    --it ;
+
+    if ( std::less< const char* >()( address, it->first + it->second.first ) ) {
+        return it->second.second ;
+    }
+
+    return NULL ;
+}
+
+///
+///
+///
+GeometryArenaScope::GeometryArenaScope( GeometryArena& arena ):
+    _previous( currentArena )
+{
+    currentArena = &arena ;
+}
+
+///
+///
+///
+GeometryArenaScope::~GeometryArenaScope()
+{
+    currentArena = _previous ;
+}
+
+///
+///
+///
+GeometryArena* GeometryArenaScope::current()
+{
+    return currentArena ;
+}
+
+} // namespace SFCGAL
@@ -0,0 +1,155 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_GEOMETRY_ARENA_H_
+#define _SFCGAL_GEOMETRY_ARENA_H_
+
+#include <SFCGAL/config.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace SFCGAL {
+
+/**
+ * A GeometryArena is a monotonic buffer that owns the memory of geometry trees.
+ *
+ * While a GeometryArenaScope is alive on the current thread, every Geometry allocated
+ * with new (WKT parsing, clone(), GeometrySet::recompose(), algorithm outputs, ...)
+ * is placed in the arena. Deleting such a geometry runs its destructor (numbers of the
+ * exact kernel are reference counted) but gives no memory back : memory is released in
+ * one shot by release() or by the destructor of the arena.
+ *
+ * @warning the arena must outlive the geometries it holds
+ * @warning allocations in an arena are not thread-safe : an arena must be the target of a
+ * GeometryArenaScope on one thread at a time. Geometries of an arena can be deleted on
+ * any thread.
+ *
+ * Geometries carry no arena header : deleting a geometry looks up its address in a global
+ * registry of the arena blocks, protected by a mutex. Processes where no arena is alive
+ * only pay an atomic read.
+ * @warning coordinates are still allocated by the numeric types of the kernel and containers
+ * (LineString points, Polygon rings, ...) keep using the default allocator
+ *
+ * @ingroup public_api
+ */
+class SFCGAL_API GeometryArena : private boost::noncopyable {
+public:
+    /**
+     * @param blockSize size of the memory blocks requested from the system
+     */
+    explicit GeometryArena( size_t blockSize = 64 * 1024 );
+
+    /**
+     * Releases the memory
+     * @pre no geometry allocated in the arena is still alive
+     */
+    ~GeometryArena();
+
+    /**
+     * Allocates size bytes aligned for any scalar type
+     */
+    void* allocate( size_t size );
+
+    /**
+     * Notifies that an object allocated in the arena was destroyed (the memory is not reused)
+     */
+    void deallocate( void* p );
+
+    /**
+     * Releases all the blocks in one shot
+     * @pre no geometry allocated in the arena is still alive
+     */
+    void release();
+
+    /**
+     * Returns the number of objects allocated in the arena and not deallocated
+     */
+    inline size_t numLiveObjects() const {
+        return _numLiveObjects.load() ;
+    }
+
+    /**
+     * Returns the number of bytes requested from the system
+     */
+    size_t capacity() const ;
+
+    /**
+     * Tests if p points in a block of the arena
+     */
+    bool owns( const void* p ) const ;
+
+    /**
+     * Returns the arena that owns p (NULL if p was allocated on the heap)
+     *
+     * Geometries carry no reference to their arena, the ownership is found from the
+     * address ranges of the blocks of all the arenas, on any thread.
+     */
+    static GeometryArena* owner( const void* p );
+
+private:
+    size_t _blockSize ;
+    /**
+     * start of the blocks with their size, also registered in the global registry
+     */
+    std::vector< std::pair< char*, size_t > > _blocks ;
+    char* _current ;
+    size_t _remaining ;
+    // decremented by the thread that deletes the geometry
+    std::atomic< size_t > _numLiveObjects ;
+};
+
+/**
+ * RAII helper that makes an arena the target of geometry allocations on the current
+ * thread. Scopes can be nested, the previous arena is restored on destruction.
+ *
+ * @code
+ * GeometryArena arena ;
+ * {
+ *     GeometryArenaScope scope( arena );
+ *     std::unique_ptr< Geometry > g( io::readWkt( wkt ) );
+ *     ...
+ * }
+ * arena.release();
+ * @endcode
+ *
+ * @ingroup public_api
+ */
+class SFCGAL_API GeometryArenaScope : private boost::noncopyable {
+public:
+    explicit GeometryArenaScope( GeometryArena& arena );
+    ~GeometryArenaScope();
+
+    /**
+     * Returns the arena used by the current thread (NULL if none)
+     */
+    static GeometryArena* current();
+
+private:
+    GeometryArena* _previous ;
+};
+
+} // namespace SFCGAL
+
+#endif
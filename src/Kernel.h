@@ -22,6 +22,7 @@
 #define _SFCGAL_KERNEL_H_
 
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 
 namespace SFCGAL {
 
@@ -30,6 +31,12 @@ namespace SFCGAL {
  */
 typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel ;
 
+/**
+ * double precision Kernel (exact predicates, inexact constructions)
+ * @see algorithm::FastMode
+ */
+typedef CGAL::Exact_predicates_inexact_constructions_kernel InexactKernel ;
+
 
 /**
  * Quotient type
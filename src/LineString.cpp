@@ -38,11 +38,9 @@ LineString::LineString():
 ///
 LineString::LineString( const std::vector< Point >& points ):
     Geometry(),
-    _points()
+    _points( points )
 {
-    for ( size_t i = 0; i < points.size(); i++ ) {
-        _points.push_back( points[i].clone() ) ;
-    }
+
 }
 
 ///
@@ -52,19 +50,19 @@ LineString::LineString( const Point& startPoint, const Point& endPoint ):
     Geometry(),
     _points()
 {
-    _points.push_back( startPoint.clone() );
-    _points.push_back( endPoint.clone() );
+    _points.reserve( 2 );
+    _points.push_back( startPoint );
+    _points.push_back( endPoint );
 }
 
 ///
 ///
 ///
 LineString::LineString( const LineString& other ):
-    Geometry()
+    Geometry(),
+    _points( other._points )
 {
-    for ( size_t i = 0; i < other.numPoints(); i++ ) {
-        _points.push_back( other.pointN( i ).clone() ) ;
-    }
+
 }
 
 ///
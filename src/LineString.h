@@ -26,6 +26,9 @@
 #include <boost/assert.hpp>
 #include <boost/ptr_container/ptr_vector.hpp>
 #include <boost/serialization/base_object.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
 #include <boost/ptr_container/serialize_ptr_vector.hpp>
 
 #include <SFCGAL/Point.h>
@@ -36,12 +39,18 @@ namespace SFCGAL {
 
 /**
  * A LineString in SFA
+ *
+ * Points are stored by value in a contiguous buffer (one allocation per LineString
+ * rather than one per vertex).
+ *
+ * @warning as for std::vector, references returned by pointN(), startPoint() and endPoint()
+ * are invalidated by addPoint() and reserve()
  * @ingroup public_api
  */
 class SFCGAL_API LineString : public Geometry {
 public:
-    typedef boost::ptr_vector< Point >::iterator       iterator ;
-    typedef boost::ptr_vector< Point >::const_iterator const_iterator ;
+    typedef std::vector< Point >::iterator       iterator ;
+    typedef std::vector< Point >::const_iterator const_iterator ;
 
     /**
      * Empty LineString constructor
@@ -159,13 +168,16 @@ public:
      * append a Point to the LineString
      */
     inline void            addPoint( const Point& p ) {
-        _points.push_back( p.clone() ) ;
+        _points.push_back( p ) ;
     }
     /**
      * append a Point to the LineString and takes ownership
+     * @note the point is copied into the LineString buffer and p is deleted
      */
     inline void            addPoint( Point* p ) {
-        _points.push_back( p ) ;
+        BOOST_ASSERT( p != NULL );
+        _points.push_back( *p ) ;
+        delete p ;
     }
 
 
@@ -299,12 +311,32 @@ public:
      * Serializer
      */
     template <class Archive>
-    void serialize( Archive& ar, const unsigned int /*version*/ ) {
+    void save( Archive& ar, const unsigned int /*version*/ ) const {
         ar& boost::serialization::base_object<Geometry>( *this );
         ar& _points;
     }
+
+    template <class Archive>
+    void load( Archive& ar, const unsigned int version ) {
+        ar& boost::serialization::base_object<Geometry>( *this );
+
+        if ( version == 0 ) {
+            // archives written before version 1 store a boost::ptr_vector< Point >
+            boost::ptr_vector< Point > points ;
+            ar& points;
+            _points.assign( points.begin(), points.end() );
+        }
+        else {
+            ar& _points;
+        }
+    }
+
+    template <class Archive>
+    void serialize( Archive& ar, const unsigned int version ) {
+        boost::serialization::split_member( ar, *this, version );
+    }
 private:
-    boost::ptr_vector< Point > _points ;
+    std::vector< Point > _points ;
 
     void swap( LineString& other ) {
         std::swap( _points, other._points );
@@ -314,6 +346,6 @@ private:
 
 }
 
-
+BOOST_CLASS_VERSION( SFCGAL::LineString, 1 )
 
 #endif
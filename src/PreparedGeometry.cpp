@@ -21,6 +21,9 @@
 #include <SFCGAL/PreparedGeometry.h>
 
 #include <SFCGAL/detail/io/WktWriter.h>
+#include <SFCGAL/detail/IndexedGeometrySet.h>
+#include <SFCGAL/detail/PrimitiveTree3.h>
+#include <SFCGAL/algorithm/isValid.h>
 
 namespace SFCGAL {
 PreparedGeometry::PreparedGeometry() :
@@ -71,9 +74,42 @@ const Envelope& PreparedGeometry::envelope() const
     return *_envelope;
 }
 
+const detail::IndexedGeometrySet<2>& PreparedGeometry::indexedGeometrySet2D() const
+{
+    if ( ! _indexedGeometrySet2D ) {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( geometry() );
+        _indexedGeometrySet2D.reset( new detail::IndexedGeometrySet<2>( geometry() ) );
+    }
+
+    return *_indexedGeometrySet2D;
+}
+
+const detail::IndexedGeometrySet<3>& PreparedGeometry::indexedGeometrySet3D() const
+{
+    if ( ! _indexedGeometrySet3D ) {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( geometry() );
+        _indexedGeometrySet3D.reset( new detail::IndexedGeometrySet<3>( geometry() ) );
+    }
+
+    return *_indexedGeometrySet3D;
+}
+
+const detail::PrimitiveTree3& PreparedGeometry::primitiveTree3D() const
+{
+    if ( ! _primitiveTree3D ) {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( geometry() );
+        _primitiveTree3D.reset( new detail::PrimitiveTree3( geometry() ) );
+    }
+
+    return *_primitiveTree3D;
+}
+
 void PreparedGeometry::invalidateCache()
 {
     _envelope.reset();
+    _indexedGeometrySet2D.reset();
+    _indexedGeometrySet3D.reset();
+    _primitiveTree3D.reset();
 }
 
 std::string PreparedGeometry::asEWKT( const int& numDecimals ) const
@@ -34,6 +34,10 @@
 namespace SFCGAL {
 
 class Geometry;
+namespace detail {
+template <int Dim> class IndexedGeometrySet;
+class PrimitiveTree3;
+}
 
 typedef uint32_t srid_t;
 
@@ -41,8 +45,17 @@ typedef uint32_t srid_t;
  * A PreparedGeometry is a shell around a SFCGAL::Geometry.
  * It is used to store annex data, like SRID or cached computations
  *
+ * The cached computations (envelope, 2D and 3D decompositions with their box tree) are
+ * lazily built and reused by the prepared variants of the predicates
+ * (algorithm::intersects, algorithm::covers, algorithm::distance, algorithm::dwithin and their 3D versions taking a PreparedGeometry).
+ * invalidateCache() must be called after a modification of the underlying geometry.
+ *
  * It is noncopyable since it stores a std::unique_ptr<SFCGAL::Geometry>
  *
+ * @warning the caches are built on demand by const methods, a PreparedGeometry shared between threads
+ * must be warmed up (indexedGeometrySet2D(), indexedGeometrySet3D(), primitiveTree3D()) before concurrent use.
+ * The boundary caches of the indexed sets, used by distance and dwithin, are then built once and
+ * safely on the first concurrent query.
  */
 class SFCGAL_API PreparedGeometry : public boost::noncopyable {
 public:
@@ -95,6 +108,25 @@ public:
      */
     const Envelope& envelope() const;
 
+    /**
+     * 2D decomposition of the geometry with its box tree (using cache)
+     * @pre the geometry is valid in 2D
+     */
+    const detail::IndexedGeometrySet<2>& indexedGeometrySet2D() const;
+
+    /**
+     * 3D decomposition of the geometry with its box tree (using cache)
+     * @pre the geometry is valid in 3D
+     */
+    const detail::IndexedGeometrySet<3>& indexedGeometrySet3D() const;
+
+    /**
+     * 3D primitives (points, segments and triangles) of the geometry with their box tree,
+     * used by the 3D distance (using cache)
+     * @pre the geometry is valid in 3D
+     */
+    const detail::PrimitiveTree3& primitiveTree3D() const;
+
     /**
      * Resets the cache
      */
@@ -122,6 +154,7 @@ public:
         Geometry* pgeom;
         ar& pgeom;
         _geometry.reset( pgeom );
+        invalidateCache();
     }
 
     template <class Archive>
@@ -138,6 +171,11 @@ protected:
 
     // bbox of the geometry
     mutable boost::optional<Envelope> _envelope;
+
+    // decompositions of the geometry
+    mutable std::unique_ptr< detail::IndexedGeometrySet<2> > _indexedGeometrySet2D;
+    mutable std::unique_ptr< detail::IndexedGeometrySet<3> > _indexedGeometrySet3D;
+    mutable std::unique_ptr< detail::PrimitiveTree3 > _primitiveTree3D;
 };
 
 }
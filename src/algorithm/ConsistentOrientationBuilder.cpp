@@ -19,28 +19,101 @@
  */
 
 #include <SFCGAL/algorithm/ConsistentOrientationBuilder.h>
-#include <SFCGAL/detail/graph/algorithm/orientation.h>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/Exception.h>
+
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
 
 namespace SFCGAL {
 namespace algorithm {
 
+namespace {
+
+const size_t NO_EDGE = std::numeric_limits< size_t >::max();
+
+/*
+ * look for opposite or parallel edges in two triangles
+ */
+void studyOrientation(
+    const boost::array< size_t, 3 >& reference,
+    const boost::array< size_t, 3 >& target,
+    bool& hasOppositeEdge,
+    bool& hasParallelEdge
+)
+{
+    hasOppositeEdge = false ;
+    hasParallelEdge = false ;
+
+    for ( size_t i = 0; i < 3; i++ ) {
+        const size_t a = reference[i] ;
+        const size_t b = reference[( i + 1 ) % 3] ;
+
+        for ( size_t j = 0; j < 3; j++ ) {
+            const size_t c = target[j] ;
+            const size_t d = target[( j + 1 ) % 3] ;
+
+            if ( a == d && b == c ) {
+                hasOppositeEdge = true ;
+            }
+
+            if ( a == c && b == d ) {
+                hasParallelEdge = true ;
+            }
+        }
+    }
+}
+
+}
+
 ///
 ///
 ///
 ConsistentOrientationBuilder::ConsistentOrientationBuilder():
-    _graph(),
-    _graphBuilder( _graph ),
+    _vertices(),
+    _vertexIndex(),
     _triangles()
 {
 
 }
 
+///
+///
+///
+size_t ConsistentOrientationBuilder::_addVertex( const Point& point )
+{
+    BOOST_ASSERT( ! point.isEmpty() );
+
+    const std::pair< detail::CoordinateIndex< Coordinate, size_t >::Type::iterator, bool > inserted =
+        _vertexIndex.insert( std::make_pair( point.coordinate(), _vertices.size() ) );
+
+    if ( inserted.second ) {
+        _vertices.push_back( point.coordinate() );
+    }
+
+    return inserted.first->second ;
+}
+
 ///
 ///
 ///
 void ConsistentOrientationBuilder::addTriangle( const Triangle& triangle )
 {
-    _triangles.push_back( _graphBuilder.addTriangle( triangle, graph::Edge( _triangles.size() ) ) ) ;
+    BOOST_ASSERT( ! triangle.isEmpty() );
+
+    TriangleVertices vertices ;
+
+    for ( size_t i = 0; i < 3; i++ ) {
+        vertices[i] = _addVertex( triangle.vertex( i ) );
+    }
+
+    _triangles.push_back( vertices ) ;
 }
 
 ///
@@ -48,6 +121,9 @@ void ConsistentOrientationBuilder::addTriangle( const Triangle& triangle )
 ///
 void ConsistentOrientationBuilder::addTriangulatedSurface( const TriangulatedSurface& triangulatedSurface )
 {
+    _triangles.reserve( _triangles.size() + triangulatedSurface.numGeometries() );
+    _vertexIndex.reserve( _vertexIndex.size() + triangulatedSurface.numGeometries() );
+
     for ( size_t i = 0; i < triangulatedSurface.numGeometries(); i++ ) {
         addTriangle( triangulatedSurface.geometryN( i ) ) ;
     }
@@ -73,17 +149,23 @@ TriangulatedSurface ConsistentOrientationBuilder::buildTriangulatedSurface()
 ///
 Triangle  ConsistentOrientationBuilder::triangleN( const size_t& n ) const
 {
-    const edge_descriptor& ab = _triangles[n][0] ;
-    const edge_descriptor& bc = _triangles[n][1] ;
-    const edge_descriptor& ca = _triangles[n][2] ;
+    const TriangleVertices& triangle = _triangles[n] ;
 
     return Triangle(
-               Point( _graph[ _graph.source( ab ) ].coordinate ),
-               Point( _graph[ _graph.source( bc ) ].coordinate ),
-               Point( _graph[ _graph.source( ca ) ].coordinate )
+               Point( _vertices[ triangle[0] ] ),
+               Point( _vertices[ triangle[1] ] ),
+               Point( _vertices[ triangle[2] ] )
            );
 }
 
+///
+///
+///
+const std::vector< size_t >& ConsistentOrientationBuilder::neighbors( const size_t& n ) const
+{
+    return _neighbors[n] ;
+}
+
 
 ///
 ///
@@ -95,133 +177,131 @@ void ConsistentOrientationBuilder::_makeOrientationConsistent()
     }
 
     /*
-     * mark all triangles as not oriented and not visited
+     * mark all triangles as not oriented
      */
-    _visited.resize( numTriangles() ) ;
-    _oriented.resize( numTriangles() ) ;
-
-    for ( size_t i = 0; i < numTriangles(); i++ ) {
-        _visited[i]  = false ;
-        _oriented[i] = false ;
-    }
+    _oriented.assign( numTriangles(), false ) ;
 
     _computeNeighbors();
 
-    // mark first one as oriented (reference)
-    int currentTriangle = -1 ;
-
-    while ( ( currentTriangle = _findNextTriangle() ) != -1 ) {
-        //mark triangle as visited
-        _visited[ currentTriangle ] = true ;
-
-        //orient neighbors
-        const std::set< size_t >& neighbors = _neighbors[ currentTriangle ] ;
-
-        for ( std::set< size_t >::const_iterator it = neighbors.begin(); it != neighbors.end(); ++it ) {
-            bool hasOppositeEdge, hasParallelEdge ;
-            graph::algorithm::studyOrientation(
-                _graph,
-                _triangles[ currentTriangle ],
-                _triangles[ ( *it ) ],
-                hasOppositeEdge,
-                hasParallelEdge
-            );
-
-            // orientation is consistent
-            if ( ! hasParallelEdge ) {
-                _oriented[ *it ] = true ;
-                continue ;
-            }
-
-            // orientation can't be consistent
-            if ( hasOppositeEdge && hasParallelEdge ) {
-                BOOST_THROW_EXCEPTION( Exception(
-                                           "can't build consistent orientation from triangle set"
-                                       ) );
-            }
-
-            // orientation has already been fixed (moebius)
-            if ( hasParallelEdge && _oriented[ *it ] ) {
-                BOOST_THROW_EXCEPTION( Exception(
-                                           "can't build consistent orientation from triangle set, inconsistent orientation for triangle"
-                                       ) );
-            }
+    /*
+     * breadth first traversal of each connected part, from its first triangle (reference)
+     */
+    std::vector< size_t > queue ;
+    queue.reserve( numTriangles() );
 
-            //here, neighbor triangle should be reversed
-            _graph.reverse( _triangles[ ( *it ) ] );
-            _oriented[ *it ] = true ;
+    for ( size_t reference = 0; reference < numTriangles(); reference++ ) {
+        if ( _oriented[ reference ] ) {
+            continue ;
         }
-    }
-}
 
-///
-///
-///
-void ConsistentOrientationBuilder::_computeNeighbors()
-{
-    _neighbors.clear() ;
-    _neighbors.resize( numTriangles() );
+        _oriented[ reference ] = true ;
+        queue.push_back( reference );
 
-    for ( size_t i = 0; i < _triangles.size(); i++ ) {
-        const std::vector< edge_descriptor >& triangle = _triangles[i] ;
+        for ( size_t head = 0; head < queue.size(); head++ ) {
+            const size_t currentTriangle = queue[ head ] ;
 
-        for ( size_t j = 0; j < triangle.size(); j++ ) {
-            vertex_descriptor source = _graph.source( triangle[j] ) ;
-            vertex_descriptor target = _graph.target( triangle[j] ) ;
+            //orient neighbors
+            const std::vector< size_t >& neighbors = _neighbors[ currentTriangle ] ;
 
-            //get neighbor edges
-            std::vector< directed_edge_descriptor > neighborEdges = _graph.edges( source, target );
+            for ( std::vector< size_t >::const_iterator it = neighbors.begin(); it != neighbors.end(); ++it ) {
+                bool hasOppositeEdge, hasParallelEdge ;
+                studyOrientation(
+                    _triangles[ currentTriangle ],
+                    _triangles[ ( *it ) ],
+                    hasOppositeEdge,
+                    hasParallelEdge
+                );
 
-            //use marker to fill neighborGraph
-            for ( size_t k = 0; k < neighborEdges.size(); k++ ) {
-                size_t idOtherTriangle = ( size_t )_graph[ neighborEdges[k].first ].face;
+                // orientation is consistent
+                if ( ! hasParallelEdge ) {
+                    if ( ! _oriented[ *it ] ) {
+                        _oriented[ *it ] = true ;
+                        queue.push_back( *it );
+                    }
 
-                if ( idOtherTriangle == i ) {
                     continue ;
                 }
 
-                _neighbors[i].insert( idOtherTriangle );
+                // orientation can't be consistent
+                if ( hasOppositeEdge && hasParallelEdge ) {
+                    BOOST_THROW_EXCEPTION( Exception(
+                                               "can't build consistent orientation from triangle set"
+                                           ) );
+                }
+
+                // orientation has already been fixed (moebius)
+                if ( hasParallelEdge && _oriented[ *it ] ) {
+                    BOOST_THROW_EXCEPTION( Exception(
+                                               "can't build consistent orientation from triangle set, inconsistent orientation for triangle"
+                                           ) );
+                }
+
+                //here, neighbor triangle should be reversed
+                std::swap( _triangles[ *it ][1], _triangles[ *it ][2] );
+                _oriented[ *it ] = true ;
+                queue.push_back( *it );
             }
         }
+
+        queue.clear();
     }
 }
 
 ///
 ///
 ///
-int ConsistentOrientationBuilder::_findNextTriangle()
+void ConsistentOrientationBuilder::_computeNeighbors()
 {
-    int result = -1 ;
+    typedef std::pair< size_t, size_t > EdgeKey ;
 
     /*
-     * find an oriented triangle (reached) and not visited
+     * for each undirected edge, the last side (3 * triangle + i) found on it,
+     * the previous ones are chained in nextSide
      */
-    for ( size_t i = 0; i < numTriangles(); i++ ) {
-        if ( ! _oriented[i] || _visited[i] ) {
-            continue ;
-        }
+    std::unordered_map< EdgeKey, size_t, boost::hash< EdgeKey > > lastSide ;
+    lastSide.reserve( 2 * numTriangles() );
+    std::vector< size_t > nextSide( 3 * numTriangles(), NO_EDGE );
 
-        result = i ;
-        break ;
-    }
+    for ( size_t i = 0; i < _triangles.size(); i++ ) {
+        const TriangleVertices& triangle = _triangles[i] ;
+
+        for ( size_t j = 0; j < 3; j++ ) {
+            const size_t source = triangle[j] ;
+            const size_t target = triangle[( j + 1 ) % 3] ;
+            const EdgeKey key( std::min( source, target ), std::max( source, target ) );
+            const size_t side = 3 * i + j ;
+
+            const std::pair< std::unordered_map< EdgeKey, size_t, boost::hash< EdgeKey > >::iterator, bool > inserted =
+                lastSide.insert( std::make_pair( key, side ) );
 
-    //triangle found
-    if ( result != -1 ) {
-        return result ;
+            if ( ! inserted.second ) {
+                nextSide[ side ] = inserted.first->second ;
+                inserted.first->second = side ;
+            }
+        }
     }
 
-    /*
-     * here, a new connected part begins
-     */
-    for ( size_t i = 0; i < numTriangles(); i++ ) {
-        if ( ! _oriented[i] ) {
-            _oriented[i] = true ;
-            return i ;
+    _neighbors.clear() ;
+    _neighbors.resize( numTriangles() );
+
+    for ( std::unordered_map< EdgeKey, size_t, boost::hash< EdgeKey > >::const_iterator it = lastSide.begin();
+            it != lastSide.end(); ++it ) {
+        for ( size_t a = it->second; a != NO_EDGE; a = nextSide[a] ) {
+            for ( size_t b = nextSide[a]; b != NO_EDGE; b = nextSide[b] ) {
+                if ( a / 3 == b / 3 ) {
+                    continue ;
+                }
+
+                _neighbors[ a / 3 ].push_back( b / 3 );
+                _neighbors[ b / 3 ].push_back( a / 3 );
+            }
         }
     }
 
-    BOOST_ASSERT( result == -1 );
-    return result ;
+    for ( size_t i = 0; i < _neighbors.size(); i++ ) {
+        std::sort( _neighbors[i].begin(), _neighbors[i].end() );
+        _neighbors[i].erase( std::unique( _neighbors[i].begin(), _neighbors[i].end() ), _neighbors[i].end() );
+    }
 }
 
 
@@ -229,4 +309,3 @@ int ConsistentOrientationBuilder::_findNextTriangle()
 
 }//algorithm
 }//SFCGAL
-
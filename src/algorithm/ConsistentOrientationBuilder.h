@@ -24,23 +24,28 @@
 #include <SFCGAL/config.h>
 
 #include <SFCGAL/Geometry.h>
+#include <SFCGAL/Coordinate.h>
 
-#include <SFCGAL/detail/graph/GeometryGraph.h>
-#include <SFCGAL/detail/graph/GeometryGraphBuilder.h>
+#include <SFCGAL/detail/CoordinateHash.h>
+
+#include <boost/array.hpp>
+
+#include <vector>
 
 namespace SFCGAL {
 namespace algorithm {
 
 /**
  * Make orientation consistent in a triangle set
+ *
+ * The vertices are welded with a hashed index, the neighbors are found with a hash
+ * on the edges and the orientation is propagated with a breadth first traversal,
+ * which is linear in the number of triangles.
+ *
  * @ingroup detail
  */
 class SFCGAL_API ConsistentOrientationBuilder {
 public:
-    typedef graph::GeometryGraph::vertex_descriptor        vertex_descriptor ;
-    typedef graph::GeometryGraph::edge_descriptor          edge_descriptor ;
-    typedef graph::GeometryGraph::directed_edge_descriptor directed_edge_descriptor ;
-
     /**
      * default constructor
      */
@@ -77,17 +82,23 @@ public:
 
     /**
      * [advanced]use after buildTriangulatedSurface
+     * @return the sorted indexes of the triangles sharing an edge with the n-th triangle
      */
-    const std::set< size_t >& neighbors( const size_t& n ) const ;
+    const std::vector< size_t >& neighbors( const size_t& n ) const ;
 private:
-    graph::GeometryGraph                          _graph ;
-    graph::GeometryGraphBuilder                   _graphBuilder ;
-    std::vector< std::vector< edge_descriptor > > _triangles ;
+    typedef boost::array< size_t, 3 > TriangleVertices ;
 
-    std::vector< bool >                           _visited ;
-    std::vector< bool >                           _oriented ;
-    std::vector< std::set< size_t > >             _neighbors ;
+    std::vector< Coordinate >                                   _vertices ;
+    detail::CoordinateIndex< Coordinate, size_t >::Type         _vertexIndex ;
+    std::vector< TriangleVertices >                             _triangles ;
 
+    std::vector< bool >                                         _oriented ;
+    std::vector< std::vector< size_t > >                        _neighbors ;
+
+    /**
+     * index of a vertex, added if it is not already known
+     */
+    size_t _addVertex( const Point& point ) ;
 
     /**
      * make triangle orientation consistent
@@ -99,11 +110,6 @@ private:
      */
     void _computeNeighbors() ;
 
-    /**
-     * find the next triangle to visit (may select a new reference triangle)
-     */
-    int _findNextTriangle() ;
-
 };
 
 
@@ -31,6 +31,8 @@
 
 #include <SFCGAL/algorithm/plane.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/computationMode.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
 
 #include <CGAL/Point_2.h>
 #include <CGAL/Triangle_2.h>
@@ -95,10 +97,22 @@ double area( const Geometry& g, NoValidityCheck )
 
 double area( const Geometry& g )
 {
+    if ( computationMode() == FAST_COMPUTATION ) {
+        return area( g, FastMode() );
+    }
+
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
     return area( g, NoValidityCheck() );
 }
 
+///
+///
+///
+double area( const Geometry& g, FastMode )
+{
+    return detail::InexactGeometrySet( g ).area();
+}
+
 ///
 ///
 ///
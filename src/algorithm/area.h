@@ -27,6 +27,7 @@
 namespace SFCGAL {
 namespace algorithm {
 struct NoValidityCheck;
+struct FastMode;
 
 /**
  * @brief Compute the 2D area for a Geometry
@@ -47,6 +48,16 @@ SFCGAL_API double     area( const Geometry& g ) ;
  */
 SFCGAL_API double     area( const Geometry& g, NoValidityCheck ) ;
 
+/**
+ * @brief Compute the 2D area for a Geometry in double precision
+ *
+ * @warning Z component is ignored, there is no 2D projection for 3D geometries
+ * @ingroup public_api
+ * @pre g is a valid geometry (not checked, see FastMode)
+ * @see FastMode for the robustness contract
+ */
+SFCGAL_API double     area( const Geometry& g, FastMode ) ;
+
 /**
  * @brief Compute the 2D signed area for a Triangle
  * @ingroup detail
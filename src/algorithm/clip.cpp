@@ -0,0 +1,799 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/algorithm/clip.h>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/MultiPoint.h>
+#include <SFCGAL/MultiLineString.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/numeric.h>
+
+#include <SFCGAL/algorithm/isValid.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <vector>
+
+namespace SFCGAL {
+namespace algorithm {
+
+namespace {
+
+//
+// Vertex in double precision, z and m are NaN when not defined
+struct Vertex {
+    double x, y, z, m;
+};
+
+typedef std::vector< Vertex > Path;
+
+//
+// Clipping rectangle
+struct Box {
+    double xmin, ymin, xmax, ymax;
+
+    bool contains( const Vertex& v ) const {
+        return v.x >= xmin && v.x <= xmax && v.y >= ymin && v.y <= ymax;
+    }
+
+    double width() const {
+        return xmax - xmin;
+    }
+
+    double height() const {
+        return ymax - ymin;
+    }
+};
+
+//
+// Coordinate dimensions of the output
+struct Dimensions {
+    Dimensions( const Geometry& g ): is3D( g.is3D() ), isMeasured( g.isMeasured() ) {}
+
+    bool is3D;
+    bool isMeasured;
+};
+
+Vertex toVertex( const Point& p )
+{
+    Vertex v;
+    v.x = CGAL::to_double( p.x() );
+    v.y = CGAL::to_double( p.y() );
+    v.z = p.is3D() ? CGAL::to_double( p.z() ) : NaN();
+    v.m = p.isMeasured() ? p.m() : NaN();
+    return v;
+}
+
+Path toPath( const LineString& lineString )
+{
+    Path path;
+    path.reserve( lineString.numPoints() );
+
+    for ( size_t i = 0; i < lineString.numPoints(); i++ ) {
+        path.push_back( toVertex( lineString.pointN( i ) ) );
+    }
+
+    return path;
+}
+
+Point toPoint( const Vertex& v, const Dimensions& dims )
+{
+    Point p = dims.is3D ? Point( v.x, v.y, v.z ) : Point( v.x, v.y );
+
+    if ( dims.isMeasured ) {
+        p.setM( v.m );
+    }
+
+    return p;
+}
+
+LineString* toLineString( const Path& path, const Dimensions& dims )
+{
+    LineString* lineString = new LineString();
+    lineString->reserve( path.size() );
+
+    for ( size_t i = 0; i < path.size(); i++ ) {
+        lineString->addPoint( toPoint( path[i], dims ) );
+    }
+
+    return lineString;
+}
+
+bool sameXY( const Vertex& a, const Vertex& b )
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+Vertex interpolate( const Vertex& a, const Vertex& b, double t )
+{
+    Vertex v;
+    v.x = a.x + t * ( b.x - a.x );
+    v.y = a.y + t * ( b.y - a.y );
+    v.z = a.z + t * ( b.z - a.z );
+    v.m = a.m + t * ( b.m - a.m );
+    return v;
+}
+
+//
+// Puts a vertex computed on the k-th edge of the box (xmin, xmax, ymin, ymax) exactly on it
+Vertex snap( Vertex v, const Box& box, int k )
+{
+    switch ( k ) {
+    case 0:
+        v.x = box.xmin;
+        break;
+
+    case 1:
+        v.x = box.xmax;
+        break;
+
+    case 2:
+        v.y = box.ymin;
+        break;
+
+    default:
+        v.y = box.ymax;
+        break;
+    }
+
+    v.x = std::min( std::max( v.x, box.xmin ), box.xmax );
+    v.y = std::min( std::max( v.y, box.ymin ), box.ymax );
+    return v;
+}
+
+//
+// Liang-Barsky clipping of the segment [a,b]. Returns false if the segment is outside the box,
+// clippedA (resp. clippedB) tells if ca (resp. cb) is a new vertex on the boundary.
+bool clipSegment( const Box& box, const Vertex& a, const Vertex& b, Vertex& ca, Vertex& cb, bool& clippedA, bool& clippedB )
+{
+    const double dx = b.x - a.x ;
+    const double dy = b.y - a.y ;
+    const double p[4] = { -dx, dx, -dy, dy };
+    const double q[4] = { a.x - box.xmin, box.xmax - a.x, a.y - box.ymin, box.ymax - a.y };
+
+    double t0 = 0.0, t1 = 1.0 ;
+    int e0 = -1, e1 = -1 ;
+
+    for ( int k = 0; k < 4; k++ ) {
+        if ( p[k] == 0.0 ) {
+            if ( q[k] < 0.0 ) {
+                return false;
+            }
+
+            continue;
+        }
+
+        const double r = q[k] / p[k] ;
+
+        if ( p[k] < 0.0 ) {
+            if ( r > t0 ) {
+                t0 = r ;
+                e0 = k ;
+            }
+        }
+        else if ( r < t1 ) {
+            t1 = r ;
+            e1 = k ;
+        }
+    }
+
+    if ( t0 > t1 ) {
+        return false;
+    }
+
+    clippedA = e0 >= 0 ;
+    clippedB = e1 >= 0 ;
+    ca = clippedA ? snap( interpolate( a, b, t0 ), box, e0 ) : a ;
+    cb = clippedB ? snap( interpolate( a, b, t1 ), box, e1 ) : b ;
+    return true;
+}
+
+//
+// Clips a path segment by segment, consecutive kept segments are merged in pieces.
+// cut is set to false if the path is entirely inside the box. For a closed path, the
+// last piece is joined to the first one when the path is cut elsewhere.
+std::vector< Path > clipPath( const Box& box, const Path& path, bool closed, bool& cut )
+{
+    std::vector< Path > pieces;
+    cut = false;
+
+    bool open = false ;
+    bool startKept = false ;
+    bool endKept = false ;
+
+    for ( size_t i = 0; i + 1 < path.size(); i++ ) {
+        Vertex ca, cb ;
+        bool clippedA = false, clippedB = false ;
+
+        if ( ! clipSegment( box, path[i], path[i + 1], ca, cb, clippedA, clippedB ) ) {
+            cut = true ;
+            open = false ;
+            endKept = false ;
+            continue;
+        }
+
+        if ( i == 0 ) {
+            startKept = ! clippedA ;
+        }
+
+        if ( clippedA || ! open ) {
+            cut = cut || clippedA || i > 0 ;
+            pieces.push_back( Path( 1, ca ) );
+        }
+
+        if ( ! sameXY( cb, pieces.back().back() ) ) {
+            pieces.back().push_back( cb );
+        }
+
+        open = ! clippedB ;
+        endKept = ! clippedB ;
+        cut = cut || clippedB ;
+    }
+
+    if ( closed && cut && startKept && endKept && pieces.size() > 1 ) {
+        Path& last = pieces.back();
+        last.insert( last.end(), pieces.front().begin() + 1, pieces.front().end() );
+        pieces.front().swap( last );
+        pieces.pop_back();
+    }
+
+    // points touching the boundary are dropped
+    std::vector< Path > result;
+
+    for ( size_t i = 0; i < pieces.size(); i++ ) {
+        if ( pieces[i].size() > 1 ) {
+            result.push_back( pieces[i] );
+        }
+    }
+
+    return result;
+}
+
+double signedArea( const Path& ring )
+{
+    double area = 0.0 ;
+
+    for ( size_t i = 0; i + 1 < ring.size(); i++ ) {
+        area += ring[i].x * ring[i + 1].y - ring[i + 1].x * ring[i].y ;
+    }
+
+    return area / 2.0 ;
+}
+
+//
+// Crossing number test, the point is assumed not to be on the ring
+bool insideRing( double x, double y, const Path& ring )
+{
+    bool inside = false ;
+
+    for ( size_t i = 0; i + 1 < ring.size(); i++ ) {
+        const Vertex& a = ring[i];
+        const Vertex& b = ring[i + 1];
+
+        if ( ( a.y > y ) != ( b.y > y ) && x < a.x + ( y - a.y ) * ( b.x - a.x ) / ( b.y - a.y ) ) {
+            inside = ! inside ;
+        }
+    }
+
+    return inside;
+}
+
+//
+// Plane of a ring (Newell's method) giving the z of the corners of the box inserted in a clipped polygon
+struct RingPlane {
+    RingPlane( const Path& ring ): valid( false ), xc( 0 ), yc( 0 ), zc( 0 ), nx( 0 ), ny( 0 ), nz( 0 ) {
+        const size_t n = ring.size() - 1 ;
+
+        for ( size_t i = 0; i < n; i++ ) {
+            const Vertex& a = ring[i];
+            const Vertex& b = ring[i + 1];
+            nx += ( a.y - b.y ) * ( a.z + b.z );
+            ny += ( a.z - b.z ) * ( a.x + b.x );
+            nz += ( a.x - b.x ) * ( a.y + b.y );
+            xc += a.x ;
+            yc += a.y ;
+            zc += a.z ;
+        }
+
+        xc /= n ;
+        yc /= n ;
+        zc /= n ;
+        valid = nz != 0.0 && ! std::isnan( nx + ny + nz + zc ) ;
+    }
+
+    double z( double x, double y ) const {
+        return zc - ( nx * ( x - xc ) + ny * ( y - yc ) ) / nz ;
+    }
+
+    bool valid;
+    double xc, yc, zc, nx, ny, nz;
+};
+
+//
+// Position along the boundary of the box, counter clockwise from (xmin,ymin)
+double perimeterPosition( const Box& box, const Vertex& v )
+{
+    const double d[4] = {
+        std::fabs( v.y - box.ymin ),
+        std::fabs( box.xmax - v.x ),
+        std::fabs( box.ymax - v.y ),
+        std::fabs( v.x - box.xmin )
+    };
+    const int k = std::min_element( d, d + 4 ) - d ;
+
+    switch ( k ) {
+    case 0:
+        return v.x - box.xmin ;
+
+    case 1:
+        return box.width() + ( v.y - box.ymin );
+
+    case 2:
+        return box.width() + box.height() + ( box.xmax - v.x );
+
+    default:
+        return 2.0 * box.width() + box.height() + ( box.ymax - v.y );
+    }
+}
+
+//
+// Connects the pieces of the clipped rings along the boundary of the box. The rings are
+// oriented with the interior of the polygon on the left (counter clockwise exterior, clockwise
+// holes), so that a piece leaving the box is followed counter clockwise along the boundary
+// up to the next piece entering it.
+std::vector< Path > connectPieces( const Box& box, const std::vector< Path >& pieces, const RingPlane& plane )
+{
+    const double w = box.width();
+    const double h = box.height();
+    const double perimeter = 2.0 * ( w + h );
+    const double cornerPositions[4] = { 0.0, w, w + h, 2.0 * w + h };
+    const double cornerX[4] = { box.xmin, box.xmax, box.xmax, box.xmin };
+    const double cornerY[4] = { box.ymin, box.ymin, box.ymax, box.ymax };
+
+    std::vector< double > starts( pieces.size() ), ends( pieces.size() );
+    std::set< std::pair< double, size_t > > available;
+
+    for ( size_t i = 0; i < pieces.size(); i++ ) {
+        starts[i] = perimeterPosition( box, pieces[i].front() );
+        ends[i]   = perimeterPosition( box, pieces[i].back() );
+        available.insert( std::make_pair( starts[i], i ) );
+    }
+
+    std::vector< Path > rings;
+
+    while ( ! available.empty() ) {
+        const size_t first = available.begin()->second ;
+        available.erase( available.begin() );
+
+        Path ring = pieces[first];
+        size_t current = first ;
+
+        while ( true ) {
+            const double e = ends[current];
+
+            // next entering piece counter clockwise, the ring is closed if its own start comes first
+            std::set< std::pair< double, size_t > >::iterator next = available.lower_bound( std::make_pair( e, size_t( 0 ) ) );
+
+            if ( next == available.end() ) {
+                next = available.begin();
+            }
+
+            double dClose = starts[first] - e ;
+
+            if ( dClose < 0.0 ) {
+                dClose += perimeter ;
+            }
+
+            double dNext = std::numeric_limits< double >::infinity() ;
+
+            if ( next != available.end() ) {
+                dNext = next->first - e ;
+
+                if ( dNext < 0.0 ) {
+                    dNext += perimeter ;
+                }
+            }
+
+            const bool close = dClose <= dNext ;
+            const double d = close ? dClose : dNext ;
+            const Vertex& target = close ? pieces[first].front() : pieces[next->second].front();
+            const Vertex exit = ring.back();
+
+            // corners of the box between the exit and the next entry
+            std::vector< std::pair< double, int > > corners;
+
+            for ( int k = 0; k < 4; k++ ) {
+                double dc = cornerPositions[k] - e ;
+
+                if ( dc < 0.0 ) {
+                    dc += perimeter ;
+                }
+
+                if ( dc > 0.0 && dc < d ) {
+                    corners.push_back( std::make_pair( dc, k ) );
+                }
+            }
+
+            std::sort( corners.begin(), corners.end() );
+
+            for ( size_t c = 0; c < corners.size(); c++ ) {
+                Vertex corner = interpolate( exit, target, corners[c].first / d );
+                corner.x = cornerX[ corners[c].second ];
+                corner.y = cornerY[ corners[c].second ];
+
+                if ( plane.valid ) {
+                    corner.z = plane.z( corner.x, corner.y );
+                }
+
+                ring.push_back( corner );
+            }
+
+            if ( close ) {
+                if ( ! sameXY( ring.back(), ring.front() ) ) {
+                    ring.push_back( ring.front() );
+                }
+
+                break;
+            }
+
+            current = next->second ;
+            available.erase( next );
+
+            const Path& piece = pieces[current];
+            ring.insert( ring.end(), sameXY( piece.front(), ring.back() ) ? piece.begin() + 1 : piece.begin(), piece.end() );
+        }
+
+        // degenerated rings along the boundary
+        if ( ring.size() > 3 && signedArea( ring ) > 0.0 ) {
+            rings.push_back( ring );
+        }
+    }
+
+    return rings;
+}
+
+//
+// Clips a Polygon, appends the resulting polygons
+void clipPolygon( const Box& box, const Polygon& polygon, const Dimensions& dims, std::vector< Polygon* >& result )
+{
+    if ( polygon.isEmpty() || box.width() <= 0.0 || box.height() <= 0.0 ) {
+        return;
+    }
+
+    std::vector< Path > rings;
+
+    for ( size_t i = 0; i < polygon.numRings(); i++ ) {
+        Path ring = toPath( polygon.ringN( i ) );
+
+        // interior on the left
+        if ( ( signedArea( ring ) < 0.0 ) == ( i == 0 ) ) {
+            std::reverse( ring.begin(), ring.end() );
+        }
+
+        rings.push_back( ring );
+    }
+
+    std::vector< Path > shells;
+    std::vector< Path > holes;
+    std::vector< Path > pieces;
+    std::vector< bool > inBox( rings.size(), false );
+
+    for ( size_t i = 0; i < rings.size(); i++ ) {
+        bool cut = false ;
+        std::vector< Path > ringPieces = clipPath( box, rings[i], true, cut );
+
+        if ( ! cut ) {
+            inBox[i] = true ;
+            ( i == 0 ? shells : holes ).push_back( rings[i] );
+        }
+        else {
+            pieces.insert( pieces.end(), ringPieces.begin(), ringPieces.end() );
+        }
+    }
+
+    const RingPlane plane( rings[0] );
+
+    if ( ! pieces.empty() ) {
+        const std::vector< Path > connected = connectPieces( box, pieces, plane );
+        shells.insert( shells.end(), connected.begin(), connected.end() );
+    }
+    else if ( shells.empty() ) {
+        // no ring crosses the box, which is either inside the polygon or outside
+        // (the holes inside the box are added to it below)
+        const double x = ( box.xmin + box.xmax ) / 2.0 ;
+        const double y = ( box.ymin + box.ymax ) / 2.0 ;
+        bool inside = insideRing( x, y, rings[0] );
+
+        for ( size_t i = 1; i < rings.size() && inside; i++ ) {
+            inside = inBox[i] || ! insideRing( x, y, rings[i] );
+        }
+
+        if ( inside ) {
+            Path rectangle;
+            const double xs[5] = { box.xmin, box.xmax, box.xmax, box.xmin, box.xmin };
+            const double ys[5] = { box.ymin, box.ymin, box.ymax, box.ymax, box.ymin };
+
+            for ( int k = 0; k < 5; k++ ) {
+                Vertex v;
+                v.x = xs[k];
+                v.y = ys[k];
+                v.z = plane.valid ? plane.z( v.x, v.y ) : rings[0][0].z ;
+                v.m = NaN();
+                rectangle.push_back( v );
+            }
+
+            shells.push_back( rectangle );
+        }
+    }
+
+    std::vector< Polygon* > polygons;
+
+    for ( size_t i = 0; i < shells.size(); i++ ) {
+        polygons.push_back( new Polygon( toLineString( shells[i], dims ) ) );
+    }
+
+    // holes inside the box are put in the shell containing them
+    for ( size_t i = 0; i < holes.size(); i++ ) {
+        for ( size_t j = 0; j < shells.size(); j++ ) {
+            if ( insideRing( holes[i][0].x, holes[i][0].y, shells[j] ) ) {
+                polygons[j]->addInteriorRing( toLineString( holes[i], dims ) );
+                break;
+            }
+        }
+    }
+
+    result.insert( result.end(), polygons.begin(), polygons.end() );
+}
+
+//
+// Clips a LineString, appends the resulting parts
+void clipLineString( const Box& box, const LineString& lineString, const Dimensions& dims, std::vector< LineString* >& result )
+{
+    if ( lineString.isEmpty() ) {
+        return;
+    }
+
+    bool cut = false ;
+    const std::vector< Path > pieces = clipPath( box, toPath( lineString ), false, cut );
+
+    if ( ! cut ) {
+        if ( ! pieces.empty() ) {
+            result.push_back( lineString.clone() );
+        }
+
+        return;
+    }
+
+    for ( size_t i = 0; i < pieces.size(); i++ ) {
+        result.push_back( toLineString( pieces[i], dims ) );
+    }
+}
+
+void checkNotSolid( const Geometry& g )
+{
+    if ( g.geometryTypeId() == TYPE_SOLID || g.geometryTypeId() == TYPE_MULTISOLID ) {
+        BOOST_THROW_EXCEPTION( NotImplementedException(
+                                   ( boost::format( "clip(%s) is not implemented" ) % g.geometryType() ).str()
+                               ) );
+    }
+}
+
+template < typename Part, typename Multi >
+std::unique_ptr< Geometry > collectParts( std::vector< Part* >& parts )
+{
+    if ( parts.empty() ) {
+        return std::unique_ptr< Geometry >( new Part() );
+    }
+
+    if ( parts.size() == 1 ) {
+        return std::unique_ptr< Geometry >( parts[0] );
+    }
+
+    std::unique_ptr< Multi > multi( new Multi() );
+
+    for ( size_t i = 0; i < parts.size(); i++ ) {
+        multi->addGeometry( parts[i] );
+    }
+
+    return std::unique_ptr< Geometry >( multi.release() );
+}
+
+}
+
+///
+///
+///
+std::unique_ptr< Geometry > clip( const Geometry& g, const Envelope& envelope )
+{
+    // the XY projection of a solid is not valid
+    checkNotSolid( g );
+
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+
+    return clip( g, envelope, NoValidityCheck() );
+}
+
+///
+///
+///
+std::unique_ptr< Geometry > clip( const Geometry& g, const Envelope& envelope, NoValidityCheck )
+{
+    checkNotSolid( g );
+
+    Box box = { 0.0, 0.0, -1.0, -1.0 };
+
+    if ( ! envelope.isEmpty() ) {
+        box.xmin = envelope.xMin();
+        box.ymin = envelope.yMin();
+        box.xmax = envelope.xMax();
+        box.ymax = envelope.yMax();
+    }
+
+    // entirely inside
+    if ( ! g.isEmpty() && ! envelope.isEmpty() ) {
+        const Envelope gEnvelope = g.envelope();
+
+        if ( gEnvelope.xMin() >= box.xmin && gEnvelope.xMax() <= box.xmax &&
+                gEnvelope.yMin() >= box.ymin && gEnvelope.yMax() <= box.ymax ) {
+            return std::unique_ptr< Geometry >( g.clone() );
+        }
+    }
+
+    const Dimensions dims( g );
+
+    switch ( g.geometryTypeId() ) {
+    case TYPE_POINT: {
+        if ( ! g.isEmpty() && box.contains( toVertex( g.as< Point >() ) ) ) {
+            return std::unique_ptr< Geometry >( g.clone() );
+        }
+
+        return std::unique_ptr< Geometry >( new Point() );
+    }
+
+    case TYPE_MULTIPOINT: {
+        std::unique_ptr< MultiPoint > result( new MultiPoint() );
+
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            const Point& p = g.as< MultiPoint >().pointN( i );
+
+            if ( ! p.isEmpty() && box.contains( toVertex( p ) ) ) {
+                result->addGeometry( p );
+            }
+        }
+
+        return std::unique_ptr< Geometry >( result.release() );
+    }
+
+    case TYPE_LINESTRING: {
+        std::vector< LineString* > parts;
+        clipLineString( box, g.as< LineString >(), dims, parts );
+        return collectParts< LineString, MultiLineString >( parts );
+    }
+
+    case TYPE_MULTILINESTRING: {
+        std::vector< LineString* > parts;
+
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            clipLineString( box, g.as< MultiLineString >().lineStringN( i ), dims, parts );
+        }
+
+        std::unique_ptr< MultiLineString > result( new MultiLineString() );
+
+        for ( size_t i = 0; i < parts.size(); i++ ) {
+            result->addGeometry( parts[i] );
+        }
+
+        return std::unique_ptr< Geometry >( result.release() );
+    }
+
+    case TYPE_TRIANGLE:
+    case TYPE_POLYGON: {
+        std::vector< Polygon* > parts;
+
+        if ( g.geometryTypeId() == TYPE_TRIANGLE ) {
+            clipPolygon( box, g.as< Triangle >().toPolygon(), dims, parts );
+        }
+        else {
+            clipPolygon( box, g.as< Polygon >(), dims, parts );
+        }
+
+        return collectParts< Polygon, MultiPolygon >( parts );
+    }
+
+    case TYPE_MULTIPOLYGON: {
+        std::vector< Polygon* > parts;
+
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            clipPolygon( box, g.as< MultiPolygon >().polygonN( i ), dims, parts );
+        }
+
+        std::unique_ptr< MultiPolygon > result( new MultiPolygon() );
+
+        for ( size_t i = 0; i < parts.size(); i++ ) {
+            result->addGeometry( parts[i] );
+        }
+
+        return std::unique_ptr< Geometry >( result.release() );
+    }
+
+    case TYPE_TRIANGULATEDSURFACE:
+    case TYPE_POLYHEDRALSURFACE: {
+        std::vector< Polygon* > parts;
+
+        if ( g.geometryTypeId() == TYPE_TRIANGULATEDSURFACE ) {
+            const TriangulatedSurface& tin = g.as< TriangulatedSurface >();
+
+            for ( size_t i = 0; i < tin.numTriangles(); i++ ) {
+                clipPolygon( box, tin.triangleN( i ).toPolygon(), dims, parts );
+            }
+        }
+        else {
+            const PolyhedralSurface& surface = g.as< PolyhedralSurface >();
+
+            for ( size_t i = 0; i < surface.numPolygons(); i++ ) {
+                clipPolygon( box, surface.polygonN( i ), dims, parts );
+            }
+        }
+
+        std::unique_ptr< PolyhedralSurface > result( new PolyhedralSurface() );
+
+        for ( size_t i = 0; i < parts.size(); i++ ) {
+            result->addPolygon( parts[i] );
+        }
+
+        return std::unique_ptr< Geometry >( result.release() );
+    }
+
+    case TYPE_GEOMETRYCOLLECTION: {
+        std::unique_ptr< GeometryCollection > result( new GeometryCollection() );
+
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            std::unique_ptr< Geometry > part = clip( g.geometryN( i ), envelope, NoValidityCheck() );
+
+            if ( ! part->isEmpty() ) {
+                result->addGeometry( part.release() );
+            }
+        }
+
+        return std::unique_ptr< Geometry >( result.release() );
+    }
+
+    default:
+        break;
+    }
+
+    BOOST_THROW_EXCEPTION( NotImplementedException(
+                               ( boost::format( "clip(%s) is not implemented" ) % g.geometryType() ).str()
+                           ) );
+}
+
+}//namespace algorithm
+}//namespace SFCGAL
@@ -0,0 +1,64 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_ALGORITHM_CLIP_H_
+#define _SFCGAL_ALGORITHM_CLIP_H_
+
+#include <SFCGAL/config.h>
+
+#include <memory>
+
+namespace SFCGAL {
+class Geometry;
+class Envelope;
+
+namespace algorithm {
+struct NoValidityCheck;
+
+/**
+ * Clips a Geometry by the XY rectangle of an Envelope, without the general boolean operations.
+ *
+ * Lines are clipped segment by segment (Liang-Barsky), the rings of the polygons are clipped
+ * as lines and the pieces are connected along the rectangle boundary, so that holes and
+ * multiple parts are handled. Z and M of the new vertices are linearly interpolated.
+ *
+ * Geometries entirely inside the rectangle are copied. Otherwise the coordinates are
+ * computed in double precision, points and segments of polygons touching the rectangle
+ * are dropped.
+ *
+ * @return a geometry of the same dimension: Point or MultiPoint, LineString or MultiLineString,
+ * Polygon or MultiPolygon, PolyhedralSurface for surfaces, GeometryCollection for collections
+ * @throws NotImplementedException for solids
+ * @pre g is a valid geometry
+ * @ingroup public_api
+ */
+SFCGAL_API std::unique_ptr< Geometry > clip( const Geometry& g, const Envelope& envelope );
+
+/**
+ * Clips a Geometry by the XY rectangle of an Envelope
+ * @ingroup detail
+ * @pre g is a valid geometry
+ * @warning No actual validity check is done
+ */
+SFCGAL_API std::unique_ptr< Geometry > clip( const Geometry& g, const Envelope& envelope, NoValidityCheck );
+
+}//namespace algorithm
+}//namespace SFCGAL
+
+#endif
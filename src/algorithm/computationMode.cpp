@@ -0,0 +1,67 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/algorithm/computationMode.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace SFCGAL {
+namespace algorithm {
+
+namespace {
+std::atomic< int > globalComputationMode( EXACT_COMPUTATION );
+std::atomic< size_t > globalNumThreads( 1 );
+}
+
+///
+///
+///
+void setComputationMode( ComputationMode mode )
+{
+    globalComputationMode = mode;
+}
+
+///
+///
+///
+ComputationMode computationMode()
+{
+    return static_cast< ComputationMode >( globalComputationMode.load() );
+}
+
+///
+///
+///
+void setNumThreads( size_t numThreads )
+{
+    globalNumThreads = std::max( numThreads, size_t( 1 ) );
+}
+
+///
+///
+///
+size_t numThreads()
+{
+    return globalNumThreads.load();
+}
+
+}//algorithm
+}//SFCGAL
@@ -0,0 +1,105 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_COMPUTATIONMODE_H_
+#define _SFCGAL_ALGORITHM_COMPUTATIONMODE_H_
+
+#include <SFCGAL/config.h>
+
+#include <cstddef>
+
+namespace SFCGAL {
+namespace algorithm {
+
+/**
+ * Tag used for variants of algorithms that run on double precision types (SFCGAL::InexactKernel,
+ * i.e. CGAL::Epick) rather than on the exact SFCGAL::Kernel.
+ *
+ * Robustness contract of the fast variants:
+ * - input coordinates are rounded to the nearest double before any computation, Z and M are ignored
+ *   by 2D algorithms;
+ * - predicates (intersects, orientation, point location) are exact on the rounded coordinates, so
+ *   the answer is the exact answer for the rounded input;
+ * - measures (area, length, distance) are computed in double precision and carry the rounding error
+ *   of the floating point operations;
+ * - constructed geometries only use input vertices: convexHull returns them rounded to double,
+ *   tesselate and triangulate2DZ keep the original coordinates.
+ * Results may therefore differ from the exact variants for coordinates that are not representable
+ * as doubles or for nearly degenerate configurations.
+ *
+ * Validity of the inputs is not checked by area, distance and intersects in fast mode: the check
+ * runs on the exact kernel and would cost more than the computation itself. Invalid inputs give
+ * unspecified results. tesselate still checks its input since vertical polygons fall back to the
+ * exact triangulation.
+ *
+ * @ingroup public_api
+ */
+struct FastMode {};
+
+/**
+ * Computation mode used by the algorithms that have a FastMode variant
+ * (area, length, distance, intersects, convexHull and tesselate)
+ * @ingroup public_api
+ */
+enum ComputationMode {
+    /**
+     * exact computations with SFCGAL::Kernel (default)
+     */
+    EXACT_COMPUTATION = 0,
+    /**
+     * double precision computations with SFCGAL::InexactKernel
+     * @see FastMode
+     */
+    FAST_COMPUTATION  = 1
+};
+
+/**
+ * Sets the global computation mode
+ * @ingroup public_api
+ */
+SFCGAL_API void setComputationMode( ComputationMode mode );
+
+/**
+ * Returns the global computation mode (EXACT_COMPUTATION by default)
+ * @ingroup public_api
+ */
+SFCGAL_API ComputationMode computationMode();
+
+/**
+ * Sets the number of threads used to process the candidate pairs of primitives in
+ * intersection and difference (1 by default, i.e. sequential). Results do not
+ * depend on the number of threads.
+ *
+ * @warning primitives are read by several threads, CGAL must be built with thread
+ * support (CGAL_HAS_THREADS) for the reference counting of the exact numbers
+ * @ingroup public_api
+ */
+SFCGAL_API void setNumThreads( size_t numThreads );
+
+/**
+ * Returns the number of threads used to process candidate pairs of primitives
+ * @ingroup public_api
+ */
+SFCGAL_API size_t numThreads();
+
+}//algorithm
+}//SFCGAL
+
+#endif
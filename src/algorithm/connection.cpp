@@ -22,6 +22,7 @@
 #include <SFCGAL/algorithm/connection.h>
 
 #include <SFCGAL/Coordinate.h>
+#include <SFCGAL/Point.h>
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/Polygon.h>
 #include <SFCGAL/Triangle.h>
@@ -35,13 +36,18 @@ namespace algorithm {
 
 const size_t SurfaceGraph::INVALID_INDEX = std::numeric_limits< size_t >::max();
 
+Coordinate SurfaceGraph::vertexCoordinate( const Point& p ) const
+{
+    return _projected ? Coordinate( p.x(), p.y() ) : p.coordinate() ;
+}
+
 void SurfaceGraph::addRing( const LineString& ring, FaceIndex faceIndex )
 {
     const size_t numSegments = ring.numSegments() ;
 
     for ( size_t s = 0; s != numSegments; ++s ) { // for each segment
-        const Coordinate startCoord = ring.pointN( s ).coordinate() ;
-        const Coordinate endCoord = ring.pointN( ( s + 1 ) % numSegments ).coordinate() ; // possible optimization: store the index of ring start point instead of finding it
+        const Coordinate startCoord = vertexCoordinate( ring.pointN( s ) ) ;
+        const Coordinate endCoord = vertexCoordinate( ring.pointN( ( s + 1 ) % numSegments ) ) ; // possible optimization: store the index of ring start point instead of finding it
         const CoordinateMap::const_iterator startFound = _coordinateMap.find( startCoord ) ;
         const CoordinateMap::const_iterator endFound = _coordinateMap.find( endCoord ) ;
         BOOST_ASSERT( s + 1 != numSegments || endFound != _coordinateMap.end() ); // ring not closed
@@ -78,27 +84,21 @@ void SurfaceGraph::addRing( const LineString& ring, FaceIndex faceIndex )
         }
         else {
             // one end at least is missing, create the edge
-            VertexIndex startIndex ;
+            // (an insertion may rehash the map, the found indexes are read before)
+            VertexIndex startIndex = startFound != _coordinateMap.end() ? startFound->second : INVALID_INDEX ;
+            VertexIndex endIndex = endFound != _coordinateMap.end() ? endFound->second : INVALID_INDEX ;
 
-            if ( startFound == _coordinateMap.end() ) {
+            if ( startIndex == INVALID_INDEX ) {
                 _coordinateMap.insert( std::make_pair( startCoord, _numVertices ) ) ;
                 startIndex = _numVertices;
                 ++_numVertices ;
             }
-            else {
-                startIndex = startFound->second;
-            }
-
-            VertexIndex endIndex ;
 
-            if ( endFound == _coordinateMap.end() ) {
+            if ( endIndex == INVALID_INDEX ) {
                 _coordinateMap.insert( std::make_pair( endCoord, _numVertices ) ) ;
                 endIndex = _numVertices;
                 ++_numVertices ;
             }
-            else {
-                endIndex = endFound-> second;
-            }
 
             const std::pair< VertexIndex, VertexIndex > edge( startIndex, endIndex );
 
@@ -109,11 +109,14 @@ void SurfaceGraph::addRing( const LineString& ring, FaceIndex faceIndex )
     }
 }
 
-SurfaceGraph::SurfaceGraph( const PolyhedralSurface& surf ) :
+SurfaceGraph::SurfaceGraph( const PolyhedralSurface& surf, bool projected ) :
     _numVertices( 0 ),
-    _isValid( Validity::valid() )
+    _isValid( Validity::valid() ),
+    _projected( projected )
 {
     const size_t numPolygons = surf.numPolygons() ;
+    _coordinateMap.reserve( 2 * numPolygons );
+    _edgeMap.reserve( 2 * numPolygons );
 
     for ( size_t p = 0; p != numPolygons; ++p ) { // for each polygon
         const FaceIndex idx = boost::add_vertex( _graph );
@@ -128,11 +131,15 @@ SurfaceGraph::SurfaceGraph( const PolyhedralSurface& surf ) :
     }
 }
 
-SurfaceGraph::SurfaceGraph( const TriangulatedSurface& tin ) :
+SurfaceGraph::SurfaceGraph( const TriangulatedSurface& tin, bool projected ) :
     _numVertices( 0 ),
-    _isValid( Validity::valid() )
+    _isValid( Validity::valid() ),
+    _projected( projected )
 {
     const size_t numTriangles = tin.numTriangles() ;
+    // a closed triangulation has about n/2 vertices and 3n/2 edges
+    _coordinateMap.reserve( numTriangles );
+    _edgeMap.reserve( 2 * numTriangles );
 
     for ( size_t t = 0; t != numTriangles; ++t ) { // for each polygon
         const FaceIndex idx = boost::add_vertex( _graph );
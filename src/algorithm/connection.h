@@ -24,10 +24,12 @@
 #include <SFCGAL/Geometry.h>
 #include <SFCGAL/Coordinate.h>
 #include <SFCGAL/Validity.h>
+#include <SFCGAL/detail/CoordinateHash.h>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/connected_components.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/noncopyable.hpp>
-#include <map>
+#include <unordered_map>
 
 namespace SFCGAL {
 namespace algorithm {
@@ -43,26 +45,29 @@ class SFCGAL_API SurfaceGraph : boost::noncopyable {
 public:
     typedef size_t VertexIndex;
     typedef size_t FaceIndex;
-    typedef std::map< Coordinate, VertexIndex >  CoordinateMap ;
+    typedef detail::CoordinateIndex< Coordinate, VertexIndex >::Type  CoordinateMap ;
     static const size_t INVALID_INDEX;
     // an edge is inserted with vtx ordered by the first polygon we treat,
     // we search the edge with reverse ordered vtx indexes.
     // as a result, an inconsistent orientation between polygons can be spotted by
     // finding the edge in the same order
     // note that this situation may be caused if a face is duplicated
-    typedef std::map< std::pair < VertexIndex, VertexIndex > , std::pair< FaceIndex, FaceIndex > >  EdgeMap ;
+    typedef std::unordered_map< std::pair < VertexIndex, VertexIndex > , std::pair< FaceIndex, FaceIndex >,
+            boost::hash< std::pair < VertexIndex, VertexIndex > > >  EdgeMap ;
     typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS > FaceGraph;
     /*
      * Construct from PolyHedralSurface
+     * @param projected if true, vertices are identified by their x and y only (graph of the XY projection)
      * @throw Exception if surface is not connected
      */
-    SurfaceGraph( const PolyhedralSurface& s );
+    SurfaceGraph( const PolyhedralSurface& s, bool projected = false );
 
     /*
      * Construct from TriangulatedSurface
+     * @param projected if true, vertices are identified by their x and y only (graph of the XY projection)
      * @throw Exception if surface is not connected
      */
-    SurfaceGraph( const TriangulatedSurface& tin ) ;
+    SurfaceGraph( const TriangulatedSurface& tin, bool projected = false ) ;
 
     const EdgeMap& edgeMap() const {
         return _edgeMap ;
@@ -82,7 +87,9 @@ private:
     VertexIndex _numVertices ;
 
     Validity _isValid ;
+    bool _projected ;
 
+    Coordinate vertexCoordinate( const Point& p ) const ; // helper for addRing
     void addRing( const LineString& ring, FaceIndex faceIndex ); // helper for ctor
 };
 
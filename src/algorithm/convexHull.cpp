@@ -27,6 +27,8 @@
 #include <SFCGAL/GeometryCollection.h>
 
 #include <SFCGAL/detail/GetPointsVisitor.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+#include <SFCGAL/algorithm/computationMode.h>
 
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Exception.h>
@@ -49,12 +51,48 @@ typedef CGAL::Polyhedron_3< Kernel >                         Polyhedron_3;
 
 typedef CGAL::Point_2< Kernel >                              Point_2;
 
+namespace {
+
+//
+// Build the resulting geometry from the extreme points returned by CGAL::convex_hull_2
+std::unique_ptr<Geometry> _hullGeometry( const std::vector< Point >& epoints )
+{
+    if ( epoints.size() == 1 ) {
+        return std::unique_ptr<Geometry>( new Point( epoints[0] ) );
+    }
+    else if ( epoints.size() == 2 ) {
+        return std::unique_ptr<Geometry>( new LineString( epoints[0], epoints[1] ) );
+    }
+    // GEOS does not seem to return triangles
+    else if ( epoints.size() == 3 ) {
+        return std::unique_ptr<Geometry>( new Triangle( epoints[0], epoints[1], epoints[2] ) ) ;
+    }
+    else if ( epoints.size() > 3 ) {
+        Polygon* poly = new Polygon;
+
+        for ( std::vector< Point >::const_iterator it = epoints.begin(); it != epoints.end(); ++it ) {
+            poly->exteriorRing().addPoint( *it );
+        }
+
+        // add back the first point to close the ring
+        poly->exteriorRing().addPoint( epoints.front() );
+        return std::unique_ptr<Geometry>( poly );
+    }
+    else {
+        BOOST_THROW_EXCEPTION( Exception( "unexpected CGAL output type in CGAL::convex_hull_2" ) );
+    }
+}
+
+}
+
 ///
 ///
 ///
 std::unique_ptr<Geometry> convexHull( const Geometry& g )
 {
-    using CGAL::object_cast ;
+    if ( computationMode() == FAST_COMPUTATION ) {
+        return convexHull( g, FastMode() );
+    }
 
     if ( g.isEmpty() ) {
         return std::unique_ptr<Geometry>( g.clone() );
@@ -79,35 +117,43 @@ std::unique_ptr<Geometry> convexHull( const Geometry& g )
     std::list<Point_2> epoints;
     CGAL::convex_hull_2( points.begin(), points.end(), std::back_inserter( epoints ) ) ;
 
-    if ( epoints.size() == 1 ) {
-        return std::unique_ptr<Geometry>( new Point( *epoints.begin() ) );
-    }
-    else if ( epoints.size() == 2 ) {
-        std::list<Point_2>::const_iterator it = epoints.begin();
-        return std::unique_ptr<Geometry>( new LineString( Point( *it++ ), Point( *it++ ) ) );
+    return _hullGeometry( std::vector< Point >( epoints.begin(), epoints.end() ) );
+}
+
+///
+///
+///
+std::unique_ptr<Geometry> convexHull( const Geometry& g, FastMode )
+{
+    if ( g.isEmpty() ) {
+        return std::unique_ptr<Geometry>( g.clone() );
     }
-    // GEOS does not seem to return triangles
-    else if ( epoints.size() == 3 ) {
-        std::list<Point_2>::const_iterator it = epoints.begin();
-        Point_2 p( *it++ );
-        Point_2 q( *it++ );
-        Point_2 r( *it++ );
-        return std::unique_ptr<Geometry>( new Triangle( p, q, r ) ) ;
+
+    SFCGAL::detail::GetPointsVisitor getPointVisitor;
+    const_cast< Geometry& >( g ).accept( getPointVisitor );
+
+    if ( getPointVisitor.points.size() == 0 ) {
+        return std::unique_ptr<Geometry>( new GeometryCollection() );
     }
-    else if ( epoints.size() > 3 ) {
-        Polygon* poly = new Polygon;
 
-        for ( std::list<Point_2>::const_iterator it = epoints.begin(); it != epoints.end(); ++it ) {
-            poly->exteriorRing().addPoint( *it );
-        }
+    std::vector< InexactKernel::Point_2 > points ;
+    points.reserve( getPointVisitor.points.size() );
 
-        // add back the first point to close the ring
-        poly->exteriorRing().addPoint( *epoints.begin() );
-        return std::unique_ptr<Geometry>( poly );
+    for ( size_t i = 0; i < getPointVisitor.points.size(); i++ ) {
+        points.push_back( SFCGAL::detail::toInexactPoint_2( *getPointVisitor.points[i] ) );
     }
-    else {
-        BOOST_THROW_EXCEPTION( Exception( "unexpected CGAL output type in CGAL::convex_hull_2" ) );
+
+    std::vector< InexactKernel::Point_2 > epoints;
+    CGAL::convex_hull_2( points.begin(), points.end(), std::back_inserter( epoints ) ) ;
+
+    std::vector< Point > result ;
+    result.reserve( epoints.size() );
+
+    for ( size_t i = 0; i < epoints.size(); i++ ) {
+        result.push_back( SFCGAL::detail::toExactPoint( epoints[i] ) );
     }
+
+    return _hullGeometry( result );
 }
 
 ///
@@ -27,6 +27,7 @@
 
 namespace SFCGAL {
 namespace algorithm {
+struct FastMode;
 
 /**
  * Compute the 2D convex hull for a geometry
@@ -34,6 +35,13 @@ namespace algorithm {
  */
 SFCGAL_API std::unique_ptr<Geometry> convexHull( const Geometry& g ) ;
 
+/**
+ * Compute the 2D convex hull for a geometry with double precision coordinates
+ * @ingroup public_api
+ * @see FastMode for the robustness contract
+ */
+SFCGAL_API std::unique_ptr<Geometry> convexHull( const Geometry& g, FastMode ) ;
+
 /**
  * Compute the 3D convex hull for a geometry
  * @todo improve to handle collinear points and coplanar points
@@ -23,9 +23,14 @@
 #include <SFCGAL/Geometry.h>
 #include <SFCGAL/algorithm/intersects.h>
 #include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/detail/TypeForDimension.h>
 #include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/IndexedGeometrySet.h>
+#include <SFCGAL/detail/algorithm/fastPredicates.h>
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/DecomposedGeometry.h>
 
 #include <CGAL/box_intersection_d.h>
 
@@ -197,6 +202,31 @@ bool equalLength( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b, int dim
     return true;
 }
 
+//
+// covers(A,B) <=> A inter B == B
+// '==' is here implemented with comparison of length, area and volumes
+template <int Dim>
+bool coveredByIntersection( const GeometrySet<Dim>& b, const GeometrySet<Dim>& inter )
+{
+    if ( b.hasPoints() && ! equalLength( b, inter, 0 ) ) {
+        return false;
+    }
+
+    if ( b.hasSegments() && ! equalLength( b, inter, 1 ) ) {
+        return false;
+    }
+
+    if ( b.hasSurfaces() && ! equalLength( b, inter, 2 ) ) {
+        return false;
+    }
+
+    if ( b.hasVolumes() && ! equalLength( b, inter, 3 ) ) {
+        return false;
+    }
+
+    return true;
+}
+
 template <int Dim>
 bool covers( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
 {
@@ -211,36 +241,76 @@ bool covers( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
         return false;
     }
 
+    // B is not empty, it can't be covered by A if they are disjoint.
+    // This test stops on the first intersecting pair, which is much
+    // cheaper than building the intersection
+    if ( ! intersects( a, b ) ) {
+        return false;
+    }
+
     //
     // This is a very naive (not efficient) implementation of covers() !
     //
-    // covers(A,B) <=> A inter B == B
-    // '==' is here implemented with comparison of length, area and volumes
     // TODO use only predicates if possible
     GeometrySet<Dim> inter;
     algorithm::intersection( a, b, inter );
 
-    if ( b.hasPoints() && ! equalLength( b, inter, 0 ) ) {
+    return coveredByIntersection( b, inter );
+}
+
+template bool covers<2>( const GeometrySet<2>& a, const GeometrySet<2>& b );
+template bool covers<3>( const GeometrySet<3>& a, const GeometrySet<3>& b );
+
+template <int Dim>
+bool covers( const IndexedGeometrySet<Dim>& a, const GeometrySet<Dim>& b )
+{
+    int dimA = a.geometrySet().dimension();
+    int dimB = b.dimension();
+
+    if ( dimA == -1 || dimB == -1 ) {
         return false;
     }
 
-    if ( b.hasSegments() && ! equalLength( b, inter, 1 ) ) {
+    if ( dimB > dimA ) {
         return false;
     }
 
-    if ( b.hasSurfaces() && ! equalLength( b, inter, 2 ) ) {
-        return false;
+    if ( dimB == 0 ) {
+        // a point is covered as soon as it intersects A
+        for ( typename GeometrySet<Dim>::PointCollection::const_iterator it = b.points().begin();
+                it != b.points().end();
+                ++it ) {
+            const PrimitiveHandle<Dim> handle( &it->primitive() );
+
+            if ( ! intersects( a, handle, it->primitive().bbox() ) ) {
+                return false;
+            }
+        }
+
+        return true;
     }
 
-    if ( b.hasVolumes() && ! equalLength( b, inter, 3 ) ) {
+    if ( ! intersects( a, b ) ) {
         return false;
     }
 
-    return true;
+    GeometrySet<Dim> inter;
+    algorithm::intersection( a, b, inter );
+
+    return coveredByIntersection( b, inter );
 }
 
-template bool covers<2>( const GeometrySet<2>& a, const GeometrySet<2>& b );
-template bool covers<3>( const GeometrySet<3>& a, const GeometrySet<3>& b );
+template bool covers<2>( const IndexedGeometrySet<2>& a, const GeometrySet<2>& b );
+template bool covers<3>( const IndexedGeometrySet<3>& a, const GeometrySet<3>& b );
+
+template <int Dim>
+bool covers( const DecomposedGeometry<Dim>& a, const DecomposedGeometry<Dim>& b )
+{
+    return covers( a.geometrySet(), b.geometrySet() );
+}
+
+template bool covers<2>( const DecomposedGeometry<2>& a, const DecomposedGeometry<2>& b );
+template bool covers<3>( const DecomposedGeometry<3>& a, const DecomposedGeometry<3>& b );
 
 bool covers( const Geometry& ga, const Geometry& gb )
 {
@@ -248,6 +318,12 @@ bool covers( const Geometry& ga, const Geometry& gb )
         return false;
     }
 
+    const boost::optional< bool > fast = detail::algorithm::coversFastPath( ga, gb );
+
+    if ( fast ) {
+        return *fast;
+    }
+
     GeometrySet<2> gsa( ga );
     GeometrySet<2> gsb( gb );
 
@@ -260,10 +336,42 @@ bool covers3D( const Geometry& ga, const Geometry& gb )
         return false;
     }
 
+    const boost::optional< bool > fast = detail::algorithm::covers3DFastPath( ga, gb );
+
+    if ( fast ) {
+        return *fast;
+    }
+
     GeometrySet<3> gsa( ga );
     GeometrySet<3> gsb( gb );
 
     return covers( gsa, gsb );
 }
+
+bool covers( const PreparedGeometry& pa, const Geometry& gb )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gb );
+
+    if ( pa.geometry().isEmpty() || gb.isEmpty() ) {
+        return false;
+    }
+
+    GeometrySet<2> gsb( gb );
+
+    return covers( pa.indexedGeometrySet2D(), gsb );
+}
+
+bool covers3D( const PreparedGeometry& pa, const Geometry& gb )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gb );
+
+    if ( pa.geometry().isEmpty() || gb.isEmpty() ) {
+        return false;
+    }
+
+    GeometrySet<3> gsb( gb );
+
+    return covers( pa.indexedGeometrySet3D(), gsb );
+}
 }
 }
@@ -29,9 +29,12 @@ namespace SFCGAL {
 class Geometry;
 class Solid;
 class Point;
+class PreparedGeometry;
+template <int Dim> class DecomposedGeometry;
 namespace detail {
 template <int Dim> class GeometrySet;
 template <int Dim> struct PrimitiveHandle;
+template <int Dim> class IndexedGeometrySet;
 }
 
 namespace algorithm {
@@ -46,6 +49,33 @@ SFCGAL_API bool covers( const Geometry& ga, const Geometry& gb );
  */
 SFCGAL_API bool covers3D( const Geometry& ga, const Geometry& gb );
 
+/**
+ * Cover test on 2D geometries, reusing the decomposition and the box tree of a prepared geometry.
+ * Checks if pA covers gB. Force projection to z=0 if needed
+ * @ingroup public_api
+ */
+SFCGAL_API bool covers( const PreparedGeometry& pa, const Geometry& gb );
+
+/**
+ * Cover test on 3D geometries, reusing the decomposition and the box tree of a prepared geometry.
+ * Checks if pA covers gB. Assume z = 0 if needed
+ * @ingroup public_api
+ */
+SFCGAL_API bool covers3D( const PreparedGeometry& pa, const Geometry& gb );
+
+/**
+ * Cover test on two decomposed geometries (covers3D for Dim = 3). Checks if a covers b
+ * @ingroup public_api
+ */
+template <int Dim>
+bool covers( const DecomposedGeometry<Dim>& a, const DecomposedGeometry<Dim>& b );
+
+/**
+ * @ingroup@ detail
+ */
+template <int Dim>
+bool covers( const detail::IndexedGeometrySet<Dim>& a, const detail::GeometrySet<Dim>& b );
+
 /**
  * @ingroup@ detail
  */
@@ -22,7 +22,10 @@
 #include <SFCGAL/algorithm/difference.h>
 #include <SFCGAL/Exception.h>
 #include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/DecomposedGeometry.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/computationMode.h>
+#include <SFCGAL/detail/tools/ParallelFor.h>
 #include <SFCGAL/triangulate/triangulatePolygon.h>
 #include <SFCGAL/Polygon.h>
 #include <SFCGAL/TriangulatedSurface.h>
@@ -341,6 +344,22 @@ void post_difference( const GeometrySet<3>& input, GeometrySet<3>& output )
     output = input;
 }
 
+//
+// Difference of a primitive of A with the primitives of B that collide with it
+template <int Dim>
+struct DifferenceTask {
+    typedef std::vector< typename CollisionMapper<Dim>::Map::const_iterator > Operations;
+
+    DifferenceTask( const Operations& ops, std::vector< GeometrySet<Dim> >& out ) : operations( ops ), outputs( out ) {}
+
+    void operator()( size_t i ) {
+        appendDifference( *operations[i]->first, operations[i]->second.begin(), operations[i]->second.end(), outputs[i] );
+    }
+
+    const Operations& operations;
+    std::vector< GeometrySet<Dim> >& outputs;
+};
+
 template <int Dim>
 void difference( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b, GeometrySet<Dim>& output )
 {
@@ -374,7 +393,24 @@ void difference( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b, GeometryS
     }
 
     // then we delegate the operations according to type
-    {
+    if ( numThreads() > 1 && ! tools::insideParallelFor() ) {
+        // operations are independent, each one has its own output, outputs are
+        // merged in the sequential order
+        std::vector< typename CollisionMapper<Dim>::Map::const_iterator > operations;
+
+        for ( typename CollisionMapper<Dim>::Map::const_iterator cbit = map.begin(); cbit != map.end(); ++cbit ) {
+            operations.push_back( cbit );
+        }
+
+        std::vector< GeometrySet<Dim> > outputs( operations.size() );
+        DifferenceTask<Dim> task( operations, outputs );
+        tools::parallelFor( operations.size(), numThreads(), task );
+
+        for ( size_t i = 0; i < outputs.size(); ++i ) {
+            temp.merge( outputs[i] );
+        }
+    }
+    else {
         typename CollisionMapper<Dim>::Map::const_iterator cbit = map.begin();
         const typename CollisionMapper<Dim>::Map::const_iterator end = map.end();
 
@@ -390,6 +426,18 @@ void difference( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b, GeometryS
 template void difference<2>( const GeometrySet<2>& a, const GeometrySet<2>& b, GeometrySet<2>& );
 template void difference<3>( const GeometrySet<3>& a, const GeometrySet<3>& b, GeometrySet<3>& );
 
+template <int Dim>
+DecomposedGeometry<Dim> difference( const DecomposedGeometry<Dim>& a, const DecomposedGeometry<Dim>& b )
+{
+    GeometrySet<Dim> output, filtered;
+    algorithm::difference( a.geometrySet(), b.geometrySet(), output );
+    output.filterCovered( filtered );
+    return DecomposedGeometry<Dim>( std::move( filtered ) );
+}
+
+template DecomposedGeometry<2> difference<2>( const DecomposedGeometry<2>& a, const DecomposedGeometry<2>& b );
+template DecomposedGeometry<3> difference<3>( const DecomposedGeometry<3>& a, const DecomposedGeometry<3>& b );
+
 std::unique_ptr<Geometry> difference( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 {
     GeometrySet<2> gsa( ga ), gsb( gb ), output;
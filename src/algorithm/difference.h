@@ -27,6 +27,7 @@
 
 namespace SFCGAL {
 class Geometry;
+template <int Dim> class DecomposedGeometry;
 namespace detail {
 template <int Dim> class GeometrySet;
 template <int Dim> struct PrimitiveHandle;
@@ -65,6 +66,14 @@ SFCGAL_API std::unique_ptr<Geometry> difference3D( const Geometry& ga, const Geo
  */
 SFCGAL_API std::unique_ptr<Geometry> difference3D( const Geometry& ga, const Geometry& gb, NoValidityCheck );
 
+/**
+ * Difference of two decomposed geometries, the result is not recomposed
+ * (difference3D for Dim = 3)
+ * @ingroup public_api
+ */
+template <int Dim>
+DecomposedGeometry<Dim> difference( const DecomposedGeometry<Dim>& a, const DecomposedGeometry<Dim>& b );
+
 /**
  * @ingroup detail
  */
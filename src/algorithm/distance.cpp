@@ -30,6 +30,11 @@
 #include <SFCGAL/GeometryCollection.h>
 
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/computationMode.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+#include <SFCGAL/detail/IndexedGeometrySet.h>
+#include <SFCGAL/detail/StrTree.h>
+#include <SFCGAL/PreparedGeometry.h>
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Exception.h>
 
@@ -38,7 +43,6 @@
 
 #include <SFCGAL/detail/transform/AffineTransform3.h>
 #include <SFCGAL/algorithm/intersects.h>
-#include <SFCGAL/detail/GetPointsVisitor.h>
 
 
 typedef SFCGAL::Kernel::Point_2                                   Point_2 ;
@@ -92,11 +96,365 @@ double distance( const Geometry& gA, const Geometry& gB, NoValidityCheck )
 
 double distance( const Geometry& gA, const Geometry& gB )
 {
+    if ( computationMode() == FAST_COMPUTATION ) {
+        return distance( gA, gB, FastMode() );
+    }
+
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gA );
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gB );
     return distance( gA, gB, NoValidityCheck() );
 }
 
+///
+///
+///
+double distance( const Geometry& gA, const Geometry& gB, FastMode )
+{
+    if ( gA.geometryTypeId() == TYPE_SOLID || gB.geometryTypeId() == TYPE_SOLID ) {
+        BOOST_THROW_EXCEPTION( NotImplementedException(
+                                   ( boost::format( "distance(%s,%s) is not implemented" ) % gA.geometryType() % gB.geometryType() ).str()
+                               ) );
+    }
+
+    return detail::InexactGeometrySet( gA ).distance( detail::InexactGeometrySet( gB ) );
+}
+
+namespace {
+
+//
+// Lower bound of the squared distance between a box and the boxes of the tree
+struct BoxSquaredDistance {
+    BoxSquaredDistance( const CGAL::Bbox_2& box_ ): box( box_ ) {}
+
+    double operator()( const CGAL::Bbox_2& other ) const {
+        return SFCGAL::detail::squaredDistance( box, other );
+    }
+
+    CGAL::Bbox_2 box;
+};
+
+//
+// Squared distance between a primitive and a boundary element (point or segment) of the tree
+template < typename Primitive >
+struct BoundarySquaredDistance {
+    BoundarySquaredDistance( const Primitive& primitive_, const SFCGAL::detail::GeometrySetBoundary2& boundary_ ):
+        primitive( primitive_ ), boundary( boundary_ ) {}
+
+    double operator()( const std::pair< CGAL::Bbox_2, size_t >& item ) const {
+        if ( item.second < boundary.points.size() ) {
+            return CGAL::to_double( CGAL::squared_distance( primitive, boundary.points[ item.second ] ) );
+        }
+
+        return CGAL::to_double( CGAL::squared_distance( primitive, boundary.segments[ item.second - boundary.points.size() ] ) );
+    }
+
+    const Primitive& primitive;
+    const SFCGAL::detail::GeometrySetBoundary2& boundary;
+};
+
+//
+// Squared distance between a segment and a segment of the tree
+struct SegmentSquaredDistance {
+    SegmentSquaredDistance( const Segment_2& segment_, const std::vector< Segment_2 >& segments_ ):
+        segment( segment_ ), segments( segments_ ) {}
+
+    double operator()( const std::pair< CGAL::Bbox_2, size_t >& item ) const {
+        return CGAL::to_double( CGAL::squared_distance( segment, segments[ item.second ] ) );
+    }
+
+    const Segment_2& segment;
+    const std::vector< Segment_2 >& segments;
+};
+
+//
+// Appends the non degenerated segments of a LineString (repeated points are skipped).
+// A LineString collapsed to a point gives a single degenerated segment so that it
+// still contributes to the distance.
+void collectSegments( const SFCGAL::LineString& lineString, std::vector< Segment_2 >& segments )
+{
+    const size_t numSegments = segments.size();
+
+    for ( size_t i = 0; i + 1 < lineString.numPoints(); i++ ) {
+        const Point_2 a = lineString.pointN( i ).toPoint_2();
+        const Point_2 b = lineString.pointN( i + 1 ).toPoint_2();
+
+        if ( a != b ) {
+            segments.push_back( Segment_2( a, b ) );
+        }
+    }
+
+    if ( segments.size() == numSegments && ! lineString.isEmpty() ) {
+        const Point_2 a = lineString.startPoint().toPoint_2();
+        segments.push_back( Segment_2( a, a ) );
+    }
+}
+
+//
+// Appends the segments of the rings of a Polygon
+void collectSegments( const SFCGAL::Polygon& polygon, std::vector< Segment_2 >& segments )
+{
+    for ( size_t i = 0; i < polygon.numRings(); i++ ) {
+        collectSegments( polygon.ringN( i ), segments );
+    }
+}
+
+//
+// under this number of segment pairs, all the pairs are tested
+const size_t BRUTE_FORCE_SEGMENT_PAIRS = 64 ;
+
+//
+// Minimum distance between two sets of segments.
+//
+// The segments of the largest set are packed in a static R-tree, the tree is then searched
+// for each segment of the smallest set with a branch and bound on the distance between the
+// boxes (double precision lower bounds), so that exact distances are only computed for the
+// segments that may improve the current minimum.
+double distanceSegments( const std::vector< Segment_2 >& a, const std::vector< Segment_2 >& b )
+{
+    if ( a.empty() || b.empty() ) {
+        return std::numeric_limits< double >::infinity() ;
+    }
+
+    double dMin = std::numeric_limits< double >::infinity() ;
+
+    if ( a.size() * b.size() <= BRUTE_FORCE_SEGMENT_PAIRS ) {
+        for ( size_t i = 0; i < a.size(); i++ ) {
+            for ( size_t j = 0; j < b.size(); j++ ) {
+                dMin = std::min( dMin, CGAL::to_double( CGAL::squared_distance( a[i], b[j] ) ) );
+            }
+        }
+
+        return std::sqrt( dMin );
+    }
+
+    const std::vector< Segment_2 >& indexed = a.size() < b.size() ? b : a ;
+    const std::vector< Segment_2 >& queries = a.size() < b.size() ? a : b ;
+
+    SFCGAL::detail::StrTree< CGAL::Bbox_2, size_t > tree ;
+
+    for ( size_t i = 0; i < indexed.size(); i++ ) {
+        tree.insert( indexed[i].bbox(), i );
+    }
+
+    tree.build();
+
+    for ( size_t i = 0; i < queries.size() && dMin > 0.0; i++ ) {
+        dMin = tree.minimum(
+                   BoxSquaredDistance( queries[i].bbox() ),
+                   SegmentSquaredDistance( queries[i], indexed ),
+                   dMin
+               );
+    }
+
+    return std::sqrt( dMin );
+}
+
+}
+
+///
+///
+///
+double distance( const PreparedGeometry& gA, const Geometry& gB )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gB );
+
+    if ( gA.geometry().geometryTypeId() == TYPE_SOLID || gB.geometryTypeId() == TYPE_SOLID ) {
+        BOOST_THROW_EXCEPTION( NotImplementedException(
+                                   ( boost::format( "distance(%s,%s) is not implemented" ) % gA.geometry().geometryType() % gB.geometryType() ).str()
+                               ) );
+    }
+
+    if ( gA.geometry().isEmpty() || gB.isEmpty() ) {
+        return std::numeric_limits< double >::infinity() ;
+    }
+
+    return distance( gA.indexedGeometrySet2D(), detail::GeometrySet<2>( gB ) );
+}
+
+///
+///
+///
+double distance( const detail::IndexedGeometrySet<2>& a, const detail::GeometrySet<2>& b )
+{
+    if ( intersects( a, b ) ) {
+        return 0.0;
+    }
+
+    // no intersection, the distance is reached between boundaries
+    const detail::GeometrySetBoundary2& aBoundary = a.boundary();
+    const detail::IndexedGeometrySet<2>::BoundaryTree& tree = a.boundaryTree();
+
+    detail::GeometrySetBoundary2 bBoundary;
+    bBoundary.collect( b );
+
+    double dMin = std::numeric_limits< double >::infinity() ;
+
+    for ( size_t i = 0; i < bBoundary.points.size(); i++ ) {
+        const Point_2& p = bBoundary.points[i];
+        dMin = tree.minimum( BoxSquaredDistance( p.bbox() ), BoundarySquaredDistance< Point_2 >( p, aBoundary ), dMin );
+    }
+
+    for ( size_t i = 0; i < bBoundary.segments.size(); i++ ) {
+        const Segment_2& s = bBoundary.segments[i];
+        dMin = tree.minimum( BoxSquaredDistance( s.bbox() ), BoundarySquaredDistance< Segment_2 >( s, aBoundary ), dMin );
+    }
+
+    return std::sqrt( dMin );
+}
+
+namespace {
+
+//
+// Visitor of a boundary tree, stops on the first boundary element within the distance of a primitive
+template < typename Primitive >
+struct BoundaryWithinVisitor {
+    BoundaryWithinVisitor( const Primitive& primitive_, const SFCGAL::detail::GeometrySetBoundary2& boundary_, const Kernel::FT& squaredDistance_ ):
+        primitive( primitive_ ), boundary( boundary_ ), squaredDistance( squaredDistance_ ) {}
+
+    bool operator()( const std::pair< CGAL::Bbox_2, size_t >& item ) const {
+        if ( item.second < boundary.points.size() ) {
+            return CGAL::squared_distance( primitive, boundary.points[ item.second ] ) > squaredDistance ;
+        }
+
+        return CGAL::squared_distance( primitive, boundary.segments[ item.second - boundary.points.size() ] ) > squaredDistance ;
+    }
+
+    const Primitive& primitive;
+    const SFCGAL::detail::GeometrySetBoundary2& boundary;
+    const Kernel::FT& squaredDistance;
+};
+
+//
+// Tests if the segments of a LineString are within the distance of a point
+bool dwithinPointLineString( const Point_2& p, const LineString& lineString, const Kernel::FT& squaredDistance )
+{
+    for ( size_t i = 0; i + 1 < lineString.numPoints(); i++ ) {
+        const Segment_2 segment( lineString.pointN( i ).toPoint_2(), lineString.pointN( i + 1 ).toPoint_2() );
+
+        if ( CGAL::squared_distance( p, segment ) <= squaredDistance ) {
+            return true ;
+        }
+    }
+
+    return false ;
+}
+
+}
+
+///
+///
+///
+bool dwithin( const Geometry& gA, const Geometry& gB, double distance )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gA );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gB );
+    return dwithin( gA, gB, distance, NoValidityCheck() );
+}
+
+///
+///
+///
+bool dwithin( const Geometry& gA, const Geometry& gB, double distance, NoValidityCheck )
+{
+    if ( gA.geometryTypeId() == TYPE_SOLID || gB.geometryTypeId() == TYPE_SOLID ) {
+        BOOST_THROW_EXCEPTION( NotImplementedException(
+                                   ( boost::format( "dwithin(%s,%s) is not implemented" ) % gA.geometryType() % gB.geometryType() ).str()
+                               ) );
+    }
+
+    if ( distance < 0.0 || gA.isEmpty() || gB.isEmpty() ) {
+        return false ;
+    }
+
+    // envelopes farther than the distance
+    if ( ! CGAL::do_overlap( detail::expand( gA.envelope().toBbox_2(), distance ), gB.envelope().toBbox_2() ) ) {
+        return false ;
+    }
+
+    const Kernel::FT squaredDistance = Kernel::FT( distance ) * Kernel::FT( distance );
+
+    // points and linestrings are tested without decomposition
+    if ( gA.geometryTypeId() == TYPE_POINT && gB.geometryTypeId() == TYPE_POINT ) {
+        return CGAL::squared_distance( gA.as< Point >().toPoint_2(), gB.as< Point >().toPoint_2() ) <= squaredDistance ;
+    }
+
+    if ( gA.geometryTypeId() == TYPE_POINT && gB.geometryTypeId() == TYPE_LINESTRING ) {
+        return dwithinPointLineString( gA.as< Point >().toPoint_2(), gB.as< LineString >(), squaredDistance );
+    }
+
+    if ( gA.geometryTypeId() == TYPE_LINESTRING && gB.geometryTypeId() == TYPE_POINT ) {
+        return dwithinPointLineString( gB.as< Point >().toPoint_2(), gA.as< LineString >(), squaredDistance );
+    }
+
+    return dwithin( detail::IndexedGeometrySet<2>( gA ), detail::GeometrySet<2>( gB ), distance );
+}
+
+///
+///
+///
+bool dwithin( const PreparedGeometry& gA, const Geometry& gB, double distance )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gB );
+
+    if ( gA.geometry().geometryTypeId() == TYPE_SOLID || gB.geometryTypeId() == TYPE_SOLID ) {
+        BOOST_THROW_EXCEPTION( NotImplementedException(
+                                   ( boost::format( "dwithin(%s,%s) is not implemented" ) % gA.geometry().geometryType() % gB.geometryType() ).str()
+                               ) );
+    }
+
+    if ( distance < 0.0 || gA.geometry().isEmpty() || gB.isEmpty() ) {
+        return false ;
+    }
+
+    if ( ! CGAL::do_overlap( detail::expand( gA.envelope().toBbox_2(), distance ), gB.envelope().toBbox_2() ) ) {
+        return false ;
+    }
+
+    return dwithin( gA.indexedGeometrySet2D(), detail::GeometrySet<2>( gB ), distance );
+}
+
+///
+///
+///
+bool dwithin( const detail::IndexedGeometrySet<2>& a, const detail::GeometrySet<2>& b, double distance )
+{
+    if ( distance < 0.0 ) {
+        return false ;
+    }
+
+    const Kernel::FT squaredDistance = Kernel::FT( distance ) * Kernel::FT( distance );
+
+    const detail::GeometrySetBoundary2& aBoundary = a.boundary();
+    const detail::IndexedGeometrySet<2>::BoundaryTree& tree = a.boundaryTree();
+
+    detail::GeometrySetBoundary2 bBoundary;
+    bBoundary.collect( b );
+
+    // only the boundary elements of a whose box is within the distance are tested,
+    // the search stops on the first one
+    for ( size_t i = 0; i < bBoundary.points.size(); i++ ) {
+        const Point_2& p = bBoundary.points[i];
+        BoundaryWithinVisitor< Point_2 > visitor( p, aBoundary, squaredDistance );
+
+        if ( ! tree.query( detail::expand( p.bbox(), distance ), visitor ) ) {
+            return true ;
+        }
+    }
+
+    for ( size_t i = 0; i < bBoundary.segments.size(); i++ ) {
+        const Segment_2& s = bBoundary.segments[i];
+        BoundaryWithinVisitor< Segment_2 > visitor( s, aBoundary, squaredDistance );
+
+        if ( ! tree.query( detail::expand( s.bbox(), distance ), visitor ) ) {
+            return true ;
+        }
+    }
+
+    // the boundaries are farther than the distance, a and b are within the distance
+    // only if one is inside the other
+    return intersects( a, b );
+}
+
 ///
 ///
 ///
@@ -263,24 +621,12 @@ double distanceLineStringLineString( const LineString& gA, const LineString& gB
         return std::numeric_limits< double >::infinity() ;
     }
 
-    size_t nsA = gA.numSegments() ;
-    size_t nsB = gB.numSegments() ;
-
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < nsA; i++ ) {
-        for ( size_t j = 0; j < nsB; j++ ) {
-            dMin = std::min(
-                       dMin,
-                       distanceSegmentSegment(
-                           gA.pointN( i ), gA.pointN( i+1 ),
-                           gB.pointN( j ), gB.pointN( j+1 )
-                       )
-                   ) ;
-        }
-    }
+    std::vector< Segment_2 > segmentsA;
+    std::vector< Segment_2 > segmentsB;
+    collectSegments( gA, segmentsA );
+    collectSegments( gB, segmentsB );
 
-    return dMin ;
+    return distanceSegments( segmentsA, segmentsB );
 }
 
 
@@ -297,17 +643,13 @@ double distanceLineStringPolygon( const LineString& gA, const Polygon& gB )
         return 0.0 ;
     }
 
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < gB.numRings(); i++ ) {
-        double d = distanceLineStringLineString( gA, gB.ringN( i ) );
-
-        if ( d < dMin ) {
-            dMin = d ;
-        }
-    }
+    // no intersection, the distance is reached between the linestring and a ring
+    std::vector< Segment_2 > segmentsA;
+    std::vector< Segment_2 > segmentsB;
+    collectSegments( gA, segmentsA );
+    collectSegments( gB, segmentsB );
 
-    return dMin ;
+    return distanceSegments( segmentsA, segmentsB );
 }
 
 
@@ -378,19 +720,13 @@ double distancePolygonPolygon( const Polygon& gA, const Polygon& gB )
         return 0.0 ;
     }
 
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < gA.numRings(); i++ ) {
-        for ( size_t j = 0; j < gB.numRings(); j++ ) {
-            double d = distanceLineStringLineString( gA.ringN( i ), gB.ringN( j ) );
-
-            if ( d < dMin ) {
-                dMin = d ;
-            }
-        }
-    }
+    // no intersection, the distance is reached between rings
+    std::vector< Segment_2 > segmentsA;
+    std::vector< Segment_2 > segmentsB;
+    collectSegments( gA, segmentsA );
+    collectSegments( gB, segmentsB );
 
-    return dMin ;
+    return distanceSegments( segmentsA, segmentsB );
 }
 
 ///
@@ -409,77 +745,32 @@ double distanceTriangleGeometry( const Triangle& gA, const Geometry& gB )
     return distancePolygonGeometry( gA.toPolygon(), gB );
 }
 
-struct Circle {
-    Circle( const double& r, CGAL::Vector_2<Kernel>& c )
-        : _radius( r )
-        , _center( c )
-        , _empty( false ) {
-    }
-    Circle()
-        : _empty( true ) {
-    }
-    bool isEmpty() const {
-        return _empty;
-    }
-    double radius() const {
-        BOOST_ASSERT( !_empty );
-        return _radius;
-    }
-    const CGAL::Vector_2<Kernel>& center() const {
-        BOOST_ASSERT( !_empty );
-        return _center;
-    }
-private:
-    double _radius;
-    CGAL::Vector_2<Kernel> _center;
-    bool _empty;
-};
+namespace {
 
-const Circle boundingCircle( const Geometry& geom )
-{
-    if ( geom.isEmpty() ) {
-        return Circle();
-    }
+//
+// Visitor of the tree of the members of a collection, by increasing distance of the member boxes
+// to the box of gB. The box distance is a lower bound of the distance of the member, the traversal
+// stops once it exceeds the best distance found so far.
+struct MemberDistanceVisitor {
+    MemberDistanceVisitor( const Geometry& gA_, const Geometry& gB_ ):
+        gA( gA_ ), gB( gB_ ), boxB( gB_.envelope().toBbox_2() ),
+        dMin( std::numeric_limits< double >::infinity() ) {}
 
-    using namespace SFCGAL::detail;
-    GetPointsVisitor v;
-    const_cast< Geometry& >( geom ).accept( v );
-
-    if( !v.points.size() ) {
-        return Circle();
-    }
-
-    typedef CGAL::Vector_2< Kernel > Vector_2 ;
-
-    const GetPointsVisitor::const_iterator end = v.points.end();
-
-    // centroid
-    Vector_2 c( 0,0 );
-    int numPoint = 0;
+    bool operator()( const std::pair< CGAL::Bbox_2, size_t >& item ) {
+        if ( SFCGAL::detail::squaredDistance( boxB, item.first ) > dMin * dMin ) {
+            return false ;
+        }
 
-    for ( GetPointsVisitor::const_iterator x = v.points.begin(); x != end; ++x ) {
-        c = c + ( *x )->toVector_2() ;
-        ++numPoint;
+        dMin = std::min( dMin, distance( gA.geometryN( item.second ), gB ) );
+        return dMin > 0.0 ;
     }
 
-    BOOST_ASSERT( numPoint );
-    c = c / numPoint;
-
-    // farest point from centroid
-    Vector_2 f = c ;
-    Kernel::FT maxDistanceSq = 0;
-
-    for ( GetPointsVisitor::const_iterator x = v.points.begin(); x != end; ++x ) {
-        const Vector_2 cx = ( *x )->toVector_2() - c ;
-        const Kernel::FT dSq = cx * cx ;
-
-        if ( dSq > maxDistanceSq ) {
-            f = ( *x )->toVector_2() ;
-            maxDistanceSq = dSq ;
-        }
-    }
+    const Geometry& gA;
+    const Geometry& gB;
+    CGAL::Bbox_2 boxB;
+    double dMin;
+};
 
-    return Circle( std::sqrt( CGAL::to_double( maxDistanceSq ) ), c );
 }
 
 ///
@@ -491,71 +782,21 @@ double distanceGeometryCollectionToGeometry( const Geometry& gA, const Geometry&
         return std::numeric_limits< double >::infinity() ;
     }
 
-    // if bounding spheres (BS) of gB and gAi don't intersect and
-    // if the closest point of BS(gAj) is further than the farest
-    // point of BS(gAi) there is no need to compute the distance(gAj, gB)
-    // since it will be greater than distance(gAi, gB)
-    //
-    // The aim is not to find the minimal bounding sphere, but a good enough sphere than
-    // encloses all points
-    std::set<size_t> noTest;
-
-    if ( 1 ) {
-        std::vector<Circle> bcA;
-
-        for ( size_t i = 0; i < gA.numGeometries(); i++ ) {
-            bcA.push_back( boundingCircle( gA.geometryN( i ) ) );
-        }
-
-        Circle bcB( boundingCircle( gB ) );
-
-        if ( bcB.isEmpty() ) {
-            return  std::numeric_limits< double >::infinity() ;
-        }
-
-        std::vector<size_t> noIntersect;
-
-        for ( size_t i = 0; i < gA.numGeometries(); i++ ) {
-            if ( bcA[i].isEmpty() ) {
-                continue;
-            }
-
-            const double l2 = CGAL::to_double( ( bcB.center() - bcA[i].center() ).squared_length() );
-
-            if ( std::pow( bcB.radius() + bcA[i].radius(), 2 ) < l2 ) {
-                noIntersect.push_back( i );
-            }
-        }
-
-        for ( size_t i = 0; i < noIntersect.size(); i++ ) {
-            const double li = std::sqrt( CGAL::to_double( ( bcA[noIntersect[i]].center() - bcB.center() ).squared_length() ) );
-
-            for ( size_t j = i; j < noIntersect.size(); j++ ) {
-                const double lj = std::sqrt( CGAL::to_double( ( bcA[noIntersect[j]].center() - bcB.center() ).squared_length() ) );
-
-                if ( li + bcA[noIntersect[i]].radius() < lj - bcA[noIntersect[j]].radius()  ) {
-                    noTest.insert( noIntersect[j] );
-                }
-                else if ( lj + bcA[noIntersect[j]].radius() < li - bcA[noIntersect[i]].radius()  ) {
-                    noTest.insert( noIntersect[i] );
-                }
-            }
-        }
-
-        //if (!noTest.empty()) std::cout << "pruning " << noTest.size() << "/" << gA.numGeometries() << "\n";
-    }
-
-    double dMin = std::numeric_limits< double >::infinity() ;
+    // branch and bound on the boxes of the members : the members are visited by
+    // increasing box distance to gB, until this lower bound exceeds the best distance
+    detail::StrTree< CGAL::Bbox_2, size_t > tree ;
 
     for ( size_t i = 0; i < gA.numGeometries(); i++ ) {
-        if ( noTest.end() != noTest.find( i ) ) {
-            continue;
+        if ( ! gA.geometryN( i ).isEmpty() ) {
+            tree.insert( gA.geometryN( i ).envelope().toBbox_2(), i );
         }
-
-        dMin = std::min( dMin, distance( gA.geometryN( i ), gB ) );
     }
 
-    return dMin ;
+    tree.build();
+
+    MemberDistanceVisitor visitor( gA, gB );
+    tree.nearest( BoxSquaredDistance( visitor.boxB ), visitor );
+    return visitor.dMin ;
 }
 
 
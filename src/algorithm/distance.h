@@ -27,8 +27,15 @@
 
 
 namespace SFCGAL {
+class PreparedGeometry;
+namespace detail {
+template <int Dim> class GeometrySet;
+template <int Dim> class IndexedGeometrySet;
+}
+
 namespace algorithm {
 struct NoValidityCheck;
+struct FastMode;
 
 /**
  * Compute the distance between two Geometries
@@ -47,6 +54,68 @@ SFCGAL_API double distance( const Geometry& gA, const Geometry& gB ) ;
  */
 SFCGAL_API double distance( const Geometry& gA, const Geometry& gB, NoValidityCheck ) ;
 
+/**
+ * Compute the distance between two Geometries in double precision
+ * @ingroup public_api
+ * @pre gA is a valid geometry (not checked, see FastMode)
+ * @pre gB is a valid geometry (not checked, see FastMode)
+ * @see FastMode for the robustness contract
+ */
+SFCGAL_API double distance( const Geometry& gA, const Geometry& gB, FastMode ) ;
+
+/**
+ * Compute the distance between two Geometries, reusing the decomposition and the box trees
+ * of a prepared geometry
+ * @ingroup public_api
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API double distance( const PreparedGeometry& gA, const Geometry& gB ) ;
+
+/**
+ * Compute the distance between an indexed decomposition and a decomposition, searching
+ * the closest boundary elements of a with its boundary tree
+ * @ingroup detail
+ * @pre a and b are not empty
+ */
+SFCGAL_API double distance( const detail::IndexedGeometrySet<2>& a, const detail::GeometrySet<2>& b ) ;
+
+/**
+ * Tests if the distance between two Geometries is lower than or equal to a given distance.
+ * The test is rejected on the envelopes and stops at the first pair of elements within the distance,
+ * the exact distance is never computed.
+ * @ingroup public_api
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API bool dwithin( const Geometry& gA, const Geometry& gB, double distance ) ;
+
+/**
+ * Tests if the distance between two Geometries is lower than or equal to a given distance
+ * @ingroup detail
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ * @warning No actual validity check is done
+ */
+SFCGAL_API bool dwithin( const Geometry& gA, const Geometry& gB, double distance, NoValidityCheck ) ;
+
+/**
+ * Tests if the distance between two Geometries is lower than or equal to a given distance,
+ * reusing the envelope, the decomposition and the box trees of a prepared geometry
+ * @ingroup public_api
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API bool dwithin( const PreparedGeometry& gA, const Geometry& gB, double distance ) ;
+
+/**
+ * Tests if the distance between an indexed decomposition and a decomposition is lower than
+ * or equal to a given distance, searching the boundary tree of a within the distance of each
+ * boundary element of b
+ * @ingroup detail
+ */
+SFCGAL_API bool dwithin( const detail::IndexedGeometrySet<2>& a, const detail::GeometrySet<2>& b, double distance ) ;
+
 /**
  * dispatch distance from Point to Geometry
  * @ingroup detail
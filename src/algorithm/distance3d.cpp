@@ -39,6 +39,8 @@
 #include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/triangulate/triangulatePolygon.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
+#include <SFCGAL/detail/PrimitiveTree3.h>
+#include <SFCGAL/PreparedGeometry.h>
 
 
 typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel ;
@@ -216,13 +218,8 @@ double distancePointSolid3D( const Point& gA, const Solid& gB )
         return 0.0 ;
     }
 
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < gB.numShells(); i++ ) {
-        dMin = std::min( dMin, distanceGeometryCollectionToGeometry3D( gB.shellN( i ), gA ) );
-    }
-
-    return dMin ;
+    // closest point query on the triangles of the shells
+    return distance3D( detail::PrimitiveTree3( gB ), gA );
 }
 
 
@@ -345,13 +342,7 @@ double distanceLineStringSolid3D( const LineString& gA, const Solid& gB )
         return 0.0 ;
     }
 
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < gB.numShells(); i++ ) {
-        dMin = std::min( dMin, gB.shellN( i ).distance3D( gA ) );
-    }
-
-    return dMin ;
+    return distance3D( detail::PrimitiveTree3( gA ), detail::PrimitiveTree3( gB ) );
 }
 
 
@@ -406,13 +397,7 @@ double distanceTriangleSolid3D( const Triangle& gA, const Solid& gB )
         return 0.0 ;
     }
 
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < gB.numShells(); i++ ) {
-        dMin = std::min( dMin, gB.shellN( i ).distance3D( gA ) );
-    }
-
-    return dMin ;
+    return distance3D( detail::PrimitiveTree3( gA ), detail::PrimitiveTree3( gB ) );
 }
 
 
@@ -487,88 +472,8 @@ double distanceSolidSolid3D( const Solid& gA, const Solid& gB )
         return 0.0 ;
     }
 
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < gA.numShells(); i++ ) {
-        for ( size_t j = 0; j < gB.numShells(); j++ ) {
-            dMin = std::min( dMin, gA.shellN( i ).distance3D( gB.shellN( j ) ) );
-        }
-    }
-
-    return dMin ;
-}
-
-struct Sphere {
-    Sphere( const double& r, CGAL::Vector_3<Kernel>& c )
-        : _radius( r )
-        , _center( c )
-        , _empty( false ) {
-    }
-    Sphere()
-        : _empty( true ) {
-    }
-    bool isEmpty() const {
-        return _empty;
-    }
-    double radius() const {
-        BOOST_ASSERT( !_empty );
-        return _radius;
-    }
-    const CGAL::Vector_3<Kernel>& center() const {
-        BOOST_ASSERT( !_empty );
-        return _center;
-    }
-private:
-    double _radius;
-    CGAL::Vector_3<Kernel> _center;
-    bool _empty;
-};
-
-const Sphere boundingSphere( const Geometry& geom )
-{
-    if ( geom.isEmpty() ) {
-        return Sphere();
-    }
-
-    using namespace SFCGAL::detail;
-    GetPointsVisitor v;
-    const_cast< Geometry& >( geom ).accept( v );
-
-    if( !v.points.size() ) {
-        return Sphere();
-    }
-
-    typedef CGAL::Vector_3< Kernel > Vector_3 ;
-
-    const GetPointsVisitor::const_iterator end = v.points.end();
-
-    // centroid
-    Vector_3 c( 0,0,0 );
-    int numPoint = 0;
-
-    for ( GetPointsVisitor::const_iterator x = v.points.begin(); x != end; ++x ) {
-        c = c + ( *x )->toVector_3() ;
-        ++numPoint;
-    }
-
-    BOOST_ASSERT( numPoint );
-    c = c / numPoint;
-
-    // farest point from centroid
-    Vector_3 f = c ;
-    Kernel::FT maxDistanceSq = 0;
-
-    for ( GetPointsVisitor::const_iterator x = v.points.begin(); x != end; ++x ) {
-        const Vector_3 cx = ( *x )->toVector_3() - c ;
-        const Kernel::FT dSq = cx * cx ;
-
-        if ( dSq > maxDistanceSq ) {
-            f = ( *x )->toVector_3() ;
-            maxDistanceSq = dSq ;
-        }
-    }
-
-    return Sphere( std::sqrt( CGAL::to_double( maxDistanceSq ) ), c );
+    // no intersection, the distance is reached between the shells
+    return distance3D( detail::PrimitiveTree3( gA ), detail::PrimitiveTree3( gB ) );
 }
 
 ///
@@ -582,72 +487,15 @@ double distanceGeometryCollectionToGeometry3D( const Geometry& gA, const Geometr
         return std::numeric_limits< double >::infinity() ;
     }
 
+    const detail::PrimitiveTree3 treeA( gA );
+    const detail::PrimitiveTree3 treeB( gB );
 
-    // if bounding spheres (BS) of gB and gAi don't intersect and
-    // if the closest point of BS(gAj) is further than the farest
-    // point of BS(gAi) there is no need to compute the distance(gAj, gB)
-    // since it will be greater than distance(gAi, gB)
-    //
-    // The aim is not to find the minimal bounding sphere, but a good enough sphere than
-    // encloses all points
-    std::set<size_t> noTest;
-
-    if ( 1 ) {
-        std::vector<Sphere> bsA;
-
-        for ( size_t i = 0; i < gA.numGeometries(); i++ ) {
-            bsA.push_back( boundingSphere( gA.geometryN( i ) ) );
-        }
-
-        Sphere bsB( boundingSphere( gB ) );
-
-        if ( bsB.isEmpty() ) {
-            return  std::numeric_limits< double >::infinity() ;
-        }
-
-        std::vector<size_t> noIntersect;
-
-        for ( size_t i = 0; i < gA.numGeometries(); i++ ) {
-            if ( bsA[i].isEmpty() ) {
-                continue;
-            }
-
-            const double l2 = CGAL::to_double( ( bsB.center() - bsA[i].center() ).squared_length() );
-
-            if ( std::pow( bsB.radius() + bsA[i].radius(), 2 ) < l2 ) {
-                noIntersect.push_back( i );
-            }
-        }
-
-        for ( size_t i = 0; i < noIntersect.size(); i++ ) {
-            const double li = std::sqrt( CGAL::to_double( ( bsA[noIntersect[i]].center() - bsB.center() ).squared_length() ) );
-
-            for ( size_t j = i; j < noIntersect.size(); j++ ) {
-                const double lj = std::sqrt( CGAL::to_double( ( bsA[noIntersect[j]].center() - bsB.center() ).squared_length() ) );
-
-                if ( li + bsA[noIntersect[i]].radius() < lj - bsA[noIntersect[j]].radius()  ) {
-                    noTest.insert( noIntersect[j] );
-                }
-                else if ( lj + bsA[noIntersect[j]].radius() < li - bsA[noIntersect[i]].radius()  ) {
-                    noTest.insert( noIntersect[i] );
-                }
-            }
-        }
-
-        //if (!noTest.empty()) std::cout << "pruning " << noTest.size() << "/" << gA.numGeometries() << "\n";
-    }
-
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < gA.numGeometries(); i++ ) {
-        if ( noTest.end() != noTest.find( i ) ) {
-            continue;
-        }
-
-        dMin = std::min( dMin, distance3D( gA.geometryN( i ), gB ) );
+    // the primitives only bound the solids, a geometry inside a solid is at distance 0
+    if ( ( treeA.hasVolume() || treeB.hasVolume() ) && intersects3D( gA, gB, NoValidityCheck() ) ) {
+        return 0.0 ;
     }
 
-    return dMin ;
+    return distance3D( treeA, treeB );
 }
 
 
@@ -875,5 +723,278 @@ double distanceTriangleTriangle3D( const Triangle& gA, const Triangle& gB )
 
 
 
+namespace {
+
+//
+// squared distance between a point and the i-th primitive of a tree
+squared_distance_t squaredDistancePointPrimitive3D( const Point_3& p, const detail::PrimitiveTree3& tree, size_t i )
+{
+    const size_t np = tree.points().size();
+    const size_t ns = tree.segments().size();
+
+    if ( i < np ) {
+        return CGAL::squared_distance( p, tree.points()[i] );
+    }
+
+    if ( i < np + ns ) {
+        return CGAL::squared_distance( p, tree.segments()[ i - np ] );
+    }
+
+    return squaredDistancePointTriangle3D( p, tree.triangles()[ i - np - ns ] );
+}
+
+//
+// squared distance between the i-th primitive of a and the j-th primitive of b
+squared_distance_t squaredDistancePrimitives3D(
+    const detail::PrimitiveTree3& a, size_t i,
+    const detail::PrimitiveTree3& b, size_t j
+)
+{
+    const size_t np = a.points().size();
+    const size_t ns = a.segments().size();
+
+    if ( i < np ) {
+        return squaredDistancePointPrimitive3D( a.points()[i], b, j );
+    }
+
+    if ( i < np + ns ) {
+        const Segment_3& segment = a.segments()[ i - np ];
+        const size_t mp = b.points().size();
+        const size_t ms = b.segments().size();
+
+        if ( j < mp ) {
+            return CGAL::squared_distance( b.points()[j], segment );
+        }
+
+        if ( j < mp + ms ) {
+            return CGAL::squared_distance( segment, b.segments()[ j - mp ] );
+        }
+
+        return squaredDistanceSegmentTriangle3D( segment, b.triangles()[ j - mp - ms ] );
+    }
+
+    const Triangle_3& triangle = a.triangles()[ i - np - ns ];
+    const size_t mp = b.points().size();
+    const size_t ms = b.segments().size();
+
+    if ( j < mp ) {
+        return squaredDistancePointTriangle3D( b.points()[j], triangle );
+    }
+
+    if ( j < mp + ms ) {
+        return squaredDistanceSegmentTriangle3D( b.segments()[ j - mp ], triangle );
+    }
+
+    return squaredDistanceTriangleTriangle3D( triangle, b.triangles()[ j - mp - ms ] );
+}
+
+//
+// Lower bound of the squared distance between the primitives of two boxes
+struct BoxSquaredDistance3 {
+    double operator()( const CGAL::Bbox_3& a, const CGAL::Bbox_3& b ) const {
+        return detail::squaredDistance( a, b );
+    }
+};
+
+//
+// Lower bound of the squared distance between a point and the primitives of a box
+struct PointBoxSquaredDistance3 {
+    PointBoxSquaredDistance3( const CGAL::Bbox_3& box_ ): box( box_ ) {}
+
+    double operator()( const CGAL::Bbox_3& other ) const {
+        return detail::squaredDistance( box, other );
+    }
+
+    CGAL::Bbox_3 box;
+};
+
+//
+// Squared distance between the primitives of two trees
+struct PrimitiveSquaredDistance3 {
+    PrimitiveSquaredDistance3( const detail::PrimitiveTree3& a_, const detail::PrimitiveTree3& b_ ):
+        a( a_ ), b( b_ ) {}
+
+    double operator()( const detail::PrimitiveTree3::Tree::Item& itemA, const detail::PrimitiveTree3::Tree::Item& itemB ) const {
+        return CGAL::to_double( squaredDistancePrimitives3D( a, itemA.second, b, itemB.second ) );
+    }
+
+    const detail::PrimitiveTree3& a;
+    const detail::PrimitiveTree3& b;
+};
+
+//
+// Squared distance between a point and the primitives of a tree
+struct PointPrimitiveSquaredDistance3 {
+    PointPrimitiveSquaredDistance3( const Point_3& point_, const detail::PrimitiveTree3& tree_ ):
+        point( point_ ), tree( tree_ ) {}
+
+    double operator()( const detail::PrimitiveTree3::Tree::Item& item ) const {
+        return CGAL::to_double( squaredDistancePointPrimitive3D( point, tree, item.second ) );
+    }
+
+    const Point_3& point;
+    const detail::PrimitiveTree3& tree;
+};
+
+//
+// Visitor of a tree, stops on the first primitive within the distance of the i-th primitive of another tree
+struct PrimitiveWithinVisitor {
+    PrimitiveWithinVisitor( const detail::PrimitiveTree3& query_, size_t i_, const detail::PrimitiveTree3& tree_, const squared_distance_t& squaredDistance_ ):
+        query( query_ ), i( i_ ), tree( tree_ ), squaredDistance( squaredDistance_ ) {}
+
+    bool operator()( const detail::PrimitiveTree3::Tree::Item& item ) const {
+        return squaredDistancePrimitives3D( query, i, tree, item.second ) > squaredDistance ;
+    }
+
+    const detail::PrimitiveTree3& query;
+    size_t i;
+    const detail::PrimitiveTree3& tree;
+    const squared_distance_t& squaredDistance;
+};
+
+}
+
+///
+///
+///
+double distance3D( const detail::PrimitiveTree3& a, const detail::PrimitiveTree3& b )
+{
+    if ( a.isEmpty() || b.isEmpty() ) {
+        return std::numeric_limits< double >::infinity() ;
+    }
+
+    return std::sqrt( a.tree().minimum( b.tree(), BoxSquaredDistance3(), PrimitiveSquaredDistance3( a, b ) ) );
+}
+
+///
+///
+///
+double distance3D( const detail::PrimitiveTree3& a, const Point& gB )
+{
+    if ( a.isEmpty() || gB.isEmpty() ) {
+        return std::numeric_limits< double >::infinity() ;
+    }
+
+    const Point_3 p = gB.toPoint_3();
+    return std::sqrt( a.tree().minimum( PointBoxSquaredDistance3( p.bbox() ), PointPrimitiveSquaredDistance3( p, a ) ) );
+}
+
+///
+///
+///
+double distance3D( const PreparedGeometry& gA, const Geometry& gB )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gB );
+
+    if ( gA.geometry().isEmpty() || gB.isEmpty() ) {
+        return std::numeric_limits< double >::infinity() ;
+    }
+
+    const detail::PrimitiveTree3& treeA = gA.primitiveTree3D();
+    const detail::PrimitiveTree3 treeB( gB );
+
+    // the primitives only bound the solids, a geometry inside a solid is at distance 0
+    if ( ( treeA.hasVolume() || treeB.hasVolume() ) && intersects3D( gA, gB ) ) {
+        return 0.0 ;
+    }
+
+    return distance3D( treeA, treeB );
+}
+
+///
+///
+///
+bool dwithin3D( const detail::PrimitiveTree3& a, const detail::PrimitiveTree3& b, double distance )
+{
+    if ( distance < 0.0 || a.isEmpty() || b.isEmpty() ) {
+        return false ;
+    }
+
+    const squared_distance_t squaredDistance = squared_distance_t( distance ) * squared_distance_t( distance );
+
+    // the primitives of the smallest tree are searched in the largest one, only the primitives
+    // whose box is within the distance are tested and the search stops on the first one
+    const detail::PrimitiveTree3& queries = a.tree().size() < b.tree().size() ? a : b ;
+    const detail::PrimitiveTree3& indexed = a.tree().size() < b.tree().size() ? b : a ;
+
+    const std::vector< detail::PrimitiveTree3::Tree::Item >& items = queries.tree().items();
+
+    for ( size_t i = 0; i < items.size(); i++ ) {
+        PrimitiveWithinVisitor visitor( queries, items[i].second, indexed, squaredDistance );
+
+        if ( ! indexed.tree().query( detail::expand( items[i].first, distance ), visitor ) ) {
+            return true ;
+        }
+    }
+
+    return false ;
+}
+
+///
+///
+///
+bool dwithin3D( const Geometry& gA, const Geometry& gB, double distance )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gA );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gB );
+
+    return dwithin3D( gA, gB, distance, NoValidityCheck() );
+}
+
+///
+///
+///
+bool dwithin3D( const Geometry& gA, const Geometry& gB, double distance, NoValidityCheck )
+{
+    if ( distance < 0.0 || gA.isEmpty() || gB.isEmpty() ) {
+        return false ;
+    }
+
+    // envelopes farther than the distance
+    if ( ! CGAL::do_overlap( detail::expand( gA.envelope().toBbox_3(), distance ), gB.envelope().toBbox_3() ) ) {
+        return false ;
+    }
+
+    if ( gA.geometryTypeId() == TYPE_POINT && gB.geometryTypeId() == TYPE_POINT ) {
+        return CGAL::squared_distance( gA.as< Point >().toPoint_3(), gB.as< Point >().toPoint_3() )
+               <= squared_distance_t( distance ) * squared_distance_t( distance );
+    }
+
+    const detail::PrimitiveTree3 treeA( gA );
+    const detail::PrimitiveTree3 treeB( gB );
+
+    if ( dwithin3D( treeA, treeB, distance ) ) {
+        return true ;
+    }
+
+    // the primitives only bound the solids, a geometry inside a solid is at distance 0
+    return ( treeA.hasVolume() || treeB.hasVolume() ) && intersects3D( gA, gB, NoValidityCheck() );
+}
+
+///
+///
+///
+bool dwithin3D( const PreparedGeometry& gA, const Geometry& gB, double distance )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gB );
+
+    if ( distance < 0.0 || gA.geometry().isEmpty() || gB.isEmpty() ) {
+        return false ;
+    }
+
+    if ( ! CGAL::do_overlap( detail::expand( gA.envelope().toBbox_3(), distance ), gB.envelope().toBbox_3() ) ) {
+        return false ;
+    }
+
+    const detail::PrimitiveTree3& treeA = gA.primitiveTree3D();
+    const detail::PrimitiveTree3 treeB( gB );
+
+    if ( dwithin3D( treeA, treeB, distance ) ) {
+        return true ;
+    }
+
+    return ( treeA.hasVolume() || treeB.hasVolume() ) && intersects3D( gA, gB );
+}
+
 }//namespace algorithm
 }//namespace SFCGAL
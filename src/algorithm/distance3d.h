@@ -26,6 +26,11 @@
 #include <SFCGAL/Geometry.h>
 
 namespace SFCGAL {
+class PreparedGeometry;
+namespace detail {
+class PrimitiveTree3;
+}
+
 namespace algorithm {
 struct NoValidityCheck;
 
@@ -48,6 +53,63 @@ SFCGAL_API double distance3D( const Geometry& gA, const Geometry& gB ) ;
  */
 SFCGAL_API double distance3D( const Geometry& gA, const Geometry& gB, NoValidityCheck ) ;
 
+/**
+ * Compute the 3D distance between two Geometries, reusing the primitive tree of a prepared geometry
+ * @ingroup public_api
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API double distance3D( const PreparedGeometry& gA, const Geometry& gB ) ;
+
+/**
+ * Minimum distance between the primitives of two trees, with a traversal of both trees
+ * @warning the interior of the solids is ignored
+ * @ingroup detail
+ */
+SFCGAL_API double distance3D( const detail::PrimitiveTree3& a, const detail::PrimitiveTree3& b ) ;
+
+/**
+ * Minimum distance between a point and the primitives of a tree
+ * @warning the interior of the solids is ignored
+ * @ingroup detail
+ */
+SFCGAL_API double distance3D( const detail::PrimitiveTree3& a, const Point& gB ) ;
+
+/**
+ * Tests if the 3D distance between two Geometries is lower than or equal to a given distance.
+ * The test is rejected on the envelopes and stops at the first pair of primitives within the distance,
+ * the exact distance is never computed.
+ * @ingroup public_api
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API bool dwithin3D( const Geometry& gA, const Geometry& gB, double distance ) ;
+
+/**
+ * Tests if the 3D distance between two Geometries is lower than or equal to a given distance
+ * @ingroup detail
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ * @warning No actual validity check is done
+ */
+SFCGAL_API bool dwithin3D( const Geometry& gA, const Geometry& gB, double distance, NoValidityCheck ) ;
+
+/**
+ * Tests if the 3D distance between two Geometries is lower than or equal to a given distance,
+ * reusing the envelope and the primitive tree of a prepared geometry
+ * @ingroup public_api
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API bool dwithin3D( const PreparedGeometry& gA, const Geometry& gB, double distance ) ;
+
+/**
+ * Tests if a primitive of a is within a given distance of a primitive of b
+ * @warning the interior of the solids is ignored
+ * @ingroup detail
+ */
+SFCGAL_API bool dwithin3D( const detail::PrimitiveTree3& a, const detail::PrimitiveTree3& b, double distance ) ;
+
 /**
  * dispatch distance from Point to Geometry
  * @ingroup detail
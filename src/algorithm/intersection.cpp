@@ -25,7 +25,11 @@
 #include <SFCGAL/algorithm/collectionHomogenize.h>
 #include <SFCGAL/detail/tools/Registry.h>
 #include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/IndexedGeometrySet.h>
+#include <SFCGAL/DecomposedGeometry.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/computationMode.h>
+#include <SFCGAL/detail/tools/ParallelFor.h>
 
 #include <CGAL/Boolean_set_operations_2.h>
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
@@ -86,6 +90,42 @@ struct intersection_cb {
     GeometrySet<Dim>& output;
 };
 
+//
+// Collects the candidate pairs of primitives
+template <int Dim>
+struct candidate_pairs_cb {
+    typedef std::vector< std::pair< const PrimitiveHandle<Dim>*, const PrimitiveHandle<Dim>* > > Pairs;
+
+    candidate_pairs_cb( Pairs& p ) : pairs( p ) {}
+
+    void operator()( const typename PrimitiveBox<Dim>::Type& a,
+                     const typename PrimitiveBox<Dim>::Type& b ) {
+        pairs.push_back( std::make_pair( a.handle(), b.handle() ) );
+    }
+
+    Pairs& pairs;
+};
+
+//
+// Intersections of a chunk of candidate pairs, each chunk has its own output
+template <int Dim>
+struct intersection_chunk_task {
+    intersection_chunk_task( const typename candidate_pairs_cb<Dim>::Pairs& p, size_t size, std::vector< GeometrySet<Dim> >& out ) :
+        pairs( p ), chunkSize( size ), outputs( out ) {}
+
+    void operator()( size_t chunk ) {
+        const size_t end = std::min( ( chunk + 1 ) * chunkSize, pairs.size() );
+
+        for ( size_t i = chunk * chunkSize; i < end; ++i ) {
+            dispatch_intersection_sym<Dim>( *pairs[i].first, *pairs[i].second, outputs[chunk] );
+        }
+    }
+
+    const typename candidate_pairs_cb<Dim>::Pairs& pairs;
+    size_t chunkSize;
+    std::vector< GeometrySet<Dim> >& outputs;
+};
+
 /**
  * intersection post processing
  */
@@ -138,10 +178,32 @@ void intersection( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b, Geometr
     b.computeBoundingBoxes( bhandles, bboxes );
 
     GeometrySet<Dim> temp, temp2;
-    intersection_cb<Dim> cb( temp );
-    CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
-                              bboxes.begin(), bboxes.end(),
-                              cb );
+
+    if ( numThreads() > 1 && ! tools::insideParallelFor() ) {
+        // candidate pairs are independent, they are processed by chunks on several threads
+        // and the outputs of the chunks are merged in the sequential order
+        typename candidate_pairs_cb<Dim>::Pairs pairs;
+        candidate_pairs_cb<Dim> cb( pairs );
+        CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
+                                  bboxes.begin(), bboxes.end(),
+                                  cb );
+
+        const size_t chunkSize = std::max( pairs.size() / ( 16 * numThreads() ), size_t( 1 ) );
+        const size_t numChunks = ( pairs.size() + chunkSize - 1 ) / chunkSize;
+        std::vector< GeometrySet<Dim> > outputs( numChunks );
+        intersection_chunk_task<Dim> task( pairs, chunkSize, outputs );
+        tools::parallelFor( numChunks, numThreads(), task );
+
+        for ( size_t i = 0; i < numChunks; ++i ) {
+            temp.merge( outputs[i] );
+        }
+    }
+    else {
+        intersection_cb<Dim> cb( temp );
+        CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
+                                  bboxes.begin(), bboxes.end(),
+                                  cb );
+    }
 
     post_intersection( temp, temp2 );
     output.merge( temp2 );
@@ -150,6 +212,52 @@ void intersection( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b, Geometr
 template void intersection<2>( const GeometrySet<2>& a, const GeometrySet<2>& b, GeometrySet<2>& );
 template void intersection<3>( const GeometrySet<3>& a, const GeometrySet<3>& b, GeometrySet<3>& );
 
+template <int Dim>
+struct intersection_tree_visitor {
+    intersection_tree_visitor( const PrimitiveHandle<Dim>& h, GeometrySet<Dim>& out ) : handle( h ), output( out ) {}
+
+    bool operator()( const typename IndexedGeometrySet<Dim>::Tree::Item& item ) {
+        dispatch_intersection_sym<Dim>( *item.second, handle, output );
+        return true;
+    }
+
+    const PrimitiveHandle<Dim>& handle;
+    GeometrySet<Dim>& output;
+};
+
+template <int Dim>
+void intersection( const IndexedGeometrySet<Dim>& a, const GeometrySet<Dim>& b, GeometrySet<Dim>& output )
+{
+    typename SFCGAL::detail::HandleCollection<Dim>::Type bhandles;
+    typename SFCGAL::detail::BoxCollection<Dim>::Type bboxes;
+    b.computeBoundingBoxes( bhandles, bboxes );
+
+    GeometrySet<Dim> temp, temp2;
+
+    for ( typename BoxCollection<Dim>::Type::const_iterator it = bboxes.begin(); it != bboxes.end(); ++it ) {
+        intersection_tree_visitor<Dim> visitor( *it->handle(), temp );
+        a.tree().query( primitiveBbox( *it ), visitor );
+    }
+
+    post_intersection( temp, temp2 );
+    output.merge( temp2 );
+}
+
+template void intersection<2>( const IndexedGeometrySet<2>& a, const GeometrySet<2>& b, GeometrySet<2>& );
+template void intersection<3>( const IndexedGeometrySet<3>& a, const GeometrySet<3>& b, GeometrySet<3>& );
+
+template <int Dim>
+DecomposedGeometry<Dim> intersection( const DecomposedGeometry<Dim>& a, const DecomposedGeometry<Dim>& b )
+{
+    GeometrySet<Dim> output, filtered;
+    algorithm::intersection( a.geometrySet(), b.geometrySet(), output );
+    output.filterCovered( filtered );
+    return DecomposedGeometry<Dim>( std::move( filtered ) );
+}
+
+template DecomposedGeometry<2> intersection<2>( const DecomposedGeometry<2>& a, const DecomposedGeometry<2>& b );
+template DecomposedGeometry<3> intersection<3>( const DecomposedGeometry<3>& a, const DecomposedGeometry<3>& b );
+
 std::unique_ptr<Geometry> intersection( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 {
     GeometrySet<2> gsa( ga ), gsb( gb ), output;
@@ -27,9 +27,11 @@
 
 namespace SFCGAL {
 class Geometry;
+template <int Dim> class DecomposedGeometry;
 namespace detail {
 template <int Dim> class GeometrySet;
 template <int Dim> struct PrimitiveHandle;
+template <int Dim> class IndexedGeometrySet;
 }
 
 namespace algorithm {
@@ -65,12 +67,27 @@ SFCGAL_API std::unique_ptr<Geometry> intersection3D( const Geometry& ga, const G
  */
 SFCGAL_API std::unique_ptr<Geometry> intersection3D( const Geometry& ga, const Geometry& gb, NoValidityCheck );
 
+/**
+ * Intersection of two decomposed geometries, the result is not recomposed
+ * (intersection3D for Dim = 3)
+ * @ingroup public_api
+ */
+template <int Dim>
+DecomposedGeometry<Dim> intersection( const DecomposedGeometry<Dim>& a, const DecomposedGeometry<Dim>& b );
+
 /**
  * @ingroup detail
  */
 template <int Dim>
 void intersection( const detail::GeometrySet<Dim>& a, const detail::GeometrySet<Dim>& b, detail::GeometrySet<Dim>& );
 
+/**
+ * Intersection of an indexed GeometrySet (candidate pairs found with its box tree) and a GeometrySet
+ * @ingroup detail
+ */
+template <int Dim>
+void intersection( const detail::IndexedGeometrySet<Dim>& a, const detail::GeometrySet<Dim>& b, detail::GeometrySet<Dim>& );
+
 /**
  * @ingroup detail
  */
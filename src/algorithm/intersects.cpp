@@ -20,6 +20,7 @@
 
 #include <map>
 #include <sstream>
+#include <vector>
 
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/algorithm/intersects.h>
@@ -27,16 +28,21 @@
 #include <SFCGAL/algorithm/connection.h>
 #include <SFCGAL/algorithm/covers.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/computationMode.h>
 #include <SFCGAL/detail/triangulate/triangulateInGeometrySet.h>
 #include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+#include <SFCGAL/detail/IndexedGeometrySet.h>
+#include <SFCGAL/detail/BoxIntersection.h>
+#include <SFCGAL/detail/algorithm/fastPredicates.h>
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/DecomposedGeometry.h>
 #include <SFCGAL/Envelope.h>
 #include <SFCGAL/Exception.h>
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/PolyhedralSurface.h>
 
-#include <CGAL/box_intersection_d.h>
-
 #include <SFCGAL/detail/Point_inside_polyhedron.h>
 
 using namespace SFCGAL::detail;
@@ -347,15 +353,13 @@ bool intersects( const PrimitiveHandle<Dim>& pa, const PrimitiveHandle<Dim>& pb
     return dispatch_intersects_sym( pa, pb );
 }
 
-struct found_an_intersection {};
-
+//
+// Box callback, stops the traversal on the first intersection
 template <int Dim>
 struct intersects_cb {
-    void operator()( const typename PrimitiveBox<Dim>::Type& a,
+    bool operator()( const typename PrimitiveBox<Dim>::Type& a,
                      const typename PrimitiveBox<Dim>::Type& b ) {
-        if ( dispatch_intersects_sym( *a.handle(), *b.handle() ) ) {
-            throw found_an_intersection();
-        }
+        return ! dispatch_intersects_sym( *a.handle(), *b.handle() );
     }
 };
 
@@ -367,34 +371,80 @@ bool intersects( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
     a.computeBoundingBoxes( ahandles, aboxes );
     b.computeBoundingBoxes( bhandles, bboxes );
 
-    try {
-        intersects_cb<Dim> cb;
-        CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
-                                  bboxes.begin(), bboxes.end(),
-                                  cb );
+    intersects_cb<Dim> cb;
+    return ! visitIntersectingBoxes( aboxes.begin(), aboxes.end(),
+                                     bboxes.begin(), bboxes.end(),
+                                     cb );
+}
+
+template bool intersects<2>( const GeometrySet<2>& a, const GeometrySet<2>& b );
+template bool intersects<3>( const GeometrySet<3>& a, const GeometrySet<3>& b );
+
+//
+// Tree visitor, stops on the first intersection
+template <int Dim>
+struct intersects_tree_visitor {
+    intersects_tree_visitor( const PrimitiveHandle<Dim>& h ) : handle( h ) {}
+
+    bool operator()( const typename IndexedGeometrySet<Dim>::Tree::Item& item ) {
+        return ! dispatch_intersects_sym( *item.second, handle );
     }
-    catch ( found_an_intersection& e ) {
-        return true;
+
+    const PrimitiveHandle<Dim>& handle;
+};
+
+template <int Dim>
+bool intersects( const IndexedGeometrySet<Dim>& a, const PrimitiveHandle<Dim>& b,
+                 const typename IndexedGeometrySet<Dim>::Bbox& bbox )
+{
+    intersects_tree_visitor<Dim> visitor( b );
+    return ! a.tree().query( bbox, visitor );
+}
+
+template bool intersects<2>( const IndexedGeometrySet<2>& a, const PrimitiveHandle<2>& b, const CGAL::Bbox_2& bbox );
+template bool intersects<3>( const IndexedGeometrySet<3>& a, const PrimitiveHandle<3>& b, const CGAL::Bbox_3& bbox );
+
+template <int Dim>
+bool intersects( const IndexedGeometrySet<Dim>& a, const GeometrySet<Dim>& b )
+{
+    typename SFCGAL::detail::HandleCollection<Dim>::Type bhandles;
+    typename SFCGAL::detail::BoxCollection<Dim>::Type bboxes;
+    b.computeBoundingBoxes( bhandles, bboxes );
+
+    for ( typename BoxCollection<Dim>::Type::const_iterator it = bboxes.begin(); it != bboxes.end(); ++it ) {
+        if ( intersects( a, *it->handle(), primitiveBbox( *it ) ) ) {
+            return true;
+        }
     }
 
     return false;
 }
 
-template bool intersects<2>( const GeometrySet<2>& a, const GeometrySet<2>& b );
-template bool intersects<3>( const GeometrySet<3>& a, const GeometrySet<3>& b );
+template bool intersects<2>( const IndexedGeometrySet<2>& a, const GeometrySet<2>& b );
+template bool intersects<3>( const IndexedGeometrySet<3>& a, const GeometrySet<3>& b );
 
 template bool intersects<2>( const PrimitiveHandle<2>& a, const PrimitiveHandle<2>& b );
 template bool intersects<3>( const PrimitiveHandle<3>& a, const PrimitiveHandle<3>& b );
 
+template <int Dim>
+bool intersects( const DecomposedGeometry<Dim>& a, const DecomposedGeometry<Dim>& b )
+{
+    return intersects( a.geometrySet(), b.geometrySet() );
+}
+
+template bool intersects<2>( const DecomposedGeometry<2>& a, const DecomposedGeometry<2>& b );
+template bool intersects<3>( const DecomposedGeometry<3>& a, const DecomposedGeometry<3>& b );
+
 bool intersects( const Geometry& ga, const Geometry& gb )
 {
+    if ( computationMode() == FAST_COMPUTATION ) {
+        return intersects( ga, gb, FastMode() );
+    }
+
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( ga );
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gb );
 
-    GeometrySet<2> gsa( ga );
-    GeometrySet<2> gsb( gb );
-
-    return intersects( gsa, gsb );
+    return intersects( ga, gb, NoValidityCheck() );
 }
 
 bool intersects3D( const Geometry& ga, const Geometry& gb )
@@ -402,28 +452,131 @@ bool intersects3D( const Geometry& ga, const Geometry& gb )
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( ga );
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gb );
 
-    GeometrySet<3> gsa( ga );
-    GeometrySet<3> gsb( gb );
-
-    return intersects( gsa, gsb );
+    return intersects3D( ga, gb, NoValidityCheck() );
 }
 
 bool intersects( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 {
+    // common pairs of types are tested on the geometries
+    const boost::optional< bool > fast = detail::algorithm::intersectsFastPath( ga, gb );
+
+    if ( fast ) {
+        return *fast;
+    }
+
     GeometrySet<2> gsa( ga );
     GeometrySet<2> gsb( gb );
 
     return intersects( gsa, gsb );
 }
 
+bool intersects( const Geometry& ga, const Geometry& gb, FastMode )
+{
+    detail::InexactGeometrySet gsa( ga );
+    detail::InexactGeometrySet gsb( gb );
+
+    return gsa.intersects( gsb );
+}
+
 bool intersects3D( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 {
+    const boost::optional< bool > fast = detail::algorithm::intersects3DFastPath( ga, gb );
+
+    if ( fast ) {
+        return *fast;
+    }
+
     GeometrySet<3> gsa( ga );
     GeometrySet<3> gsb( gb );
 
     return intersects( gsa, gsb );
 }
 
+bool intersects( const PreparedGeometry& pa, const Geometry& gb )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gb );
+
+    GeometrySet<2> gsb( gb );
+
+    return intersects( pa.indexedGeometrySet2D(), gsb );
+}
+
+bool intersects3D( const PreparedGeometry& pa, const Geometry& gb )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gb );
+
+    GeometrySet<3> gsb( gb );
+
+    return intersects( pa.indexedGeometrySet3D(), gsb );
+}
+
+//
+// Exact test of two segments of a LineString without zero length segments
+template< int Dim >
+bool segmentsSelfIntersect( const LineString& l, size_t i, size_t j )
+{
+    const size_t numSegments = l.numSegments();
+
+    /** @todo find a way to avoid ugly copy/paste here, toPoint_d< Dim > can be used,
+     * but I dont know what to do with Kernel::Segment_Dim and Kernel::Point_Dim
+     */
+    std::unique_ptr< Geometry > inter; // null if no intersection
+
+    if ( Dim == 2 ) {
+        const CGAL::Segment_2< Kernel > s1( l.pointN( i ).toPoint_2(), l.pointN( i + 1 ).toPoint_2() ) ;
+        const CGAL::Segment_2< Kernel > s2( l.pointN( j ).toPoint_2(), l.pointN( j + 1 ).toPoint_2() ) ;
+        const CGAL::Object out = CGAL::intersection( s1, s2 );
+
+        if ( out.is< Kernel::Point_2 >() ) {
+            inter.reset( new Point( CGAL::object_cast< Kernel::Point_2 >( out ) ) );
+        }
+        else if ( out.is< Kernel::Segment_2 >() ) {
+            const Kernel::Segment_2& s = CGAL::object_cast< Kernel::Segment_2 >( out );
+            inter.reset( new LineString( s.point( 0 ), s.point( 1 ) ) ) ;
+        }
+    }
+    else {
+        const CGAL::Segment_3< Kernel > s1( l.pointN( i ).toPoint_3(), l.pointN( i + 1 ).toPoint_3() ) ;
+        const CGAL::Segment_3< Kernel > s2( l.pointN( j ).toPoint_3(), l.pointN( j + 1 ).toPoint_3() ) ;
+        const CGAL::Object out = CGAL::intersection( s1, s2 );
+
+        if ( out.is< Kernel::Point_3 >() ) {
+            inter.reset( new Point( CGAL::object_cast< Kernel::Point_3 >( out ) ) );
+        }
+        else if ( out.is< Kernel::Segment_3 >() ) {
+            const Kernel::Segment_3& s = CGAL::object_cast< Kernel::Segment_3 >( out );
+            inter.reset( new LineString( s.point( 0 ), s.point( 1 ) ) ) ;
+        }
+    }
+
+    if ( inter.get() && inter->is< LineString >() ) {
+        return true;    // segments overlap
+    }
+    else if ( inter.get() && inter->is< Point >()
+              && !( i + 1 == j ) // one contact point between consecutive segments is ok
+              && !( ( i == 0 )
+                    && ( j + 1 == numSegments )
+                    && inter->as< Point >().toPoint_d<Dim>() == l.startPoint().toPoint_d<Dim>()
+                    && inter->as< Point >().toPoint_d<Dim>() == l.endPoint().toPoint_d<Dim>() ) ) {
+        return true;    // contact point that is not a contact between startPoint and endPoint
+    }
+
+    return false;
+}
+
+//
+// Box callback, stops the traversal on the first pair of self intersecting segments
+template< int Dim >
+struct segments_self_intersect_cb {
+    segments_self_intersect_cb( const LineString& l ) : line( l ) {}
+
+    bool operator()( const IndexedBox<Dim>& a, const IndexedBox<Dim>& b ) {
+        return ! segmentsSelfIntersect<Dim>( line, std::min( a.index, b.index ), std::max( a.index, b.index ) );
+    }
+
+    const LineString& line;
+};
+
 template< int Dim >
 bool selfIntersectsImpl( const LineString& line )
 {
@@ -433,64 +586,68 @@ bool selfIntersectsImpl( const LineString& line )
     }
 
     // note: zero length segments are a pain, to avoid algorithm complexity
-    // we start by filtering them out
+    // we start by filtering them out (points are compared in dimension Dim,
+    // the 2D test runs on the XY projection of 3D lines)
     const size_t numPoints = line.numPoints();
     LineString l;
 
     for ( size_t i = 0; i != numPoints; ++i ) {
-        if ( i==0 || l.endPoint() != line.pointN( i ) ) {
+        if ( i==0 || l.endPoint().toPoint_d<Dim>() != line.pointN( i ).toPoint_d<Dim>() ) {
             l.addPoint( line.pointN( i ) );
         }
     }
 
     const size_t numSegments = l.numSegments();
 
-    // test any two pairs of segments
+    // only the pairs of segments with overlapping boxes are tested
+    std::vector< IndexedBox<Dim> > boxes;
+    boxes.reserve( numSegments );
+
     for ( size_t i = 0; i != numSegments; ++i ) {
-        // first line segment is point i and i+1
-        for ( size_t j = i + 1; j < numSegments; ++j ) {
-            /** @todo find a way to avoid ugly copy/paste here, toPoint_d< Dim > can be used,
-             * but I dont know what to do with Kernel::Segment_Dim and Kernel::Point_Dim
-             */
-            std::unique_ptr< Geometry > inter; // null if no intersection
-
-            if ( Dim == 2 ) {
-                const CGAL::Segment_2< Kernel > s1( l.pointN( i ).toPoint_2(), l.pointN( i + 1 ).toPoint_2() ) ;
-                const CGAL::Segment_2< Kernel > s2( l.pointN( j ).toPoint_2(), l.pointN( j + 1 ).toPoint_2() ) ;
-                const CGAL::Object out = CGAL::intersection( s1, s2 );
-
-                if ( out.is< Kernel::Point_2 >() ) {
-                    inter.reset( new Point( CGAL::object_cast< Kernel::Point_2 >( out ) ) );
-                }
-                else if ( out.is< Kernel::Segment_2 >() ) {
-                    const Kernel::Segment_2& s = CGAL::object_cast< Kernel::Segment_2 >( out );
-                    inter.reset( new LineString( s.point( 0 ), s.point( 1 ) ) ) ;
-                }
-            }
-            else {
-                const CGAL::Segment_3< Kernel > s1( l.pointN( i ).toPoint_3(), l.pointN( i + 1 ).toPoint_3() ) ;
-                const CGAL::Segment_3< Kernel > s2( l.pointN( j ).toPoint_3(), l.pointN( j + 1 ).toPoint_3() ) ;
-                const CGAL::Object out = CGAL::intersection( s1, s2 );
+        boxes.push_back( IndexedBox<Dim>(
+                             l.pointN( i ).toPoint_d<Dim>().bbox() + l.pointN( i + 1 ).toPoint_d<Dim>().bbox(),
+                             i
+                         ) );
+    }
 
-                if ( out.is< Kernel::Point_3 >() ) {
-                    inter.reset( new Point( CGAL::object_cast< Kernel::Point_3 >( out ) ) );
-                }
-                else if ( out.is< Kernel::Segment_3 >() ) {
-                    const Kernel::Segment_3& s = CGAL::object_cast< Kernel::Segment_3 >( out );
-                    inter.reset( new LineString( s.point( 0 ), s.point( 1 ) ) ) ;
-                }
-            }
+    segments_self_intersect_cb<Dim> cb( l );
+    return ! visitIntersectingBoxes( boxes.begin(), boxes.end(), cb );
+}
+
+bool selfIntersects( const LineString& l )
+{
+    return selfIntersectsImpl<2>( l );
+}
+bool selfIntersects3D( const LineString& l )
+{
+    return selfIntersectsImpl<3>( l );
+}
 
-            if ( inter.get() && inter->is< LineString >() ) {
-                return true;    // segments overlap
+//
+// Exact test of two faces of a surface, faces are either Polygon or Triangle.
+// Neighbors can have a line as intersection, non neighbors can only have a
+// point or a set of points
+template< int Dim, typename Face >
+bool facesSelfIntersect( const Face& fi, const Face& fj, size_t i, size_t j, const SurfaceGraph& graph )
+{
+    std::unique_ptr< Geometry > inter = Dim == 3
+                                      ? intersection3D( fi, fj )
+                                      : intersection( fi, fj ) ;
+
+    if ( !inter->isEmpty() ) {
+        typedef SurfaceGraph::FaceGraph::adjacency_iterator Iterator;
+        std::pair< Iterator, Iterator > neighbors = boost::adjacent_vertices( i, graph.faceGraph() );
+
+        if ( neighbors.second != std::find( neighbors.first, neighbors.second, j ) ) {
+            // neighbor
+            if ( !inter->is< LineString >() ) {
+                return true;
             }
-            else if ( inter.get() && inter->is< Point >()
-                      && !( i + 1 == j ) // one contact point between consecutive segments is ok
-                      && !( ( i == 0 )
-                            && ( j + 1 == numSegments )
-                            && inter->as< Point >() == l.startPoint()
-                            && inter->as< Point >() == l.endPoint() ) ) {
-                return true;    // contact point that is not a contact between startPoint and endPoint
+        }
+        else {
+            // not a neighbor
+            if ( inter->dimension() != 0 ) {
+                return true;
             }
         }
     }
@@ -498,53 +655,72 @@ bool selfIntersectsImpl( const LineString& line )
     return false;
 }
 
-bool selfIntersects( const LineString& l )
+//
+// Box of the vertices of a face
+template< int Dim >
+IndexedBox<Dim> faceBox( const LineString& ring, size_t index )
 {
-    return selfIntersectsImpl<2>( l );
+    typename detail::TypeForDimension<Dim>::Bbox bbox = ring.startPoint().toPoint_d<Dim>().bbox();
+
+    for ( size_t i = 1; i < ring.numPoints(); ++i ) {
+        bbox = bbox + ring.pointN( i ).toPoint_d<Dim>().bbox();
+    }
+
+    return IndexedBox<Dim>( bbox, index );
 }
-bool selfIntersects3D( const LineString& l )
+
+template< int Dim >
+IndexedBox<Dim> faceBox( const Triangle& triangle, size_t index )
 {
-    return selfIntersectsImpl<3>( l );
+    return IndexedBox<Dim>(
+               triangle.vertex( 0 ).toPoint_d<Dim>().bbox()
+               + triangle.vertex( 1 ).toPoint_d<Dim>().bbox()
+               + triangle.vertex( 2 ).toPoint_d<Dim>().bbox(),
+               index
+           );
 }
 
+//
+// Box callback, stops the traversal on the first pair of self intersecting faces
+template< int Dim >
+struct polygons_self_intersect_cb {
+    polygons_self_intersect_cb( const PolyhedralSurface& s, const SurfaceGraph& g ) : surface( s ), graph( g ) {}
+
+    bool operator()( const IndexedBox<Dim>& a, const IndexedBox<Dim>& b ) {
+        return ! facesSelfIntersect<Dim>( surface.polygonN( a.index ), surface.polygonN( b.index ), a.index, b.index, graph );
+    }
+
+    const PolyhedralSurface& surface;
+    const SurfaceGraph& graph;
+};
+
+template< int Dim >
+struct triangles_self_intersect_cb {
+    triangles_self_intersect_cb( const TriangulatedSurface& t, const SurfaceGraph& g ) : tin( t ), graph( g ) {}
+
+    bool operator()( const IndexedBox<Dim>& a, const IndexedBox<Dim>& b ) {
+        return ! facesSelfIntersect<Dim>( tin.triangleN( a.index ), tin.triangleN( b.index ), a.index, b.index, graph );
+    }
+
+    const TriangulatedSurface& tin;
+    const SurfaceGraph& graph;
+};
 
 template< int Dim >
 bool selfIntersectsImpl( const PolyhedralSurface& s, const SurfaceGraph& graph )
 {
-    size_t numPolygons = s.numPolygons();
-
-    for ( size_t pi=0; pi != numPolygons; ++pi ) {
-        for ( size_t pj=pi+1; pj < numPolygons; ++pj ) {
-            std::unique_ptr< Geometry > inter = Dim == 3
-                                              ? intersection3D( s.polygonN( pi ), s.polygonN( pj ) )
-                                              : intersection( s.polygonN( pi ), s.polygonN( pj ) ) ;
-
-            if ( !inter->isEmpty() ) {
-                // two cases:
-                // - neighbors can have a line as intersection
-                // - non neighbors can only have a point or a set of points
-                typedef SurfaceGraph::FaceGraph::adjacency_iterator Iterator;
-                std::pair< Iterator, Iterator > neighbors = boost::adjacent_vertices( pi, graph.faceGraph() );
-
-                if ( neighbors.second != std::find( neighbors.first, neighbors.second, pj ) ) {
-                    // neighbor
-                    //std::cerr << pi << " " << pj << " neighbor\n";
-                    if ( !inter->is< LineString >() ) {
-                        return true;
-                    }
-                }
-                else {
-                    // not a neighbor
-                    //std::cerr << pi << " " << pj << " not neighbor\n";
-                    if ( inter->dimension() != 0 ) {
-                        return true;
-                    }
-                }
-            }
-        }
+    const size_t numPolygons = s.numPolygons();
+
+    // only the pairs of polygons with overlapping boxes are tested
+    std::vector< IndexedBox<Dim> > boxes;
+    boxes.reserve( numPolygons );
+
+    for ( size_t i = 0; i != numPolygons; ++i ) {
+        boxes.push_back( faceBox<Dim>( s.polygonN( i ).exteriorRing(), i ) );
     }
 
-    return false;
+    polygons_self_intersect_cb<Dim> cb( s, graph );
+    return ! visitIntersectingBoxes( boxes.begin(), boxes.end(), cb );
 }
 
 bool selfIntersects( const PolyhedralSurface& s, const SurfaceGraph& g )
@@ -560,40 +736,18 @@ bool selfIntersects3D( const PolyhedralSurface& s, const SurfaceGraph& g )
 template< int Dim >
 bool selfIntersectsImpl( const TriangulatedSurface& tin, const SurfaceGraph& graph )
 {
-    size_t numTriangles = tin.numTriangles();
-
-    for ( size_t ti=0; ti != numTriangles; ++ti ) {
-        for ( size_t tj=ti+1; tj < numTriangles; ++tj ) {
-            std::unique_ptr< Geometry > inter = Dim == 3
-                                              ? intersection3D( tin.triangleN( ti ), tin.triangleN( tj ) )
-                                              : intersection( tin.triangleN( ti ), tin.triangleN( tj ) ) ;
-
-            if ( !inter->isEmpty() ) {
-                // two cases:
-                // - neighbors can have a line as intersection
-                // - non neighbors can only have a point or a set of points
-                typedef SurfaceGraph::FaceGraph::adjacency_iterator Iterator;
-                std::pair< Iterator, Iterator > neighbors = boost::adjacent_vertices( ti, graph.faceGraph() );
-
-                if ( neighbors.second != std::find( neighbors.first, neighbors.second, tj ) ) {
-                    // neighbor
-                    //std::cerr << ti << " " << tj << " neighbor\n";
-                    if ( !inter->is< LineString >() ) {
-                        return true;
-                    }
-                }
-                else {
-                    // not a neighbor
-                    //std::cerr << ti << " " << tj << " not neighbor\n";
-                    if ( inter->dimension() != 0 ) {
-                        return true;
-                    }
-                }
-            }
-        }
+    const size_t numTriangles = tin.numTriangles();
+
+    // only the pairs of triangles with overlapping boxes are tested
+    std::vector< IndexedBox<Dim> > boxes;
+    boxes.reserve( numTriangles );
+
+    for ( size_t i = 0; i != numTriangles; ++i ) {
+        boxes.push_back( faceBox<Dim>( tin.triangleN( i ), i ) );
     }
 
-    return false;
+    triangles_self_intersect_cb<Dim> cb( tin, graph );
+    return ! visitIntersectingBoxes( boxes.begin(), boxes.end(), cb );
 }
 
 bool selfIntersects( const TriangulatedSurface& tin, const SurfaceGraph& g )
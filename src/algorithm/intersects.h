@@ -25,18 +25,23 @@
 
 namespace SFCGAL {
 class Geometry;
+class PreparedGeometry;
 class LineString;
 class PolyhedralSurface;
 class TriangulatedSurface;
+template <int Dim> class DecomposedGeometry;
 namespace detail {
 template <int Dim> class GeometrySet;
 template <int Dim> struct PrimitiveHandle;
+template <int Dim> class IndexedGeometrySet;
 }
 
 namespace algorithm {
 class SurfaceGraph;
 // defined in isValid.h
 struct NoValidityCheck;
+// defined in computationMode.h
+struct FastMode;
 
 /**
  * Robust intersection test on 2D geometries. Force projection to z=0 if needed
@@ -68,6 +73,53 @@ SFCGAL_API bool intersects( const Geometry& ga, const Geometry& gb, NoValidityCh
  */
 SFCGAL_API bool intersects3D( const Geometry& ga, const Geometry& gb, NoValidityCheck );
 
+/**
+ * Intersection test on 2D geometries with exact predicates on double precision coordinates.
+ * Force projection to z=0 if needed
+ * @pre ga and gb are valid geometries (not checked, see FastMode)
+ * @ingroup public_api
+ * @see FastMode for the robustness contract
+ */
+SFCGAL_API bool intersects( const Geometry& ga, const Geometry& gb, FastMode );
+
+/**
+ * Robust intersection test on 2D geometries, reusing the decomposition and the box tree of a
+ * prepared geometry. Force projection to z=0 if needed
+ * @pre pa and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API bool intersects( const PreparedGeometry& pa, const Geometry& gb );
+
+/**
+ * Robust intersection test on 3D geometries, reusing the decomposition and the box tree of a
+ * prepared geometry. Assume z = 0 if needed
+ * @pre pa and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API bool intersects3D( const PreparedGeometry& pa, const Geometry& gb );
+
+/**
+ * Intersection test on two decomposed geometries (intersects3D for Dim = 3)
+ * @ingroup public_api
+ */
+template <int Dim>
+bool intersects( const DecomposedGeometry<Dim>& a, const DecomposedGeometry<Dim>& b );
+
+/**
+ * Intersection test between an indexed GeometrySet and a GeometrySet
+ * @ingroup detail
+ */
+template <int Dim>
+bool intersects( const detail::IndexedGeometrySet<Dim>& a, const detail::GeometrySet<Dim>& b );
+
+/**
+ * Intersection test between an indexed GeometrySet and a primitive with its bounding box
+ * @ingroup detail
+ */
+template <int Dim>
+bool intersects( const detail::IndexedGeometrySet<Dim>& a, const detail::PrimitiveHandle<Dim>& b,
+                 const typename detail::IndexedGeometrySet<Dim>::Bbox& bbox );
+
 /**
  * Intersection test on GeometrySet
  * @ingroup detail
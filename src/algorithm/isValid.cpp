@@ -52,60 +52,83 @@
 #include <boost/graph/undirected_dfs.hpp>
 #include <boost/format.hpp>
 
+#include <atomic>
+
 using namespace SFCGAL::detail::algorithm;
 
 namespace SFCGAL {
 
-void SFCGAL_ASSERT_GEOMETRY_VALIDITY_( const Geometry& g, const std::string& ctxt )
+namespace {
+std::atomic< int > globalValidationPolicy( algorithm::VALIDATION_TRUST_FLAG );
+
+// -1 when the thread follows the global policy
+thread_local int threadValidationPolicy = -1;
+
+bool mustValidate( const Geometry& g )
 {
-    if ( !(g).hasValidityFlag() )
-    {
-        const Validity sfcgalAssertGeometryValidity = algorithm::isValid( g );
-        if ( ! sfcgalAssertGeometryValidity ) {
-            throw GeometryInvalidityException(
-                                              ( boost::format(ctxt + "%s is invalid : %s : %s")
-                                                % (g).geometryType()
-                                                % sfcgalAssertGeometryValidity.reason()
-                                                % (g).asText()
-                                                ).str()
-                                              );
-        }
+    switch ( algorithm::validationPolicy() ) {
+    case algorithm::VALIDATION_OFF:
+        return false;
+
+    case algorithm::VALIDATION_ON:
+        return true;
+
+    case algorithm::VALIDATION_TRUST_FLAG:
+        break;
     }
+
+    return ! g.hasValidityFlag();
+}
+
+void assertGeometryValidity( const Geometry& g, const Validity& sfcgalAssertGeometryValidity, const std::string& ctxt )
+{
+    if ( ! sfcgalAssertGeometryValidity ) {
+        throw GeometryInvalidityException(
+                                          ( boost::format(ctxt + "%s is invalid : %s : %s")
+                                            % (g).geometryType()
+                                            % sfcgalAssertGeometryValidity.reason()
+                                            % (g).asText()
+                                            ).str()
+                                          );
+    }
+}
 }
 
 void SFCGAL_ASSERT_GEOMETRY_VALIDITY( const Geometry& g )
 {
-    SFCGAL_ASSERT_GEOMETRY_VALIDITY_(g,"");
+    if ( mustValidate( g ) )
+    {
+        assertGeometryValidity( g, algorithm::isValid( g ), "" );
+    }
 }
 
 void SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( const Geometry& g )
 {
-    if ( !(g).hasValidityFlag() )
+    if ( mustValidate( g ) )
     {
         using namespace SFCGAL;
         if ( (g).is3D() ) {
-            std::unique_ptr<SFCGAL::Geometry> sfcgalAssertGeometryValidityClone( (g).clone() );
-            algorithm::force2D( *sfcgalAssertGeometryValidityClone );
-            SFCGAL_ASSERT_GEOMETRY_VALIDITY_( (*sfcgalAssertGeometryValidityClone), "When converting to 2D - " );
+            // validates the XY projection without copying the geometry
+            assertGeometryValidity( g, algorithm::isValid2D( g ), "When converting to 2D - " );
         }
         else {
-            SFCGAL_ASSERT_GEOMETRY_VALIDITY( g );
+            assertGeometryValidity( g, algorithm::isValid( g ), "" );
         }
     }
 }
 
 void SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( const Geometry& g )
 {
-    if ( !(g).hasValidityFlag() )
+    if ( mustValidate( g ) )
     {
         using namespace SFCGAL;
         if ( !(g).is3D() ) {
             std::unique_ptr<Geometry> sfcgalAssertGeometryValidityClone( (g).clone() );
             algorithm::force3D( *sfcgalAssertGeometryValidityClone );
-            SFCGAL_ASSERT_GEOMETRY_VALIDITY_( (*sfcgalAssertGeometryValidityClone), "When converting to 3D - " );
+            assertGeometryValidity( (*sfcgalAssertGeometryValidityClone), algorithm::isValid( *sfcgalAssertGeometryValidityClone ), "When converting to 3D - " );
         }
         else {
-            SFCGAL_ASSERT_GEOMETRY_VALIDITY( g );
+            assertGeometryValidity( g, algorithm::isValid( g ), "" );
         }
     }
 }
@@ -119,6 +142,59 @@ void SFCGAL_ASSERT_GEOMETRY_VALIDITY_ON_PLANE( const Geometry& /*g*/ )
 
 namespace algorithm {
 
+///
+///
+///
+void setValidationPolicy( ValidationPolicy policy )
+{
+    globalValidationPolicy = policy;
+}
+
+///
+///
+///
+void setThreadValidationPolicy( ValidationPolicy policy )
+{
+    threadValidationPolicy = policy;
+}
+
+///
+///
+///
+void resetThreadValidationPolicy()
+{
+    threadValidationPolicy = -1;
+}
+
+///
+///
+///
+ValidationPolicy validationPolicy()
+{
+    if ( threadValidationPolicy >= 0 ) {
+        return static_cast< ValidationPolicy >( threadValidationPolicy );
+    }
+
+    return static_cast< ValidationPolicy >( globalValidationPolicy.load() );
+}
+
+///
+///
+///
+ValidationPolicyScope::ValidationPolicyScope( ValidationPolicy policy ):
+    _previous( threadValidationPolicy )
+{
+    threadValidationPolicy = policy;
+}
+
+///
+///
+///
+ValidationPolicyScope::~ValidationPolicyScope()
+{
+    threadValidationPolicy = _previous;
+}
+
 // to detect unconnected interior in polygon
 struct LoopDetector : public boost::dfs_visitor<> {
     LoopDetector( bool& hasLoop ):_hasLoop( hasLoop ) {}
@@ -133,6 +209,19 @@ private:
 
 
 
+//
+// When projected is true, geometries are validated as their XY projection,
+// i.e. as if force2D had been applied on them
+inline bool is3D( const Geometry& g, bool projected )
+{
+    return ! projected && g.is3D();
+}
+
+inline bool equalPoints( const Point& a, const Point& b, bool projected )
+{
+    return projected ? a.toPoint_2() == b.toPoint_2() : a == b;
+}
+
 /**
  * @note empty geometries are valid, but the test is only performed in the interface function
  * in individual functions for implementation, an assertion !empty is present for this reason
@@ -157,7 +246,7 @@ const Validity isValid( const Point& p )
     return Validity::valid();
 }
 
-const Validity isValid( const LineString& l, const double& toleranceAbs )
+const Validity isValid( const LineString& l, const double& toleranceAbs, bool projected = false )
 {
     if ( l.isEmpty() ) {
         return Validity::valid();
@@ -169,10 +258,10 @@ const Validity isValid( const LineString& l, const double& toleranceAbs )
 //        if (!v) return Validity::invalid( ( boost::format("Point %d is invalid: %s") % p % v.reason() ).str() );
 //    }
 
-    return length3D( l ) > toleranceAbs ? Validity::valid() : Validity::invalid( "no length" );
+    return ( projected ? length( l ) : length3D( l ) ) > toleranceAbs ? Validity::valid() : Validity::invalid( "no length" );
 }
 
-const Validity isValid( const Polygon& p, const double& toleranceAbs )
+const Validity isValid( const Polygon& p, const double& toleranceAbs, bool projected = false )
 {
     if ( p.isEmpty() ) {
         return Validity::valid();
@@ -190,7 +279,7 @@ const Validity isValid( const Polygon& p, const double& toleranceAbs )
 //        if (!v) return Validity::invalid((boost::format("ring %d is invalid: %s") % r % v.reason()).str() );
 
         const double distanceToClose =
-            p.is3D() ? distancePointPoint3D( p.ringN( r ).startPoint(), p.ringN( r ).endPoint() )
+            is3D( p, projected ) ? distancePointPoint3D( p.ringN( r ).startPoint(), p.ringN( r ).endPoint() )
             : distancePointPoint( p.ringN( r ).startPoint(), p.ringN( r ).endPoint() )
             ;
 
@@ -198,7 +287,7 @@ const Validity isValid( const Polygon& p, const double& toleranceAbs )
             return Validity::invalid( ( boost::format( "ring %d is not closed" ) % r ).str() );
         }
 
-        if ( p.is3D() ? selfIntersects3D( p.ringN( r ) ) : selfIntersects( p.ringN( r ) ) ) {
+        if ( is3D( p, projected ) ? selfIntersects3D( p.ringN( r ) ) : selfIntersects( p.ringN( r ) ) ) {
             return Validity::invalid( ( boost::format( "ring %d self intersects" ) % r ).str() );
         }
     }
@@ -209,14 +298,14 @@ const Validity isValid( const Polygon& p, const double& toleranceAbs )
         const LineString & ring = p.ringN( r );
         const Point & start = ring.startPoint();
         size_t i = 0;
-        for( ; i < ring.numPoints() && start == ring.pointN(i); i++ ) ; // noop 
+        for( ; i < ring.numPoints() && equalPoints( start, ring.pointN(i), projected ); i++ ) ; // noop 
         if ( i == ring.numPoints() ){
             return Validity::invalid( ( boost::format( "ring %d degenerated to a point" ) % r ).str() );
         }
     }
 
     // Orientation in 2D
-    if ( !p.is3D() ) {
+    if ( !is3D( p, projected ) ) {
         // Opposit orientation for interior and exterior rings
         const bool extCCWO = isCounterClockWiseOriented( p.exteriorRing() );
 
@@ -254,7 +343,7 @@ const Validity isValid( const Polygon& p, const double& toleranceAbs )
 
         for ( size_t ri=0; ri < numRings; ++ri ) { // no need for numRings-1, the next loop won't be entered for the last ring
             for ( size_t rj=ri+1; rj < numRings; ++rj ) {
-                std::unique_ptr<Geometry> inter = p.is3D()
+                std::unique_ptr<Geometry> inter = is3D( p, projected )
                                                 ? intersection3D( p.ringN( ri ), p.ringN( rj ) )
                                                 : intersection( p.ringN( ri ), p.ringN( rj ) );
 
@@ -289,7 +378,7 @@ const Validity isValid( const Polygon& p, const double& toleranceAbs )
     if ( p.hasInteriorRings() ) {
         // Interior rings must be interior to exterior ring
         for ( size_t r=0; r < p.numInteriorRings(); ++r ) { // no need for numRings-1, the next loop won't be entered for the last ring
-            if ( p.is3D()
+            if ( is3D( p, projected )
                     ? !coversPoints3D( Polygon( p.exteriorRing() ), Polygon( p.interiorRingN( r ) ) )
                     : !coversPoints( Polygon( p.exteriorRing() ), Polygon( p.interiorRingN( r ) ) )
                ) {
@@ -300,7 +389,7 @@ const Validity isValid( const Polygon& p, const double& toleranceAbs )
         // Interior ring must not cover one another
         for ( size_t ri=0; ri < p.numInteriorRings(); ++ri ) { // no need for numRings-1, the next loop won't be entered for the last ring
             for ( size_t rj=ri+1; rj < p.numInteriorRings(); ++rj ) {
-                if ( p.is3D()
+                if ( is3D( p, projected )
                         ? coversPoints3D( Polygon( p.interiorRingN( ri ) ), Polygon( p.interiorRingN( rj ) ) )
                         : coversPoints( Polygon( p.interiorRingN( ri ) ), Polygon( p.interiorRingN( rj ) ) )
                    ) {
@@ -313,12 +402,12 @@ const Validity isValid( const Polygon& p, const double& toleranceAbs )
     return Validity::valid();
 }
 
-const Validity isValid( const Triangle& t, const double& toleranceAbs )
+const Validity isValid( const Triangle& t, const double& toleranceAbs, bool projected = false )
 {
-    return isValid( t.toPolygon(), toleranceAbs );
+    return isValid( t.toPolygon(), toleranceAbs, projected );
 }
 
-const Validity isValid( const MultiLineString& ml, const double& toleranceAbs )
+const Validity isValid( const MultiLineString& ml, const double& toleranceAbs, bool projected = false )
 {
     if ( ml.isEmpty() ) {
         return Validity::valid();
@@ -327,7 +416,7 @@ const Validity isValid( const MultiLineString& ml, const double& toleranceAbs )
     const size_t numLineString = ml.numGeometries();
 
     for ( size_t l = 0; l != numLineString; ++l ) {
-        Validity v = isValid( ml.lineStringN( l ), toleranceAbs );
+        Validity v = isValid( ml.lineStringN( l ), toleranceAbs, projected );
 
         if ( !v ) return Validity::invalid(
                                  ( boost::format( "LineString %d is invalid: %s" ) % l % v.reason() ).str()
@@ -337,7 +426,7 @@ const Validity isValid( const MultiLineString& ml, const double& toleranceAbs )
     return Validity::valid();
 }
 
-const Validity isValid( const MultiPolygon& mp, const double& toleranceAbs )
+const Validity isValid( const MultiPolygon& mp, const double& toleranceAbs, bool projected = false )
 {
     if ( mp.isEmpty() ) {
         return Validity::valid();
@@ -346,7 +435,7 @@ const Validity isValid( const MultiPolygon& mp, const double& toleranceAbs )
     const size_t numPolygons = mp.numGeometries();
 
     for ( size_t p = 0; p != numPolygons; ++p ) {
-        Validity v = isValid( mp.polygonN( p ), toleranceAbs );
+        Validity v = isValid( mp.polygonN( p ), toleranceAbs, projected );
 
         if ( !v ) return Validity::invalid(
                                  ( boost::format( "Polygon %d is invalid: %s" ) % p % v.reason() ).str()
@@ -355,7 +444,7 @@ const Validity isValid( const MultiPolygon& mp, const double& toleranceAbs )
 
     for ( size_t pi = 0; pi != numPolygons; ++pi ) {
         for ( size_t pj = pi+1; pj < numPolygons; ++pj ) {
-            std::unique_ptr< Geometry > inter = mp.is3D()
+            std::unique_ptr< Geometry > inter = is3D( mp, projected )
                                               ? intersection3D( mp.polygonN( pi ), mp.polygonN( pj ) )
                                               : intersection( mp.polygonN( pi ), mp.polygonN( pj ) ) ;
 
@@ -371,7 +460,9 @@ const Validity isValid( const MultiPolygon& mp, const double& toleranceAbs )
     return Validity::valid();
 }
 
-const Validity isValid( const GeometryCollection& gc, const double& toleranceAbs )
+const Validity isValid( const Geometry& g, const double& toleranceAbs, bool projected );
+
+const Validity isValid( const GeometryCollection& gc, const double& toleranceAbs, bool projected = false )
 {
     if ( gc.isEmpty() ) {
         return Validity::valid();
@@ -380,7 +471,7 @@ const Validity isValid( const GeometryCollection& gc, const double& toleranceAbs
     const size_t numGeom = gc.numGeometries();
 
     for ( size_t g = 0; g != numGeom; ++g ) {
-        Validity v = isValid( gc.geometryN( g ), toleranceAbs );
+        Validity v = isValid( gc.geometryN( g ), toleranceAbs, projected );
 
         if ( !v ) return Validity::invalid(
                                  ( boost::format( "%s %d is invalid: %s" ) % gc.geometryN( g ).geometryType()  % g % v.reason() ).str()
@@ -390,7 +481,7 @@ const Validity isValid( const GeometryCollection& gc, const double& toleranceAbs
     return Validity::valid();
 }
 
-const Validity isValid( const TriangulatedSurface& tin, const SurfaceGraph& graph, const double& toleranceAbs )
+const Validity isValid( const TriangulatedSurface& tin, const SurfaceGraph& graph, const double& toleranceAbs, bool projected = false )
 {
     if ( tin.isEmpty() ) {
         return Validity::valid();
@@ -399,7 +490,7 @@ const Validity isValid( const TriangulatedSurface& tin, const SurfaceGraph& grap
     size_t numTriangles = tin.numTriangles();
 
     for ( size_t t=0; t != numTriangles; ++t ) {
-        Validity v = isValid( tin.triangleN( t ), toleranceAbs );
+        Validity v = isValid( tin.triangleN( t ), toleranceAbs, projected );
 
         if ( !v ) return Validity::invalid(
                                  ( boost::format( "Triangle %d is invalid: %s" ) % t % v.reason() ).str()
@@ -410,24 +501,24 @@ const Validity isValid( const TriangulatedSurface& tin, const SurfaceGraph& grap
         return Validity::invalid( "not connected" );
     }
 
-    if ( tin.is3D() ? selfIntersects3D( tin, graph ) : selfIntersects( tin, graph ) ) {
+    if ( is3D( tin, projected ) ? selfIntersects3D( tin, graph ) : selfIntersects( tin, graph ) ) {
         return Validity::invalid( "self intersects" );
     }
 
     return Validity::valid();
 }
 
-const Validity isValid( const TriangulatedSurface& tin, const double& toleranceAbs )
+const Validity isValid( const TriangulatedSurface& tin, const double& toleranceAbs, bool projected = false )
 {
     if ( tin.isEmpty() ) {
         return Validity::valid();
     }
 
-    const SurfaceGraph graph( tin );
-    return graph.isValid() ? isValid( tin, graph, toleranceAbs ) : graph.isValid() ;
+    const SurfaceGraph graph( tin, projected );
+    return graph.isValid() ? isValid( tin, graph, toleranceAbs, projected ) : graph.isValid() ;
 }
 
-const Validity isValid( const PolyhedralSurface& s, const SurfaceGraph& graph, const double& toleranceAbs )
+const Validity isValid( const PolyhedralSurface& s, const SurfaceGraph& graph, const double& toleranceAbs, bool projected = false )
 {
     if ( s.isEmpty() ) {
         return Validity::valid();
@@ -436,7 +527,7 @@ const Validity isValid( const PolyhedralSurface& s, const SurfaceGraph& graph, c
     size_t numPolygons = s.numPolygons();
 
     for ( size_t p=0; p != numPolygons; ++p ) {
-        Validity v = isValid( s.polygonN( p ), toleranceAbs );
+        Validity v = isValid( s.polygonN( p ), toleranceAbs, projected );
 
         if ( !v ) return Validity::invalid(
                                  ( boost::format( "Polygon %d is invalid: %s" ) % p % v.reason() ).str()
@@ -447,24 +538,24 @@ const Validity isValid( const PolyhedralSurface& s, const SurfaceGraph& graph, c
         return Validity::invalid( "not connected" );
     }
 
-    if ( s.is3D() ? selfIntersects3D( s, graph ) : selfIntersects( s, graph ) ) {
+    if ( is3D( s, projected ) ? selfIntersects3D( s, graph ) : selfIntersects( s, graph ) ) {
         return Validity::invalid( "self intersects" );
     }
 
     return Validity::valid();
 }
 
-const Validity isValid( const PolyhedralSurface& s, const double& toleranceAbs )
+const Validity isValid( const PolyhedralSurface& s, const double& toleranceAbs, bool projected = false )
 {
     if ( s.isEmpty() ) {
         return Validity::valid();
     }
 
-    const SurfaceGraph graph( s );
-    return graph.isValid() ? isValid( s, graph, toleranceAbs ) : graph.isValid() ;
+    const SurfaceGraph graph( s, projected );
+    return graph.isValid() ? isValid( s, graph, toleranceAbs, projected ) : graph.isValid() ;
 }
 
-const Validity isValid( const Solid& solid, const double& toleranceAbs )
+const Validity isValid( const Solid& solid, const double& toleranceAbs, bool projected = false )
 {
     if ( solid.isEmpty() ) {
         return Validity::valid();
@@ -473,8 +564,8 @@ const Validity isValid( const Solid& solid, const double& toleranceAbs )
     const size_t numShells = solid.numShells();
 
     for ( size_t s = 0; s != numShells; ++s ) {
-        const SurfaceGraph graph( solid.shellN( s ) );
-        Validity v = isValid( solid.shellN( s ), graph, toleranceAbs );
+        const SurfaceGraph graph( solid.shellN( s ), projected );
+        Validity v = isValid( solid.shellN( s ), graph, toleranceAbs, projected );
 
         if ( !v ) return Validity::invalid(
                                  ( boost::format( "PolyhedralSurface (shell) %d is invalid: %s" ) % s % v.reason() ).str()
@@ -492,7 +583,7 @@ const Validity isValid( const Solid& solid, const double& toleranceAbs )
     return Validity::valid();
 }
 
-const Validity isValid( const MultiSolid& ms, const double& toleranceAbs )
+const Validity isValid( const MultiSolid& ms, const double& toleranceAbs, bool projected = false )
 {
     if ( ms.isEmpty() ) {
         return Validity::valid();
@@ -501,7 +592,7 @@ const Validity isValid( const MultiSolid& ms, const double& toleranceAbs )
     const size_t numMultiSolid = ms.numGeometries();
 
     for ( size_t s = 0; s != numMultiSolid; ++s ) {
-        Validity v = isValid( ms.solidN( s ), toleranceAbs );
+        Validity v = isValid( ms.solidN( s ), toleranceAbs, projected );
 
         if ( !v ) return Validity::invalid(
                                  ( boost::format( "Solid %d is invalid: %s" ) % s % v.reason() ).str()
@@ -512,44 +603,44 @@ const Validity isValid( const MultiSolid& ms, const double& toleranceAbs )
 }
 
 
-const Validity isValid( const Geometry& g, const double& toleranceAbs )
+const Validity isValid( const Geometry& g, const double& toleranceAbs, bool projected )
 {
     switch ( g.geometryTypeId() ) {
     case TYPE_POINT:
         return isValid( g.as< Point >() );
 
     case TYPE_LINESTRING:
-        return isValid( g.as< LineString >(),          toleranceAbs ) ;
+        return isValid( g.as< LineString >(),          toleranceAbs, projected ) ;
 
     case TYPE_POLYGON:
-        return isValid( g.as< Polygon >(),             toleranceAbs ) ;
+        return isValid( g.as< Polygon >(),             toleranceAbs, projected ) ;
 
     case TYPE_TRIANGLE:
-        return isValid( g.as< Triangle >(),            toleranceAbs ) ;
+        return isValid( g.as< Triangle >(),            toleranceAbs, projected ) ;
 
     case TYPE_SOLID:
-        return isValid( g.as< Solid >(),               toleranceAbs ) ;
+        return isValid( g.as< Solid >(),               toleranceAbs, projected ) ;
 
     case TYPE_MULTIPOINT:
         return Validity::valid();
 
     case TYPE_MULTILINESTRING:
-        return isValid( g.as< MultiLineString >(),     toleranceAbs ) ;
+        return isValid( g.as< MultiLineString >(),     toleranceAbs, projected ) ;
 
     case TYPE_MULTIPOLYGON:
-        return isValid( g.as< MultiPolygon >(),        toleranceAbs ) ;
+        return isValid( g.as< MultiPolygon >(),        toleranceAbs, projected ) ;
 
     case TYPE_MULTISOLID:
-        return isValid( g.as< MultiSolid >(),          toleranceAbs ) ;
+        return isValid( g.as< MultiSolid >(),          toleranceAbs, projected ) ;
 
     case TYPE_GEOMETRYCOLLECTION:
-        return isValid( g.as< GeometryCollection >(),  toleranceAbs ) ;
+        return isValid( g.as< GeometryCollection >(),  toleranceAbs, projected ) ;
 
     case TYPE_TRIANGULATEDSURFACE:
-        return isValid( g.as< TriangulatedSurface >(), toleranceAbs ) ;
+        return isValid( g.as< TriangulatedSurface >(), toleranceAbs, projected ) ;
 
     case TYPE_POLYHEDRALSURFACE:
-        return isValid( g.as< PolyhedralSurface >(),   toleranceAbs ) ;
+        return isValid( g.as< PolyhedralSurface >(),   toleranceAbs, projected ) ;
     }
 
     BOOST_THROW_EXCEPTION( Exception(
@@ -558,6 +649,16 @@ const Validity isValid( const Geometry& g, const double& toleranceAbs )
     return Validity::invalid( ( boost::format( "isValid( %s ) is not defined" ) % g.geometryType() ).str() ); // to avoid warning
 }
 
+const Validity isValid( const Geometry& g, const double& toleranceAbs )
+{
+    return isValid( g, toleranceAbs, false );
+}
+
+const Validity isValid2D( const Geometry& g, const double& toleranceAbs )
+{
+    return isValid( g, toleranceAbs, true );
+}
+
 void propagateValidityFlag( Geometry& g, bool valid )
 {
     detail::ForceValidityVisitor v( valid );
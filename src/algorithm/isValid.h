@@ -45,6 +45,15 @@ namespace algorithm {
  */
 SFCGAL_API const Validity isValid( const Geometry& g, const double& toleranceAbs= 1e-9 );
 
+/**
+ * @brief Check validity of the XY projection of a geometry
+ *
+ * Gives the same verdict as isValid on a copy of the geometry on which force2D was
+ * applied, without copying it.
+ * @ingroup public_api
+ */
+SFCGAL_API const Validity isValid2D( const Geometry& g, const double& toleranceAbs= 1e-9 );
+
 /**
  * Sets the geometry flag on a geometry and propagate to every internal geometries
  * @ingroup public_api
@@ -57,6 +66,67 @@ SFCGAL_API void propagateValidityFlag( Geometry& g, bool valid );
  */
 struct NoValidityCheck {};
 
+/**
+ * Policy applied by the SFCGAL_ASSERT_GEOMETRY_VALIDITY functions, i.e. by the algorithms
+ * that validate their arguments before computing
+ * @ingroup public_api
+ */
+enum ValidationPolicy {
+    /**
+     * arguments are never validated
+     */
+    VALIDATION_OFF        = 0,
+    /**
+     * arguments are always validated, even if their validity flag is set
+     */
+    VALIDATION_ON         = 1,
+    /**
+     * arguments are validated unless their validity flag is set (default)
+     * @see propagateValidityFlag
+     */
+    VALIDATION_TRUST_FLAG = 2
+};
+
+/**
+ * Sets the global validation policy, used by the threads that have no policy of their own
+ * @ingroup public_api
+ */
+SFCGAL_API void setValidationPolicy( ValidationPolicy policy );
+
+/**
+ * Sets the validation policy of the current thread, it overrides the global one
+ * @ingroup public_api
+ */
+SFCGAL_API void setThreadValidationPolicy( ValidationPolicy policy );
+
+/**
+ * Removes the validation policy of the current thread, the global one applies again
+ * @ingroup public_api
+ */
+SFCGAL_API void resetThreadValidationPolicy();
+
+/**
+ * Returns the validation policy in effect on the current thread
+ * @ingroup public_api
+ */
+SFCGAL_API ValidationPolicy validationPolicy();
+
+/**
+ * Sets the validation policy of the current thread for the lifetime of the object
+ * and restores the previous one on destruction
+ * @ingroup public_api
+ */
+class SFCGAL_API ValidationPolicyScope {
+public:
+    explicit ValidationPolicyScope( ValidationPolicy policy );
+    ~ValidationPolicyScope();
+private:
+    int _previous;
+
+    ValidationPolicyScope( const ValidationPolicyScope& );
+    ValidationPolicyScope& operator=( const ValidationPolicyScope& );
+};
+
 }//algorithm
 }//SFCGAL
 
@@ -23,6 +23,9 @@
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/GeometryCollection.h>
 
+#include <SFCGAL/algorithm/computationMode.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+
 #include <SFCGAL/Exception.h>
 
 namespace SFCGAL {
@@ -66,6 +69,10 @@ double length( const GeometryCollection& g )
 ///
 double length( const Geometry& g )
 {
+    if ( computationMode() == FAST_COMPUTATION ) {
+        return length( g, FastMode() );
+    }
+
     switch ( g.geometryTypeId() ) {
     case TYPE_POINT:
         return 0.0 ;
@@ -96,6 +103,37 @@ double length( const Geometry& g )
     return 0.0 ;
 }
 
+///
+///
+///
+double length( const Geometry& g, FastMode )
+{
+    if ( g.is< LineString >() ) {
+        const LineString& ls = g.as< LineString >();
+        double result = 0.0 ;
+
+        for ( size_t i = 0; i < ls.numSegments(); i++ ) {
+            result += std::sqrt( CGAL::squared_distance(
+                                     detail::toInexactPoint_2( ls.pointN( i ) ),
+                                     detail::toInexactPoint_2( ls.pointN( i+1 ) )
+                                 ) ) ;
+        }
+
+        return result ;
+    }
+
+    if ( g.is< GeometryCollection >() ) {
+        double result = 0.0 ;
+
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            result += length( g.geometryN( i ), FastMode() ) ;
+        }
+
+        return result ;
+    }
+
+    return 0.0 ;
+}
 
 
 //------ 3D
@@ -31,6 +31,7 @@ class GeometryCollection ;
 
 namespace SFCGAL {
 namespace algorithm {
+struct FastMode;
 
 /**
  * @brief Compute the 2D length for a Geometry (0 for incompatible types)
@@ -45,6 +46,12 @@ SFCGAL_API double length( const LineString& g ) ;
  */
 SFCGAL_API double length( const GeometryCollection& g ) ;
 
+/**
+ * @brief Compute the 2D length for a Geometry in double precision (0 for incompatible types)
+ * @see FastMode for the robustness contract
+ */
+SFCGAL_API double length( const Geometry& g, FastMode ) ;
+
 /**
  * @brief Compute the 2D length for a geometry
  * @return the length of the Geometry, 0 for incompatible types
@@ -0,0 +1,462 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/algorithm/relate.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/Exception.h>
+
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/difference.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/GeometrySet.h>
+
+#include <boost/format.hpp>
+
+#include <map>
+#include <memory>
+
+using namespace SFCGAL::detail;
+
+namespace SFCGAL {
+namespace algorithm {
+
+namespace {
+
+//
+// entries of the matrix, in the order of the DE-9IM string
+enum MatrixEntry {
+    II = 0, IB, IE,
+    BI, BB, BE,
+    EI, EB, EE
+};
+
+//
+// the cheapest entries first : boundaries are smaller than the geometries
+// and entries involving the interiors need an intersection and a difference
+const MatrixEntry evaluationOrder[9] = { EE, BB, BE, EB, IB, BI, II, IE, EI };
+
+template <int Dim>
+struct EdgeCounter {
+    typedef typename TypeForDimension<Dim>::Point Point;
+    typedef std::map< std::pair< Point, Point >, int > Map;
+
+    void add( const Point& a, const Point& b ) {
+        if ( a == b ) {
+            return;
+        }
+
+        // edges are counted regardless of their orientation
+        if ( b < a ) {
+            edges[ std::make_pair( b, a ) ]++ ;
+        }
+        else {
+            edges[ std::make_pair( a, b ) ]++ ;
+        }
+    }
+
+    Map edges;
+};
+
+void addSurfaceEdges( const TypeForDimension<2>::Surface& surface, EdgeCounter<2>& counter )
+{
+    for ( CGAL::Polygon_2< Kernel >::Edge_const_iterator it = surface.outer_boundary().edges_begin();
+            it != surface.outer_boundary().edges_end(); ++it ) {
+        counter.add( it->source(), it->target() );
+    }
+
+    for ( TypeForDimension<2>::Surface::Hole_const_iterator hit = surface.holes_begin(); hit != surface.holes_end(); ++hit ) {
+        for ( CGAL::Polygon_2< Kernel >::Edge_const_iterator it = hit->edges_begin(); it != hit->edges_end(); ++it ) {
+            counter.add( it->source(), it->target() );
+        }
+    }
+}
+
+void addSurfaceEdges( const TypeForDimension<3>::Surface& triangle, EdgeCounter<3>& counter )
+{
+    for ( int i = 0; i < 3; i++ ) {
+        counter.add( triangle.vertex( i ), triangle.vertex( i + 1 ) );
+    }
+}
+
+//
+// the volumes of the decomposition are the exterior shells of the solids
+void addSolidsBoundary( const Geometry& g, GeometrySet<3>& output )
+{
+    switch ( g.geometryTypeId() ) {
+    case TYPE_SOLID:
+        if ( ! g.isEmpty() ) {
+            const GeometrySet<3> shell( g.as< Solid >().exteriorShell() );
+            output.addSurfaces( shell.surfaces().begin(), shell.surfaces().end() );
+        }
+
+        break;
+
+    case TYPE_MULTISOLID:
+    case TYPE_GEOMETRYCOLLECTION:
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            addSolidsBoundary( g.geometryN( i ), output );
+        }
+
+        break;
+
+    default:
+        break;
+    }
+}
+
+void addSolidsBoundary( const Geometry&, GeometrySet<2>& )
+{
+}
+
+//
+// Computes the entries of the matrix on demand, the decompositions are built once
+template <int Dim>
+class RelateComputer {
+public:
+    RelateComputer( const Geometry& ga, const Geometry& gb ):
+        _a( ga ), _b( gb ), _disjoint( false ) {
+        boundary( _a, _boundaryA );
+        boundary( _b, _boundaryB );
+        addSolidsBoundary( ga, _boundaryA );
+        addSolidsBoundary( gb, _boundaryB );
+
+        if ( ga.isEmpty() || gb.isEmpty() ) {
+            _disjoint = true ;
+        }
+        else {
+            _disjoint = ! overlaps( ga.envelope(), gb.envelope(), dim_t<Dim>() );
+        }
+    }
+
+    /**
+     * dimension of an entry, -1 if empty
+     */
+    int dimension( MatrixEntry entry ) const {
+        switch ( entry ) {
+        case II:
+            return _disjoint ? -1 : interiorIntersection();
+
+        case IB:
+            return _disjoint ? -1 : interiorBoundary( _a, _boundaryA, _boundaryB );
+
+        case IE:
+            return _disjoint ? _a.dimension() : interiorExterior( _a, _boundaryA, _b );
+
+        case BI:
+            return _disjoint ? -1 : interiorBoundary( _b, _boundaryB, _boundaryA );
+
+        case BB:
+            return _disjoint ? -1 : intersectionDimension( _boundaryA, _boundaryB );
+
+        case BE:
+            return _disjoint ? _boundaryA.dimension() : differenceDimension( _boundaryA, _b );
+
+        case EI:
+            return _disjoint ? _b.dimension() : interiorExterior( _b, _boundaryB, _a );
+
+        case EB:
+            return _disjoint ? _boundaryB.dimension() : differenceDimension( _boundaryB, _a );
+
+        case EE:
+            return Dim;
+        }
+
+        return -1;
+    }
+
+    /**
+     * tests if the boundaries intersect, without computing the intersection
+     */
+    bool boundariesIntersect() const {
+        return ! _disjoint && intersects( _boundaryA, _boundaryB );
+    }
+
+private:
+    GeometrySet<Dim> _a;
+    GeometrySet<Dim> _b;
+    GeometrySet<Dim> _boundaryA;
+    GeometrySet<Dim> _boundaryB;
+    bool _disjoint;
+
+    static bool overlaps( const Envelope& a, const Envelope& b, dim_t<2> ) {
+        return CGAL::do_overlap( a.toBbox_2(), b.toBbox_2() );
+    }
+
+    static bool overlaps( const Envelope& a, const Envelope& b, dim_t<3> ) {
+        return CGAL::do_overlap( a.toBbox_3(), b.toBbox_3() );
+    }
+
+    static int intersectionDimension( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b ) {
+        GeometrySet<Dim> result;
+        intersection( a, b, result );
+        return result.dimension();
+    }
+
+    static int differenceDimension( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b ) {
+        GeometrySet<Dim> result;
+        difference( a, b, result );
+        return result.dimension();
+    }
+
+    //
+    // dimension of a minus a set of lower dimension, which can't change it
+    static int withoutBoundary( const GeometrySet<Dim>& a, const GeometrySet<Dim>& boundaries ) {
+        if ( a.dimension() > boundaries.dimension() ) {
+            return a.dimension();
+        }
+
+        return differenceDimension( a, boundaries );
+    }
+
+    //
+    // (A inter B) minus both boundaries
+    int interiorIntersection() const {
+        GeometrySet<Dim> common;
+        intersection( _a, _b, common );
+
+        GeometrySet<Dim> boundaries;
+        boundaries.merge( _boundaryA );
+        boundaries.merge( _boundaryB );
+        return withoutBoundary( common, boundaries );
+    }
+
+    //
+    // interior of a inter boundary of b : (a inter boundaryB) minus boundaryA
+    static int interiorBoundary( const GeometrySet<Dim>& a, const GeometrySet<Dim>& boundaryA, const GeometrySet<Dim>& boundaryB ) {
+        GeometrySet<Dim> common;
+        intersection( a, boundaryB, common );
+        return withoutBoundary( common, boundaryA );
+    }
+
+    //
+    // interior of a outside of b : (a minus b) minus boundaryA
+    static int interiorExterior( const GeometrySet<Dim>& a, const GeometrySet<Dim>& boundaryA, const GeometrySet<Dim>& b ) {
+        GeometrySet<Dim> outside;
+        difference( a, b, outside );
+        return withoutBoundary( outside, boundaryA );
+    }
+};
+
+char toMatrixChar( int dimension )
+{
+    return dimension < 0 ? 'F' : char( '0' + dimension );
+}
+
+bool matches( int dimension, char pattern )
+{
+    switch ( pattern ) {
+    case '*':
+        return true;
+
+    case 'T':
+    case 't':
+        return dimension >= 0;
+
+    case 'F':
+    case 'f':
+        return dimension < 0;
+
+    default:
+        return dimension == pattern - '0';
+    }
+}
+
+void checkPattern( const std::string& pattern )
+{
+    if ( pattern.size() != 9 || pattern.find_first_not_of( "TtFf*0123" ) != std::string::npos ) {
+        BOOST_THROW_EXCEPTION( Exception(
+                                   ( boost::format( "invalid DE-9IM pattern '%s'" ) % pattern ).str()
+                               ) );
+    }
+}
+
+template <int Dim>
+std::string relateMatrix( const Geometry& ga, const Geometry& gb )
+{
+    const RelateComputer<Dim> computer( ga, gb );
+    std::string matrix( 9, 'F' );
+
+    for ( size_t i = 0; i < 9; i++ ) {
+        matrix[i] = toMatrixChar( computer.dimension( MatrixEntry( i ) ) );
+    }
+
+    return matrix;
+}
+
+template <int Dim>
+bool relatePattern( const Geometry& ga, const Geometry& gb, const std::string& pattern )
+{
+    checkPattern( pattern );
+
+    const RelateComputer<Dim> computer( ga, gb );
+
+    for ( size_t i = 0; i < 9; i++ ) {
+        const MatrixEntry entry = evaluationOrder[i];
+        const char p = pattern[ entry ];
+
+        if ( p == '*' ) {
+            continue;
+        }
+
+        // emptiness of the boundary intersection is a plain intersection test
+        if ( entry == BB && ( p == 'T' || p == 't' || p == 'F' || p == 'f' ) ) {
+            if ( computer.boundariesIntersect() != ( p == 'T' || p == 't' ) ) {
+                return false;
+            }
+
+            continue;
+        }
+
+        if ( ! matches( computer.dimension( entry ), p ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+///
+///
+///
+template <int Dim>
+void boundary( const GeometrySet<Dim>& a, GeometrySet<Dim>& output )
+{
+    // endpoints of an odd number of segments
+    std::map< typename TypeForDimension<Dim>::Point, int > endpoints;
+
+    for ( typename GeometrySet<Dim>::SegmentCollection::const_iterator it = a.segments().begin(); it != a.segments().end(); ++it ) {
+        endpoints[ it->primitive().source() ]++ ;
+        endpoints[ it->primitive().target() ]++ ;
+    }
+
+    for ( typename std::map< typename TypeForDimension<Dim>::Point, int >::const_iterator it = endpoints.begin(); it != endpoints.end(); ++it ) {
+        if ( it->second % 2 == 1 ) {
+            output.addPrimitive( it->first );
+        }
+    }
+
+    // edges of an odd number of surfaces
+    EdgeCounter<Dim> counter;
+
+    for ( typename GeometrySet<Dim>::SurfaceCollection::const_iterator it = a.surfaces().begin(); it != a.surfaces().end(); ++it ) {
+        addSurfaceEdges( it->primitive(), counter );
+    }
+
+    for ( typename EdgeCounter<Dim>::Map::const_iterator it = counter.edges.begin(); it != counter.edges.end(); ++it ) {
+        if ( it->second % 2 == 1 ) {
+            output.addPrimitive( typename TypeForDimension<Dim>::Segment( it->first.first, it->first.second ) );
+        }
+    }
+}
+
+template void boundary<2>( const GeometrySet<2>& a, GeometrySet<2>& output );
+template void boundary<3>( const GeometrySet<3>& a, GeometrySet<3>& output );
+
+///
+///
+///
+bool relateMatches( const std::string& matrix, const std::string& pattern )
+{
+    checkPattern( pattern );
+
+    if ( matrix.size() != 9 ) {
+        BOOST_THROW_EXCEPTION( Exception(
+                                   ( boost::format( "invalid DE-9IM matrix '%s'" ) % matrix ).str()
+                               ) );
+    }
+
+    for ( size_t i = 0; i < 9; i++ ) {
+        const int dimension = ( matrix[i] == 'F' ) ? -1 : matrix[i] - '0' ;
+
+        if ( ! matches( dimension, pattern[i] ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+///
+///
+std::string relate( const Geometry& ga, const Geometry& gb, NoValidityCheck )
+{
+    return relateMatrix<2>( ga, gb );
+}
+
+std::string relate( const Geometry& ga, const Geometry& gb )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( ga );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gb );
+
+    return relateMatrix<2>( ga, gb );
+}
+
+bool relate( const Geometry& ga, const Geometry& gb, const std::string& pattern, NoValidityCheck )
+{
+    return relatePattern<2>( ga, gb, pattern );
+}
+
+bool relate( const Geometry& ga, const Geometry& gb, const std::string& pattern )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( ga );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gb );
+
+    return relatePattern<2>( ga, gb, pattern );
+}
+
+///
+///
+///
+std::string relate3D( const Geometry& ga, const Geometry& gb, NoValidityCheck )
+{
+    return relateMatrix<3>( ga, gb );
+}
+
+std::string relate3D( const Geometry& ga, const Geometry& gb )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( ga );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gb );
+
+    return relateMatrix<3>( ga, gb );
+}
+
+bool relate3D( const Geometry& ga, const Geometry& gb, const std::string& pattern, NoValidityCheck )
+{
+    return relatePattern<3>( ga, gb, pattern );
+}
+
+bool relate3D( const Geometry& ga, const Geometry& gb, const std::string& pattern )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( ga );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gb );
+
+    return relatePattern<3>( ga, gb, pattern );
+}
+
+}//namespace algorithm
+}//namespace SFCGAL
@@ -0,0 +1,137 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_RELATE_H_
+#define _SFCGAL_ALGORITHM_RELATE_H_
+
+#include <SFCGAL/config.h>
+
+#include <string>
+
+namespace SFCGAL {
+class Geometry;
+namespace detail {
+template <int Dim> class GeometrySet;
+}
+
+namespace algorithm {
+struct NoValidityCheck;
+
+/**
+ * Computes the DE-9IM intersection matrix of two 2D geometries. Force projection to z=0 if needed.
+ *
+ * The matrix is returned as a string of 9 characters (II, IB, IE, BI, BB, BE, EI, EB, EE)
+ * taking the values 'F' (empty), '0', '1' or '2' (dimension of the intersection).
+ *
+ * Geometries and their boundaries are decomposed once, the entries are computed with
+ * intersection and difference of the decompositions. Boundaries follow the mod-2 rule :
+ * endpoints of an odd number of segments for lines, edges of an odd number of surfaces
+ * for polygons and polyhedral surfaces.
+ *
+ * @pre ga and gb are valid geometries
+ * @warning heterogeneous GeometryCollection members are not merged (a line on the boundary
+ * of a polygon keeps its own boundary)
+ * @ingroup public_api
+ */
+SFCGAL_API std::string relate( const Geometry& ga, const Geometry& gb );
+
+/**
+ * Computes the DE-9IM intersection matrix of two 2D geometries. No validity check variant
+ * @pre ga and gb are valid geometries
+ * @ingroup detail
+ * @warning No actual validity check is done.
+ */
+SFCGAL_API std::string relate( const Geometry& ga, const Geometry& gb, NoValidityCheck );
+
+/**
+ * Tests the DE-9IM intersection matrix of two 2D geometries against a pattern of 9 characters
+ * among 'T' (not empty), 'F' (empty), '*' (anything), '0', '1' and '2'.
+ *
+ * Only the entries that are not '*' are computed, the cheapest first, and the test stops
+ * at the first entry that doesn't match.
+ *
+ * @pre ga and gb are valid geometries
+ * @throws Exception if the pattern is not valid
+ * @ingroup public_api
+ */
+SFCGAL_API bool relate( const Geometry& ga, const Geometry& gb, const std::string& pattern );
+
+/**
+ * Tests the DE-9IM intersection matrix of two 2D geometries against a pattern. No validity check variant
+ * @pre ga and gb are valid geometries
+ * @ingroup detail
+ * @warning No actual validity check is done.
+ */
+SFCGAL_API bool relate( const Geometry& ga, const Geometry& gb, const std::string& pattern, NoValidityCheck );
+
+/**
+ * Computes the DE-9IM intersection matrix of two 3D geometries. Assume z = 0 if needed.
+ * Dimensions go up to '3' and the exterior-exterior entry is '3'.
+ * @pre ga and gb are valid geometries
+ * @see relate()
+ * @ingroup public_api
+ */
+SFCGAL_API std::string relate3D( const Geometry& ga, const Geometry& gb );
+
+/**
+ * Computes the DE-9IM intersection matrix of two 3D geometries. No validity check variant
+ * @pre ga and gb are valid geometries
+ * @ingroup detail
+ * @warning No actual validity check is done.
+ */
+SFCGAL_API std::string relate3D( const Geometry& ga, const Geometry& gb, NoValidityCheck );
+
+/**
+ * Tests the DE-9IM intersection matrix of two 3D geometries against a pattern, '3' is
+ * accepted as a dimension
+ * @pre ga and gb are valid geometries
+ * @throws Exception if the pattern is not valid
+ * @see relate()
+ * @ingroup public_api
+ */
+SFCGAL_API bool relate3D( const Geometry& ga, const Geometry& gb, const std::string& pattern );
+
+/**
+ * Tests the DE-9IM intersection matrix of two 3D geometries against a pattern. No validity check variant
+ * @pre ga and gb are valid geometries
+ * @ingroup detail
+ * @warning No actual validity check is done.
+ */
+SFCGAL_API bool relate3D( const Geometry& ga, const Geometry& gb, const std::string& pattern, NoValidityCheck );
+
+/**
+ * Tests if a DE-9IM intersection matrix matches a pattern
+ * @throws Exception if the pattern is not valid
+ * @ingroup detail
+ */
+SFCGAL_API bool relateMatches( const std::string& matrix, const std::string& pattern );
+
+/**
+ * Boundary of a decomposition, following the mod-2 rule
+ * @warning the volumes of a are not handled, their boundary has to be added separately
+ * @ingroup detail
+ */
+template <int Dim>
+void boundary( const detail::GeometrySet<Dim>& a, detail::GeometrySet<Dim>& output );
+
+}//namespace algorithm
+}//namespace SFCGAL
+
+#endif
@@ -0,0 +1,353 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/algorithm/spatialJoin.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/distance3d.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/IndexedGeometrySet.h>
+#include <SFCGAL/detail/BoxIntersection.h>
+#include <SFCGAL/detail/tools/ParallelFor.h>
+#include <SFCGAL/index/SpatialIndex.h>
+#include <SFCGAL/GeometryCollection.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+namespace SFCGAL {
+namespace algorithm {
+
+namespace {
+
+typedef std::pair< size_t, size_t > IndexPair;
+
+//
+// members of a collection, or the geometry itself
+std::vector< const Geometry* > joinMembers( const Geometry& g )
+{
+    std::vector< const Geometry* > members;
+
+    if ( g.is< GeometryCollection >() ) {
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            members.push_back( &g.geometryN( i ) );
+        }
+    }
+    else {
+        members.push_back( &g );
+    }
+
+    return members;
+}
+
+//
+// boxes of the non empty members, expanded by a distance
+template < int Dim >
+std::vector< detail::IndexedBox<Dim> > memberBoxes( const std::vector< const Geometry* >& members, double expand )
+{
+    std::vector< detail::IndexedBox<Dim> > boxes;
+    boxes.reserve( members.size() );
+
+    for ( size_t i = 0; i < members.size(); i++ ) {
+        if ( members[i]->isEmpty() ) {
+            continue;
+        }
+
+        detail::IndexedBox<Dim> box( index::SpatialIndex<Dim>::toBox( members[i]->envelope() ), i );
+
+        for ( int k = 0; k < Dim; k++ ) {
+            box.lo[k] -= expand;
+            box.hi[k] += expand;
+        }
+
+        boxes.push_back( box );
+    }
+
+    return boxes;
+}
+
+template < int Dim >
+struct CollectCandidates {
+    CollectCandidates( std::vector< IndexPair >& pairs_ ): pairs( pairs_ ) {}
+
+    bool operator()( const detail::IndexedBox<Dim>& a, const detail::IndexedBox<Dim>& b ) {
+        pairs.push_back( IndexPair( a.index, b.index ) );
+        return true;
+    }
+
+    std::vector< IndexPair >& pairs;
+};
+
+//
+// exact test of a candidate pair
+bool refine( const detail::IndexedGeometrySet<2>& a, const detail::GeometrySet<2>& b, JoinPredicate predicate, double distance )
+{
+    switch ( predicate ) {
+    case JOIN_INTERSECTS:
+        return intersects( a, b );
+
+    case JOIN_COVERS:
+        return covers( a, b );
+
+    default:
+        return dwithin( a, b, distance );
+    }
+}
+
+bool refine( const detail::IndexedGeometrySet<3>& a, const detail::GeometrySet<3>& b, JoinPredicate predicate, double /*distance*/ )
+{
+    if ( predicate == JOIN_COVERS_3D ) {
+        return covers( a, b );
+    }
+
+    return intersects( a, b );
+}
+
+//
+// refines the candidate pairs of a member of a (a group of candidates sharing the same i)
+template < int Dim >
+class RefineGroupTask {
+public:
+    RefineGroupTask(
+        const std::vector< const Geometry* >& a,
+        const std::vector< const Geometry* >& b,
+        const std::vector< std::unique_ptr< detail::GeometrySet<Dim> > >& bSets,
+        const std::vector< IndexPair >& candidates,
+        const std::vector< size_t >& groups,
+        JoinPredicate predicate,
+        double distance,
+        const JoinCallback& callback
+    ):
+        _a( a ), _b( b ), _bSets( bSets ), _candidates( candidates ), _groups( groups ),
+        _predicate( predicate ), _distance( distance ), _callback( callback ) {
+    }
+
+    void operator()( size_t group ) {
+        const size_t begin = _groups[group];
+        const size_t end   = _groups[group + 1];
+        const size_t i     = _candidates[begin].first;
+
+        std::vector< size_t > matches;
+
+        if ( _predicate == JOIN_DWITHIN_3D ) {
+            for ( size_t k = begin; k < end; k++ ) {
+                const size_t j = _candidates[k].second;
+
+                if ( dwithin3D( *_a[i], *_b[j], _distance, NoValidityCheck() ) ) {
+                    matches.push_back( j );
+                }
+            }
+        }
+        else {
+            const detail::IndexedGeometrySet<Dim> indexed( *_a[i] );
+
+            for ( size_t k = begin; k < end; k++ ) {
+                const size_t j = _candidates[k].second;
+
+                if ( refine( indexed, *_bSets[j], _predicate, _distance ) ) {
+                    matches.push_back( j );
+                }
+            }
+        }
+
+        if ( matches.empty() ) {
+            return;
+        }
+
+        std::lock_guard< std::mutex > lock( _callbackMutex );
+
+        for ( size_t k = 0; k < matches.size(); k++ ) {
+            _callback( i, matches[k] );
+        }
+    }
+
+private:
+    const std::vector< const Geometry* >& _a;
+    const std::vector< const Geometry* >& _b;
+    const std::vector< std::unique_ptr< detail::GeometrySet<Dim> > >& _bSets;
+    const std::vector< IndexPair >& _candidates;
+    const std::vector< size_t >& _groups;
+    JoinPredicate _predicate;
+    double _distance;
+    const JoinCallback& _callback;
+    std::mutex _callbackMutex;
+};
+
+//
+// decomposes the members of b that appear in a candidate pair
+template < int Dim >
+class DecomposeTask {
+public:
+    DecomposeTask(
+        const std::vector< const Geometry* >& b,
+        const std::vector< size_t >& used,
+        std::vector< std::unique_ptr< detail::GeometrySet<Dim> > >& bSets
+    ):
+        _b( b ), _used( used ), _bSets( bSets ) {
+    }
+
+    void operator()( size_t k ) {
+        const size_t j = _used[k];
+        _bSets[j].reset( new detail::GeometrySet<Dim>( *_b[j] ) );
+    }
+
+private:
+    const std::vector< const Geometry* >& _b;
+    const std::vector< size_t >& _used;
+    std::vector< std::unique_ptr< detail::GeometrySet<Dim> > >& _bSets;
+};
+
+template < int Dim >
+void spatialJoin(
+    const Geometry& ga,
+    const Geometry& gb,
+    JoinPredicate predicate,
+    const JoinCallback& callback,
+    double distance,
+    size_t numThreads
+)
+{
+    const std::vector< const Geometry* > a = joinMembers( ga );
+    const std::vector< const Geometry* > b = joinMembers( gb );
+
+    // candidate pairs, from a single sweep over the envelopes of the members
+    const bool dwithin = ( predicate == JOIN_DWITHIN || predicate == JOIN_DWITHIN_3D );
+    std::vector< detail::IndexedBox<Dim> > aBoxes = memberBoxes<Dim>( a, dwithin ? distance : 0.0 );
+    std::vector< detail::IndexedBox<Dim> > bBoxes = memberBoxes<Dim>( b, 0.0 );
+
+    std::vector< IndexPair > candidates;
+    CollectCandidates<Dim> collect( candidates );
+    detail::visitIntersectingBoxes( aBoxes.begin(), aBoxes.end(), bBoxes.begin(), bBoxes.end(), collect );
+
+    if ( candidates.empty() ) {
+        return;
+    }
+
+    std::sort( candidates.begin(), candidates.end() );
+
+    // groups of candidates sharing the same member of a
+    std::vector< size_t > groups;
+
+    for ( size_t k = 0; k < candidates.size(); k++ ) {
+        if ( k == 0 || candidates[k].first != candidates[k - 1].first ) {
+            groups.push_back( k );
+        }
+    }
+
+    const size_t numGroups = groups.size();
+    groups.push_back( candidates.size() );
+
+    // members of b are decomposed once
+    std::vector< std::unique_ptr< detail::GeometrySet<Dim> > > bSets( b.size() );
+
+    if ( predicate != JOIN_DWITHIN_3D ) {
+        std::vector< size_t > used;
+
+        for ( size_t k = 0; k < candidates.size(); k++ ) {
+            used.push_back( candidates[k].second );
+        }
+
+        std::sort( used.begin(), used.end() );
+        used.erase( std::unique( used.begin(), used.end() ), used.end() );
+
+        DecomposeTask<Dim> decompose( b, used, bSets );
+        tools::parallelFor( used.size(), numThreads, decompose );
+    }
+
+    RefineGroupTask<Dim> refineGroup( a, b, bSets, candidates, groups, predicate, distance, callback );
+    tools::parallelFor( numGroups, numThreads, refineGroup );
+}
+
+//
+// collects the pairs reported by spatialJoin
+struct CollectPairs {
+    CollectPairs( std::vector< IndexPair >& pairs_ ): pairs( pairs_ ) {}
+
+    void operator()( size_t i, size_t j ) {
+        pairs.push_back( IndexPair( i, j ) );
+    }
+
+    std::vector< IndexPair >& pairs;
+};
+
+}
+
+///
+///
+///
+void spatialJoin(
+    const Geometry& a,
+    const Geometry& b,
+    JoinPredicate predicate,
+    const JoinCallback& callback,
+    double distance,
+    size_t numThreads
+)
+{
+    switch ( predicate ) {
+    case JOIN_INTERSECTS:
+    case JOIN_DWITHIN:
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( a );
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( b );
+        break;
+
+    case JOIN_INTERSECTS_3D:
+    case JOIN_DWITHIN_3D:
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( a );
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( b );
+        break;
+
+    default:
+        break;
+    }
+
+    if ( ( predicate == JOIN_DWITHIN || predicate == JOIN_DWITHIN_3D ) && distance < 0.0 ) {
+        return;
+    }
+
+    if ( predicate == JOIN_INTERSECTS_3D || predicate == JOIN_COVERS_3D || predicate == JOIN_DWITHIN_3D ) {
+        spatialJoin<3>( a, b, predicate, callback, distance, numThreads );
+    }
+    else {
+        spatialJoin<2>( a, b, predicate, callback, distance, numThreads );
+    }
+}
+
+///
+///
+///
+std::vector< std::pair< size_t, size_t > > spatialJoinPairs(
+    const Geometry& a,
+    const Geometry& b,
+    JoinPredicate predicate,
+    double distance,
+    size_t numThreads
+)
+{
+    std::vector< IndexPair > pairs;
+    spatialJoin( a, b, predicate, CollectPairs( pairs ), distance, numThreads );
+    std::sort( pairs.begin(), pairs.end() );
+    return pairs;
+}
+
+}
+}
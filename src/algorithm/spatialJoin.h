@@ -0,0 +1,116 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_ALGORITHM_SPATIALJOIN_H_
+#define _SFCGAL_ALGORITHM_SPATIALJOIN_H_
+
+#include <SFCGAL/config.h>
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace SFCGAL {
+class Geometry;
+
+namespace algorithm {
+
+/**
+ * Predicates of spatialJoin
+ * @ingroup public_api
+ */
+enum JoinPredicate {
+    /**
+     * a intersects b (see intersects)
+     */
+    JOIN_INTERSECTS    = 0,
+    /**
+     * a intersects b in 3D (see intersects3D)
+     */
+    JOIN_INTERSECTS_3D = 1,
+    /**
+     * a covers b (see covers)
+     */
+    JOIN_COVERS        = 2,
+    /**
+     * a covers b in 3D (see covers3D)
+     */
+    JOIN_COVERS_3D     = 3,
+    /**
+     * the distance between a and b is lower than or equal to a given distance (see distance)
+     */
+    JOIN_DWITHIN       = 4,
+    /**
+     * the 3D distance between a and b is lower than or equal to a given distance (see distance3D)
+     */
+    JOIN_DWITHIN_3D    = 5
+};
+
+/**
+ * Called with the positions (i,j) of the members of a matching pair
+ */
+typedef std::function< void ( size_t, size_t ) > JoinCallback;
+
+/**
+ * Spatial join of the members of two collections : calls callback( i, j ) for each pair
+ * of members a.geometryN( i ), b.geometryN( j ) satisfying predicate. A geometry that is
+ * not a collection is its own single member (at position 0), empty members never match.
+ *
+ * Candidate pairs are found with a single sweep over the envelopes of all the members
+ * (expanded by distance for the JOIN_DWITHIN predicates). Each member of a is then
+ * decomposed and indexed once, each member of b decomposed once, and the candidate pairs
+ * are refined with the exact predicate.
+ *
+ * @param distance distance of the JOIN_DWITHIN predicates, ignored by the others
+ * @param numThreads number of threads refining the candidate pairs (1 means sequential)
+ * @pre a and b are valid geometries
+ * @post with numThreads = 1, pairs are reported by increasing i then j. Otherwise the order
+ * is unspecified, and callback is called from the worker threads, one call at a time.
+ * @warning with numThreads > 1, members are read by several threads : they must not be
+ * modified during the call and CGAL must be built with thread support (CGAL_HAS_THREADS)
+ * @ingroup public_api
+ */
+SFCGAL_API void spatialJoin(
+    const Geometry& a,
+    const Geometry& b,
+    JoinPredicate predicate,
+    const JoinCallback& callback,
+    double distance = 0.0,
+    size_t numThreads = 1
+);
+
+/**
+ * Spatial join of the members of two collections, returning the matching pairs (i,j)
+ * sorted by i then j
+ * @see spatialJoin
+ * @ingroup public_api
+ */
+SFCGAL_API std::vector< std::pair< size_t, size_t > > spatialJoinPairs(
+    const Geometry& a,
+    const Geometry& b,
+    JoinPredicate predicate,
+    double distance = 0.0,
+    size_t numThreads = 1
+);
+
+}
+}
+
+#endif
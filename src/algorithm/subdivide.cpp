@@ -0,0 +1,239 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/algorithm/subdivide.h>
+
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/Exception.h>
+
+#include <SFCGAL/algorithm/clip.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/tools/ParallelFor.h>
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace SFCGAL {
+namespace algorithm {
+
+namespace {
+
+typedef std::vector< std::unique_ptr< Polygon > > PolygonVector;
+
+//
+// deeper splits are mostly caused by duplicated points or spikes
+const size_t MAX_DEPTH = 50 ;
+
+struct Piece {
+    Piece( Polygon* polygon_, size_t depth_ ): polygon( polygon_ ), depth( depth_ ) {}
+
+    std::unique_ptr< Polygon > polygon;
+    size_t depth;
+};
+
+size_t numVertices( const Polygon& polygon )
+{
+    size_t n = 0 ;
+
+    for ( size_t i = 0; i < polygon.numRings(); i++ ) {
+        n += polygon.ringN( i ).numPoints();
+    }
+
+    return n;
+}
+
+bool needsSplit( const Piece& piece, size_t maxVertices )
+{
+    if ( piece.depth >= MAX_DEPTH || numVertices( *piece.polygon ) <= maxVertices ) {
+        return false;
+    }
+
+    const Envelope box = piece.polygon->envelope();
+    return box.xMax() > box.xMin() || box.yMax() > box.yMin();
+}
+
+//
+// Clips a polygon by the two halves of its envelope, split along the midline of the longer side
+void split( const Piece& piece, std::vector< Piece >& halves )
+{
+    const Envelope box = piece.polygon->envelope();
+    Envelope parts[2];
+
+    if ( box.xMax() - box.xMin() >= box.yMax() - box.yMin() ) {
+        const double middle = ( box.xMin() + box.xMax() ) / 2.0 ;
+        parts[0] = Envelope( box.xMin(), middle, box.yMin(), box.yMax() );
+        parts[1] = Envelope( middle, box.xMax(), box.yMin(), box.yMax() );
+    }
+    else {
+        const double middle = ( box.yMin() + box.yMax() ) / 2.0 ;
+        parts[0] = Envelope( box.xMin(), box.xMax(), box.yMin(), middle );
+        parts[1] = Envelope( box.xMin(), box.xMax(), middle, box.yMax() );
+    }
+
+    for ( size_t k = 0; k < 2; k++ ) {
+        std::unique_ptr< Geometry > clipped = clip( *piece.polygon, parts[k], NoValidityCheck() );
+
+        if ( clipped->geometryTypeId() == TYPE_POLYGON ) {
+            if ( ! clipped->isEmpty() ) {
+                halves.push_back( Piece( static_cast< Polygon* >( clipped.release() ), piece.depth + 1 ) );
+            }
+
+            continue;
+        }
+
+        for ( size_t i = 0; i < clipped->numGeometries(); i++ ) {
+            halves.push_back( Piece( clipped->as< MultiPolygon >().polygonN( i ).clone(), piece.depth + 1 ) );
+        }
+    }
+}
+
+//
+// Depth first subdivision, pieces are appended from the left (or bottom) half to the right (or top) one
+void subdivide( Piece& piece, size_t maxVertices, PolygonVector& result )
+{
+    if ( ! needsSplit( piece, maxVertices ) ) {
+        result.push_back( std::move( piece.polygon ) );
+        return;
+    }
+
+    std::vector< Piece > halves;
+    split( piece, halves );
+    piece.polygon.reset();
+
+    for ( size_t i = 0; i < halves.size(); i++ ) {
+        subdivide( halves[i], maxVertices, result );
+    }
+}
+
+struct SubdivideTask {
+    SubdivideTask( std::vector< Piece >& pieces_, size_t maxVertices_ ):
+        pieces( pieces_ ), maxVertices( maxVertices_ ), results( pieces_.size() ) {}
+
+    void operator()( size_t i ) {
+        subdivide( pieces[i], maxVertices, results[i] );
+    }
+
+    std::vector< Piece >& pieces;
+    size_t maxVertices;
+    std::vector< PolygonVector > results;
+};
+
+}
+
+///
+///
+///
+std::unique_ptr< MultiPolygon > subdivide( const Geometry& g, size_t maxVertices, size_t numThreads )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+
+    return subdivide( g, maxVertices, numThreads, NoValidityCheck() );
+}
+
+///
+///
+///
+std::unique_ptr< MultiPolygon > subdivide( const Geometry& g, size_t maxVertices, size_t numThreads, NoValidityCheck )
+{
+    if ( maxVertices < 5 ) {
+        BOOST_THROW_EXCEPTION( Exception(
+                                   ( boost::format( "subdivide: maxVertices must be at least 5 (got %d)" ) % maxVertices ).str()
+                               ) );
+    }
+
+    std::vector< Piece > pieces;
+
+    switch ( g.geometryTypeId() ) {
+    case TYPE_POLYGON:
+        pieces.push_back( Piece( g.as< Polygon >().clone(), 0 ) );
+        break;
+
+    case TYPE_TRIANGLE:
+        pieces.push_back( Piece( new Polygon( g.as< Triangle >() ), 0 ) );
+        break;
+
+    case TYPE_MULTIPOLYGON:
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            pieces.push_back( Piece( g.as< MultiPolygon >().polygonN( i ).clone(), 0 ) );
+        }
+
+        break;
+
+    default:
+        BOOST_THROW_EXCEPTION( InappropriateGeometryException(
+                                   ( boost::format( "subdivide(%s) is not supported" ) % g.geometryType() ).str()
+                               ) );
+    }
+
+    // Splits breadth first until there is enough work for the threads. Halves replace
+    // their parent in place, so that the pieces come out in the same order than with
+    // a depth first traversal, whatever the number of threads.
+    numThreads = std::max( numThreads, size_t( 1 ) );
+
+    while ( numThreads > 1 ) {
+        size_t numLarge = 0 ;
+
+        for ( size_t i = 0; i < pieces.size(); i++ ) {
+            if ( needsSplit( pieces[i], maxVertices ) ) {
+                numLarge++ ;
+            }
+        }
+
+        if ( numLarge == 0 || numLarge >= 4 * numThreads ) {
+            break;
+        }
+
+        std::vector< Piece > next;
+
+        for ( size_t i = 0; i < pieces.size(); i++ ) {
+            if ( needsSplit( pieces[i], maxVertices ) ) {
+                split( pieces[i], next );
+            }
+            else {
+                next.push_back( std::move( pieces[i] ) );
+            }
+        }
+
+        pieces.swap( next );
+    }
+
+    SubdivideTask task( pieces, maxVertices );
+    tools::parallelFor( pieces.size(), numThreads, task );
+
+    std::unique_ptr< MultiPolygon > result( new MultiPolygon() );
+
+    for ( size_t i = 0; i < task.results.size(); i++ ) {
+        for ( size_t j = 0; j < task.results[i].size(); j++ ) {
+            if ( ! task.results[i][j]->isEmpty() ) {
+                result->addGeometry( task.results[i][j].release() );
+            }
+        }
+    }
+
+    return result;
+}
+
+}//namespace algorithm
+}//namespace SFCGAL
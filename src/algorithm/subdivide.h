@@ -0,0 +1,67 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_SUBDIVIDE_H_
+#define _SFCGAL_ALGORITHM_SUBDIVIDE_H_
+
+#include <SFCGAL/config.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace SFCGAL {
+class Geometry;
+class MultiPolygon;
+
+namespace algorithm {
+struct NoValidityCheck;
+
+/**
+ * Splits a Polygon, a MultiPolygon or a Triangle in pieces of at most maxVertices vertices.
+ *
+ * Each polygon is recursively clipped in two halves along the midline of the longer side of
+ * its envelope until its rings count at most maxVertices points (closing points included).
+ * Pieces are computed with clip() in double precision, the union of the pieces is the input.
+ * Splitting stops at a depth of 50, so pieces of very dense areas may be larger.
+ *
+ * @param numThreads number of threads splitting the pieces (1 means sequential), the result
+ * doesn't depend on it
+ * @pre g is a valid geometry
+ * @pre maxVertices >= 5
+ * @throws InappropriateGeometryException if g is not a polygon, a multipolygon or a triangle
+ * @warning with numThreads > 1, CGAL must be built with thread support (CGAL_HAS_THREADS)
+ * for the reference counting of the exact numbers
+ * @ingroup public_api
+ */
+SFCGAL_API std::unique_ptr< MultiPolygon > subdivide( const Geometry& g, size_t maxVertices, size_t numThreads = 1 );
+
+/**
+ * Splits a Polygon, a MultiPolygon or a Triangle in pieces of at most maxVertices vertices.
+ * No validity check variant
+ * @pre g is a valid geometry
+ * @ingroup detail
+ * @warning No actual validity check is done.
+ */
+SFCGAL_API std::unique_ptr< MultiPolygon > subdivide( const Geometry& g, size_t maxVertices, size_t numThreads, NoValidityCheck );
+
+}//namespace algorithm
+}//namespace SFCGAL
+
+#endif
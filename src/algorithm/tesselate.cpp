@@ -23,7 +23,12 @@
 #include <SFCGAL/GeometryCollection.h>
 #include <SFCGAL/Solid.h>
 #include <SFCGAL/triangulate/triangulatePolygon.h>
+#include <SFCGAL/PolyhedralSurface.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/computationMode.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+#include <SFCGAL/detail/triangulate/inexactTriangulation.h>
+#include <SFCGAL/detail/triangulate/markDomains.h>
 
 namespace SFCGAL {
 namespace algorithm {
@@ -84,11 +89,116 @@ std::unique_ptr<Geometry> tesselate( const Geometry& g, NoValidityCheck )
 
 std::unique_ptr<Geometry> tesselate( const Geometry& g )
 {
+    if ( computationMode() == FAST_COMPUTATION ) {
+        return tesselate( g, FastMode() );
+    }
+
     SFCGAL_ASSERT_GEOMETRY_VALIDITY( g );
 
     return tesselate( g, NoValidityCheck() );
 }
 
+namespace {
+
+//
+// twice the signed area of a ring projected in the OXY plane, in double precision
+double _projectedArea( const LineString& ring )
+{
+    double result = 0.0 ;
+
+    for ( size_t i = 0; i + 1 < ring.numPoints(); i++ ) {
+        const InexactKernel::Point_2 a = detail::toInexactPoint_2( ring.pointN( i ) );
+        const InexactKernel::Point_2 b = detail::toInexactPoint_2( ring.pointN( i + 1 ) );
+        result += a.x() * b.y() - b.x() * a.y() ;
+    }
+
+    return result ;
+}
+
+void _triangulatePolygon( const Polygon& polygon, TriangulatedSurface& triangulatedSurface )
+{
+    if ( polygon.isEmpty() ) {
+        return ;
+    }
+
+    // a valid polygon that is not vertical keeps its topology once projected in the OXY plane
+    if ( _projectedArea( polygon.exteriorRing() ) != 0.0 ) {
+        triangulate::detail::InexactCDT cdt ;
+        triangulate::detail::insertInexact2DZ( polygon, cdt );
+        triangulate::detail::markDomains( cdt );
+
+        TriangulatedSurface triangles ;
+
+        if ( triangulate::detail::getInexactTriangles( cdt, triangles, true ) ) {
+            triangulatedSurface.addTriangles( triangles );
+            return ;
+        }
+    }
+
+    // vertical polygon or constraints crossing after rounding
+    triangulate::triangulatePolygon3D( polygon, triangulatedSurface );
+}
+
+}
+
+///
+///
+///
+std::unique_ptr<Geometry> tesselate( const Geometry& g, FastMode )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY( g );
+
+    switch ( g.geometryTypeId() ) {
+    case TYPE_POLYGON: {
+        std::unique_ptr<TriangulatedSurface> triSurf( new TriangulatedSurface() );
+        _triangulatePolygon( g.as< Polygon >(), *triSurf );
+        return std::unique_ptr<Geometry>( triSurf.release() );
+    }
+
+    case TYPE_POLYHEDRALSURFACE: {
+        const PolyhedralSurface& surface = g.as< PolyhedralSurface >();
+        std::unique_ptr<TriangulatedSurface> triSurf( new TriangulatedSurface() );
+
+        for ( size_t i = 0; i < surface.numPolygons(); ++i ) {
+            _triangulatePolygon( surface.polygonN( i ), *triSurf );
+        }
+
+        return std::unique_ptr<Geometry>( triSurf.release() );
+    }
+
+    case TYPE_SOLID: {
+        std::unique_ptr<GeometryCollection> ret( new GeometryCollection );
+
+        for ( size_t i = 0; i < g.as<Solid>().numShells(); ++i ) {
+            const PolyhedralSurface& shellN = g.as<Solid>().shellN( i ) ;
+
+            if ( ! shellN.isEmpty() ) {
+                ret->addGeometry( tesselate( shellN, FastMode() ).release() );
+            }
+        }
+
+        return std::unique_ptr<Geometry>( ret.release() );
+    }
+
+    case TYPE_MULTIPOLYGON:
+    case TYPE_MULTISOLID:
+    case TYPE_GEOMETRYCOLLECTION: {
+        std::unique_ptr<GeometryCollection> ret( new GeometryCollection );
+
+        for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+            ret->addGeometry( tesselate( g.geometryN( i ), FastMode() ).release() );
+        }
+
+        return std::unique_ptr<Geometry>( ret.release() );
+    }
+
+    default:
+        break;
+    }
+
+    return std::unique_ptr<Geometry>( g.clone() );
+}
+
 } // namespace algorithm
 } // namespace SFCGAL
 
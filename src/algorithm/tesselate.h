@@ -28,6 +28,7 @@
 namespace SFCGAL {
 namespace algorithm {
 struct NoValidityCheck;
+struct FastMode;
 
 /**
  * Tesselate a geometry: this will triangulate surfaces (including polyhedral and solid's surfaces) and keep untouched
@@ -46,6 +47,15 @@ SFCGAL_API std::unique_ptr<SFCGAL::Geometry> tesselate( const Geometry& );
  */
 SFCGAL_API std::unique_ptr<SFCGAL::Geometry> tesselate( const Geometry&, NoValidityCheck );
 
+/**
+ * Tesselate a geometry with a double precision triangulation. Polygons are triangulated in the OXY plane,
+ * vertical polygons fall back to the exact triangulation in their own plane.
+ * @pre g is a valid geometry
+ * @ingroup public_api
+ * @see FastMode for the robustness contract
+ */
+SFCGAL_API std::unique_ptr<SFCGAL::Geometry> tesselate( const Geometry&, FastMode );
+
 }//algorithm
 }//SFCGAL
 
@@ -22,10 +22,17 @@
 #include <SFCGAL/algorithm/intersection.h>
 #include <SFCGAL/algorithm/union.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/DecomposedGeometry.h>
 #include <SFCGAL/triangulate/triangulate2DZ.h>
 
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Envelope.h>
+
 #include <cstdio>
 #include <algorithm>
+#include <cstdint>
+#include <future>
+#include <vector>
 
 #define DEBUG_OUT if (0) std::cerr << __FILE__ << ":" << __LINE__ << " debug: "
 
@@ -933,19 +940,39 @@ void collectPrimitives( const typename HandledBox<Dim>::Vector& boxes, detail::G
     }
 }
 
-std::unique_ptr<Geometry> union_( const Geometry& ga, const Geometry& gb, NoValidityCheck )
+template <int Dim>
+void union_( const detail::GeometrySet<Dim>& a, const detail::GeometrySet<Dim>& b, detail::GeometrySet<Dim>& output )
 {
-    HandledBox<2>::Vector boxes;
-    compute_bboxes( detail::GeometrySet<2>( ga ), std::back_inserter( boxes ) );
+    typename HandledBox<Dim>::Vector boxes;
+    compute_bboxes( a, std::back_inserter( boxes ) );
     const unsigned numBoxA = boxes.size();
-    compute_bboxes( detail::GeometrySet<2>( gb ), std::back_inserter( boxes ) );
+    compute_bboxes( b, std::back_inserter( boxes ) );
 
     CGAL::box_intersection_d( boxes.begin(), boxes.begin() + numBoxA,
                               boxes.begin() + numBoxA, boxes.end(),
-                              UnionOnBoxCollision<2>() );
+                              UnionOnBoxCollision<Dim>() );
 
-    detail::GeometrySet<2> output;
     collectPrimitives( boxes, output );
+}
+
+template void union_<2>( const detail::GeometrySet<2>& a, const detail::GeometrySet<2>& b, detail::GeometrySet<2>& );
+template void union_<3>( const detail::GeometrySet<3>& a, const detail::GeometrySet<3>& b, detail::GeometrySet<3>& );
+
+template <int Dim>
+DecomposedGeometry<Dim> union_( const DecomposedGeometry<Dim>& a, const DecomposedGeometry<Dim>& b )
+{
+    detail::GeometrySet<Dim> output;
+    union_( a.geometrySet(), b.geometrySet(), output );
+    return DecomposedGeometry<Dim>( std::move( output ) );
+}
+
+template DecomposedGeometry<2> union_<2>( const DecomposedGeometry<2>& a, const DecomposedGeometry<2>& b );
+template DecomposedGeometry<3> union_<3>( const DecomposedGeometry<3>& a, const DecomposedGeometry<3>& b );
+
+std::unique_ptr<Geometry> union_( const Geometry& ga, const Geometry& gb, NoValidityCheck )
+{
+    detail::GeometrySet<2> output;
+    union_( detail::GeometrySet<2>( ga ), detail::GeometrySet<2>( gb ), output );
     return output.recompose();
 }
 
@@ -959,17 +986,8 @@ std::unique_ptr<Geometry> union_( const Geometry& ga, const Geometry& gb )
 
 std::unique_ptr<Geometry> union3D( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 {
-    HandledBox<3>::Vector boxes;
-    compute_bboxes( detail::GeometrySet<3>( ga ), std::back_inserter( boxes ) );
-    const unsigned numBoxA = boxes.size();
-    compute_bboxes( detail::GeometrySet<3>( gb ), std::back_inserter( boxes ) );
-
-    CGAL::box_intersection_d( boxes.begin(), boxes.begin() + numBoxA,
-                              boxes.begin() + numBoxA, boxes.end(),
-                              UnionOnBoxCollision<3>() );
-
     detail::GeometrySet<3> output;
-    collectPrimitives( boxes, output );
+    union_( detail::GeometrySet<3>( ga ), detail::GeometrySet<3>( gb ), output );
     return output.recompose();
 }
 
@@ -982,6 +1000,131 @@ std::unique_ptr<Geometry> union3D( const Geometry& ga, const Geometry& gb )
     return result;
 }
 
+namespace {
+
+//
+// Interleaves the bits of x and y (16 bits each)
+uint32_t mortonCode( uint32_t x, uint32_t y )
+{
+    uint32_t code = 0;
+
+    for ( int i = 0; i < 16; ++i ) {
+        code |= ( ( x >> i ) & 1 ) << ( 2 * i );
+        code |= ( ( y >> i ) & 1 ) << ( 2 * i + 1 );
+    }
+
+    return code;
+}
+
+//
+// Position of v in [min,max] on 16 bits
+uint32_t gridCoordinate( double v, double min, double max )
+{
+    if ( max <= min ) {
+        return 0;
+    }
+
+    return static_cast< uint32_t >( ( v - min ) / ( max - min ) * 65535.0 );
+}
+
+struct UnionMember {
+    uint32_t key;
+    const Geometry* geometry;
+
+    bool operator<( const UnionMember& other ) const {
+        return key < other.key;
+    }
+};
+
+//
+// Union of the members in [begin,end), the left half is computed on another
+// thread while there are threads left. The partial unions stay decomposed,
+// only the final result is recomposed.
+detail::GeometrySet<2> cascadedUnion( const std::vector< UnionMember >& members, size_t begin, size_t end, size_t numThreads )
+{
+    BOOST_ASSERT( begin < end );
+
+    if ( end - begin == 1 ) {
+        return detail::GeometrySet<2>( *members[begin].geometry );
+    }
+
+    detail::GeometrySet<2> output;
+
+    if ( end - begin == 2 ) {
+        union_( detail::GeometrySet<2>( *members[begin].geometry ),
+                detail::GeometrySet<2>( *members[begin + 1].geometry ), output );
+        return output;
+    }
+
+    const size_t middle = begin + ( end - begin ) / 2;
+    detail::GeometrySet<2> left;
+    detail::GeometrySet<2> right;
+
+    if ( numThreads > 1 ) {
+        std::future< detail::GeometrySet<2> > futureLeft = std::async(
+                    std::launch::async, cascadedUnion, std::cref( members ), begin, middle, numThreads / 2
+                );
+        right = cascadedUnion( members, middle, end, numThreads - numThreads / 2 );
+        left = futureLeft.get();
+    }
+    else {
+        left = cascadedUnion( members, begin, middle, 1 );
+        right = cascadedUnion( members, middle, end, 1 );
+    }
+
+    union_( left, right, output );
+    return output;
+}
+
+}
+
+std::unique_ptr<Geometry> unaryUnion( const Geometry& g, size_t numThreads, NoValidityCheck )
+{
+    if ( ! g.is< GeometryCollection >() ) {
+        return union_( g, GeometryCollection(), NoValidityCheck() );
+    }
+
+    const Envelope extent = g.envelope();
+    std::vector< UnionMember > members;
+    members.reserve( g.numGeometries() );
+
+    for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+        const Geometry& member = g.geometryN( i );
+
+        if ( member.isEmpty() ) {
+            continue;
+        }
+
+        const Envelope box = member.envelope();
+        UnionMember m;
+        m.key = mortonCode(
+                    gridCoordinate( ( box.xMin() + box.xMax() ) / 2, extent.xMin(), extent.xMax() ),
+                    gridCoordinate( ( box.yMin() + box.yMax() ) / 2, extent.yMin(), extent.yMax() )
+                );
+        m.geometry = &member;
+        members.push_back( m );
+    }
+
+    if ( members.empty() ) {
+        return std::unique_ptr<Geometry>( new GeometryCollection() );
+    }
+
+    if ( members.size() == 1 ) {
+        return union_( *members[0].geometry, GeometryCollection(), NoValidityCheck() );
+    }
+
+    // stable, for a deterministic result whatever the number of threads
+    std::stable_sort( members.begin(), members.end() );
+
+    return cascadedUnion( members, 0, members.size(), std::max( numThreads, size_t( 1 ) ) ).recompose();
+}
+
+std::unique_ptr<Geometry> unaryUnion( const Geometry& g, size_t numThreads )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+    return unaryUnion( g, numThreads, NoValidityCheck() );
+}
+
 void handleLeakTest()
 {
     Handle<2> h0( Point_2( 0,0 ) );
@@ -23,10 +23,12 @@
 
 #include <SFCGAL/config.h>
 
+#include <cstddef>
 #include <memory>
 
 namespace SFCGAL {
 class Geometry;
+template <int Dim> class DecomposedGeometry;
 namespace detail {
 template <int Dim> class GeometrySet;
 template <int Dim> struct PrimitiveHandle;
@@ -65,6 +67,39 @@ SFCGAL_API std::unique_ptr<Geometry> union3D( const Geometry& ga, const Geometry
  */
 SFCGAL_API std::unique_ptr<Geometry> union3D( const Geometry& ga, const Geometry& gb, NoValidityCheck );
 
+/**
+ * Union of the members of a 2D collection (GeometryCollection, MultiPolygon, ...).
+ *
+ * Members are ordered along a space-filling curve (Morton order of the centers of
+ * their envelopes) and reduced in a balanced tree, so that spatially close members
+ * are unioned first and intermediate results stay small. A geometry that is not a
+ * collection is unioned with itself.
+ *
+ * @param numThreads number of threads used to reduce the subtrees (1 means sequential)
+ * @pre g is a valid geometry
+ * @warning with numThreads > 1, members are read by several threads : they must not be
+ * modified during the call and CGAL must be built with thread support (CGAL_HAS_THREADS)
+ * for the reference counting of the exact numbers
+ * @ingroup public_api
+ */
+SFCGAL_API std::unique_ptr<Geometry> unaryUnion( const Geometry& g, size_t numThreads = 1 );
+
+/**
+ * Union of the members of a 2D collection. No validity check variant
+ * @pre g is a valid geometry
+ * @ingroup detail
+ * @warning No actual validity check is done.
+ */
+SFCGAL_API std::unique_ptr<Geometry> unaryUnion( const Geometry& g, size_t numThreads, NoValidityCheck );
+
+/**
+ * Union of two decomposed geometries, the result is not recomposed
+ * (union3D for Dim = 3)
+ * @ingroup public_api
+ */
+template <int Dim>
+DecomposedGeometry<Dim> union_( const DecomposedGeometry<Dim>& a, const DecomposedGeometry<Dim>& b );
+
 /**
  * @ingroup detail
  */
@@ -33,6 +33,7 @@
 #include <SFCGAL/PolyhedralSurface.h>
 #include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/index/SpatialIndex.h>
 
 #include <SFCGAL/capi/sfcgal_c.h>
 
@@ -43,9 +44,12 @@
 #include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/algorithm/intersects.h>
 #include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/relate.h>
 #include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/clip.h>
 #include <SFCGAL/algorithm/difference.h>
 #include <SFCGAL/algorithm/union.h>
+#include <SFCGAL/algorithm/spatialJoin.h>
 #include <SFCGAL/algorithm/convexHull.h>
 #include <SFCGAL/algorithm/distance.h>
 #include <SFCGAL/algorithm/distance3d.h>
@@ -139,8 +143,29 @@ extern "C" const char* sfcgal_version()
     return SFCGAL::Version();
 }
 
-extern "C" void sfcgal_set_geometry_validation( int /*enabled*/ )
+extern "C" void sfcgal_set_geometry_validation( int enabled )
 {
+    SFCGAL::algorithm::setValidationPolicy( enabled ? SFCGAL::algorithm::VALIDATION_TRUST_FLAG : SFCGAL::algorithm::VALIDATION_OFF );
+}
+
+extern "C" void sfcgal_set_geometry_validation_policy( sfcgal_validation_policy_t policy )
+{
+    SFCGAL::algorithm::setValidationPolicy( ( SFCGAL::algorithm::ValidationPolicy )policy );
+}
+
+extern "C" void sfcgal_set_thread_geometry_validation_policy( sfcgal_validation_policy_t policy )
+{
+    SFCGAL::algorithm::setThreadValidationPolicy( ( SFCGAL::algorithm::ValidationPolicy )policy );
+}
+
+extern "C" void sfcgal_reset_thread_geometry_validation_policy()
+{
+    SFCGAL::algorithm::resetThreadValidationPolicy();
+}
+
+extern "C" sfcgal_validation_policy_t sfcgal_geometry_validation_policy()
+{
+    return ( sfcgal_validation_policy_t )SFCGAL::algorithm::validationPolicy();
 }
 
 extern "C" sfcgal_geometry_type_t sfcgal_geometry_type_id( const sfcgal_geometry_t* geom )
@@ -639,6 +664,198 @@ extern "C" void sfcgal_prepared_geometry_as_ewkt( const sfcgal_prepared_geometry
     )
 }
 
+namespace {
+
+//
+// C handle of a spatial index, whose dimension is chosen at run time
+struct CSpatialIndex {
+    CSpatialIndex( int dimension_ ): dimension( dimension_ ) {
+        if ( dimension != 2 && dimension != 3 ) {
+            BOOST_THROW_EXCEPTION( SFCGAL::Exception( "spatial index dimension must be 2 or 3" ) );
+        }
+    }
+
+    int dimension;
+    SFCGAL::index::SpatialIndex2D index2D;
+    SFCGAL::index::SpatialIndex3D index3D;
+};
+
+inline CSpatialIndex* as_index( sfcgal_index_t* index )
+{
+    return reinterpret_cast<CSpatialIndex*>( index );
+}
+
+inline const CSpatialIndex* as_index( const sfcgal_index_t* index )
+{
+    return reinterpret_cast<const CSpatialIndex*>( index );
+}
+
+CGAL::Bbox_2 to_bbox_2( const double* min_coords, const double* max_coords )
+{
+    return CGAL::Bbox_2( min_coords[0], min_coords[1], max_coords[0], max_coords[1] );
+}
+
+CGAL::Bbox_3 to_bbox_3( const double* min_coords, const double* max_coords )
+{
+    return CGAL::Bbox_3( min_coords[0], min_coords[1], min_coords[2], max_coords[0], max_coords[1], max_coords[2] );
+}
+
+void copy_ids( const std::vector<size_t>& result, size_t** ids, size_t* len )
+{
+    *len = result.size();
+    *ids = ( size_t* )__sfcgal_alloc_handler( std::max( result.size(), size_t( 1 ) ) * sizeof( size_t ) );
+
+    if ( ! result.empty() ) {
+        memcpy( *ids, &result[0], result.size() * sizeof( size_t ) );
+    }
+}
+
+}
+
+extern "C" sfcgal_index_t* sfcgal_index_create( int dimension )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR(
+        return new CSpatialIndex( dimension );
+    )
+}
+
+extern "C" sfcgal_index_t* sfcgal_index_create_from_geometry( const sfcgal_geometry_t* collection, int dimension )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR(
+        std::unique_ptr<CSpatialIndex> index( new CSpatialIndex( dimension ) );
+        const SFCGAL::Geometry* g = reinterpret_cast<const SFCGAL::Geometry*>( collection );
+
+        if ( dimension == 2 ) {
+            index->index2D = SFCGAL::index::SpatialIndex2D( *g );
+        }
+        else {
+            index->index3D = SFCGAL::index::SpatialIndex3D( *g );
+        }
+
+        return index.release();
+    )
+}
+
+extern "C" void sfcgal_index_delete( sfcgal_index_t* index )
+{
+    delete as_index( index );
+}
+
+extern "C" int sfcgal_index_dimension( const sfcgal_index_t* index )
+{
+    return as_index( index )->dimension;
+}
+
+extern "C" size_t sfcgal_index_size( const sfcgal_index_t* index )
+{
+    const CSpatialIndex* i = as_index( index );
+    return i->dimension == 2 ? i->index2D.size() : i->index3D.size();
+}
+
+extern "C" void sfcgal_index_insert_box( sfcgal_index_t* index, const double* min_coords, const double* max_coords, size_t id )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        CSpatialIndex* i = as_index( index );
+
+        if ( i->dimension == 2 ) {
+            i->index2D.insert( to_bbox_2( min_coords, max_coords ), id );
+        }
+        else {
+            i->index3D.insert( to_bbox_3( min_coords, max_coords ), id );
+        }
+    )
+}
+
+extern "C" void sfcgal_index_insert_geometry( sfcgal_index_t* index, const sfcgal_geometry_t* geom, size_t id )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        CSpatialIndex* i = as_index( index );
+        const SFCGAL::Geometry* g = reinterpret_cast<const SFCGAL::Geometry*>( geom );
+
+        if ( i->dimension == 2 ) {
+            i->index2D.insert( *g, id );
+        }
+        else {
+            i->index3D.insert( *g, id );
+        }
+    )
+}
+
+extern "C" void sfcgal_index_build( sfcgal_index_t* index )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        CSpatialIndex* i = as_index( index );
+
+        if ( i->dimension == 2 ) {
+            i->index2D.build();
+        }
+        else {
+            i->index3D.build();
+        }
+    )
+}
+
+extern "C" void sfcgal_index_query_box( const sfcgal_index_t* index, const double* min_coords, const double* max_coords, size_t** ids, size_t* len )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        const CSpatialIndex* i = as_index( index );
+
+        if ( i->dimension == 2 ) {
+            copy_ids( i->index2D.query( to_bbox_2( min_coords, max_coords ) ), ids, len );
+        }
+        else {
+            copy_ids( i->index3D.query( to_bbox_3( min_coords, max_coords ) ), ids, len );
+        }
+    )
+}
+
+extern "C" void sfcgal_index_query_geometry( const sfcgal_index_t* index, const sfcgal_geometry_t* geom, size_t** ids, size_t* len )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        const CSpatialIndex* i = as_index( index );
+        const SFCGAL::Geometry* g = reinterpret_cast<const SFCGAL::Geometry*>( geom );
+
+        if ( i->dimension == 2 ) {
+            copy_ids( i->index2D.candidates( *g ), ids, len );
+        }
+        else {
+            copy_ids( i->index3D.candidates( *g ), ids, len );
+        }
+    )
+}
+
+extern "C" void sfcgal_index_nearest_box( const sfcgal_index_t* index, const double* min_coords, const double* max_coords, size_t k, size_t** ids, size_t* len )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        const CSpatialIndex* i = as_index( index );
+
+        if ( i->dimension == 2 ) {
+            copy_ids( i->index2D.nearest( to_bbox_2( min_coords, max_coords ), k ), ids, len );
+        }
+        else {
+            copy_ids( i->index3D.nearest( to_bbox_3( min_coords, max_coords ), k ), ids, len );
+        }
+    )
+}
+
+extern "C" void sfcgal_index_nearest_geometry( const sfcgal_index_t* index, const sfcgal_geometry_t* geom, size_t k, size_t** ids, size_t* len )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        const CSpatialIndex* i = as_index( index );
+        const SFCGAL::Geometry* g = reinterpret_cast<const SFCGAL::Geometry*>( geom );
+
+        if ( g->isEmpty() ) {
+            copy_ids( std::vector<size_t>(), ids, len );
+        }
+        else if ( i->dimension == 2 ) {
+            copy_ids( i->index2D.nearest( g->envelope(), k ), ids, len );
+        }
+        else {
+            copy_ids( i->index3D.nearest( g->envelope(), k ), ids, len );
+        }
+    )
+}
+
 extern "C" sfcgal_geometry_t* sfcgal_io_read_wkt( const char* str, size_t len )
 {
     SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR(
@@ -674,6 +891,41 @@ extern "C" sfcgal_prepared_geometry_t* sfcgal_io_read_binary_prepared( const cha
     return g.release();
 }
 
+extern "C" void sfcgal_io_write_binary_index( const sfcgal_index_t* index, char** buffer, size_t* len )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        const CSpatialIndex* i = as_index( index );
+        std::string str = i->dimension == 2 ? SFCGAL::io::writeBinaryIndex( i->index2D ) : SFCGAL::io::writeBinaryIndex( i->index3D );
+        *buffer = ( char* )__sfcgal_alloc_handler( str.size() + 1 );
+        *len = str.size();
+        memcpy( *buffer, str.c_str(), *len );
+    )
+}
+
+extern "C" sfcgal_index_t* sfcgal_io_read_binary_index( const char* str, size_t len )
+{
+    std::string sstr( str, len );
+    std::unique_ptr<CSpatialIndex> index;
+
+    try {
+        index.reset( new CSpatialIndex( SFCGAL::io::readBinaryIndexDimension( sstr ) ) );
+
+        if ( index->dimension == 2 ) {
+            index->index2D = *SFCGAL::io::readBinaryIndex<2>( sstr );
+        }
+        else {
+            index->index3D = *SFCGAL::io::readBinaryIndex<3>( sstr );
+        }
+    }
+    catch ( std::exception& e ) {
+        SFCGAL_WARNING( "During read_binary_index" );
+        SFCGAL_ERROR( "%s", e.what() );
+        return 0;
+    }
+
+    return index.release();
+}
+
 extern "C" sfcgal_prepared_geometry_t* sfcgal_io_read_ewkt( const char* str, size_t len )
 {
     std::unique_ptr<SFCGAL::PreparedGeometry> g;
@@ -725,12 +977,126 @@ SFCGAL_GEOMETRY_FUNCTION_BINARY_PREDICATE( covers_3d, SFCGAL::algorithm::covers3
 SFCGAL_GEOMETRY_FUNCTION_BINARY_PREDICATE( intersects, SFCGAL::algorithm::intersects )
 SFCGAL_GEOMETRY_FUNCTION_BINARY_PREDICATE( intersects_3d, SFCGAL::algorithm::intersects3D )
 
+#define SFCGAL_GEOMETRY_FUNCTION_BINARY_MATRIX( name, sfcgal_function ) \
+	extern "C" void sfcgal_geometry_##name( const sfcgal_geometry_t* ga, const sfcgal_geometry_t* gb, char** buffer, size_t* len ) \
+	{								\
+		std::string matrix;						\
+		try							\
+		{							\
+			matrix = sfcgal_function( *(const SFCGAL::Geometry*)(ga), *(const SFCGAL::Geometry*)(gb) ); \
+		}							\
+		catch ( std::exception& e )				\
+		{							\
+			SFCGAL_WARNING( "During " #name "(A,B) :" );	\
+			SFCGAL_WARNING( "  with A: %s", ((const SFCGAL::Geometry*)(ga))->asText().c_str() ); \
+			SFCGAL_WARNING( "   and B: %s", ((const SFCGAL::Geometry*)(gb))->asText().c_str() ); \
+			SFCGAL_ERROR( "%s", e.what() );			\
+			*buffer = NULL;					\
+			*len = 0;					\
+			return;						\
+		}							\
+		*buffer = ( char* )__sfcgal_alloc_handler( matrix.size() + 1 ); \
+		*len = matrix.size();					\
+		strncpy( *buffer, matrix.c_str(), *len + 1 );		\
+	}
+
+SFCGAL_GEOMETRY_FUNCTION_BINARY_MATRIX( relate, SFCGAL::algorithm::relate )
+SFCGAL_GEOMETRY_FUNCTION_BINARY_MATRIX( relate_3d, SFCGAL::algorithm::relate3D )
+
+#define SFCGAL_GEOMETRY_FUNCTION_BINARY_PATTERN_PREDICATE( name, sfcgal_function ) \
+	extern "C" int sfcgal_geometry_##name( const sfcgal_geometry_t* ga, const sfcgal_geometry_t* gb, const char* pattern ) \
+	{								\
+		bool r;							\
+		try							\
+		{							\
+			r = sfcgal_function( *(const SFCGAL::Geometry*)(ga), *(const SFCGAL::Geometry*)(gb), std::string( pattern ) ); \
+		}							\
+		catch ( std::exception& e )				\
+		{							\
+			SFCGAL_WARNING( "During " #name "(A,B,%s) :", pattern ); \
+			SFCGAL_WARNING( "  with A: %s", ((const SFCGAL::Geometry*)(ga))->asText().c_str() ); \
+			SFCGAL_WARNING( "   and B: %s", ((const SFCGAL::Geometry*)(gb))->asText().c_str() ); \
+			SFCGAL_ERROR( "%s", e.what() );			\
+			return -1;						\
+		}							\
+		return r;						\
+	}
+
+SFCGAL_GEOMETRY_FUNCTION_BINARY_PATTERN_PREDICATE( relate_pattern, SFCGAL::algorithm::relate )
+SFCGAL_GEOMETRY_FUNCTION_BINARY_PATTERN_PREDICATE( relate_pattern_3d, SFCGAL::algorithm::relate3D )
+
+#define SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( name, sfcgal_function, ret_type, cpp_type, fail_value ) \
+	extern "C" ret_type sfcgal_prepared_geometry_##name( const sfcgal_prepared_geometry_t* pa, const sfcgal_geometry_t* gb ) \
+	{								\
+		cpp_type r;							\
+		try							\
+		{							\
+			r = sfcgal_function( *(const SFCGAL::PreparedGeometry*)(pa), *(const SFCGAL::Geometry*)(gb) ); \
+		}							\
+		catch ( std::exception& e )				\
+		{							\
+			SFCGAL_WARNING( "During prepared " #name "(A,B) :" ); \
+			SFCGAL_WARNING( "  with A: %s", ((const SFCGAL::PreparedGeometry*)(pa))->geometry().asText().c_str() ); \
+			SFCGAL_WARNING( "   and B: %s", ((const SFCGAL::Geometry*)(gb))->asText().c_str() ); \
+			SFCGAL_ERROR( "%s", e.what() );	\
+			return fail_value;					\
+		}							\
+		return r;					\
+	}
+
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( covers, SFCGAL::algorithm::covers, int, bool, -1 )
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( covers_3d, SFCGAL::algorithm::covers3D, int, bool, -1 )
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( intersects, SFCGAL::algorithm::intersects, int, bool, -1 )
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( intersects_3d, SFCGAL::algorithm::intersects3D, int, bool, -1 )
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( distance, SFCGAL::algorithm::distance, double, double, -1.0 )
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( distance_3d, SFCGAL::algorithm::distance3D, double, double, -1.0 )
+
 #define SFCGAL_GEOMETRY_FUNCTION_BINARY_MEASURE( name, sfcgal_function ) \
 	SFCGAL_GEOMETRY_FUNCTION_BINARY_SCALAR( name, sfcgal_function, double, double, -1.0 )
 
 SFCGAL_GEOMETRY_FUNCTION_BINARY_MEASURE( distance, SFCGAL::algorithm::distance )
 SFCGAL_GEOMETRY_FUNCTION_BINARY_MEASURE( distance_3d, SFCGAL::algorithm::distance3D )
 
+// Distance threshold predicates, returns -1 on failure
+#define SFCGAL_GEOMETRY_FUNCTION_BINARY_DISTANCE_PREDICATE( name, sfcgal_function ) \
+	extern "C" int sfcgal_geometry_##name( const sfcgal_geometry_t* ga, const sfcgal_geometry_t* gb, double distance ) \
+	{								\
+		bool r;							\
+		try							\
+		{							\
+			r = sfcgal_function( *(const SFCGAL::Geometry*)(ga), *(const SFCGAL::Geometry*)(gb), distance ); \
+		}							\
+		catch ( std::exception& e )				\
+		{							\
+			SFCGAL_WARNING( "During " #name "(A,B,%g) :", distance ); \
+			SFCGAL_WARNING( "  with A: %s", ((const SFCGAL::Geometry*)(ga))->asText().c_str() ); \
+			SFCGAL_WARNING( "   and B: %s", ((const SFCGAL::Geometry*)(gb))->asText().c_str() ); \
+			SFCGAL_ERROR( "%s", e.what() );	\
+			return -1;					\
+		}							\
+		return r;					\
+	} \
+	extern "C" int sfcgal_prepared_geometry_##name( const sfcgal_prepared_geometry_t* pa, const sfcgal_geometry_t* gb, double distance ) \
+	{								\
+		bool r;							\
+		try							\
+		{							\
+			r = sfcgal_function( *(const SFCGAL::PreparedGeometry*)(pa), *(const SFCGAL::Geometry*)(gb), distance ); \
+		}							\
+		catch ( std::exception& e )				\
+		{							\
+			SFCGAL_WARNING( "During prepared " #name "(A,B,%g) :", distance ); \
+			SFCGAL_WARNING( "  with A: %s", ((const SFCGAL::PreparedGeometry*)(pa))->geometry().asText().c_str() ); \
+			SFCGAL_WARNING( "   and B: %s", ((const SFCGAL::Geometry*)(gb))->asText().c_str() ); \
+			SFCGAL_ERROR( "%s", e.what() );	\
+			return -1;					\
+		}							\
+		return r;					\
+	}
+
+SFCGAL_GEOMETRY_FUNCTION_BINARY_DISTANCE_PREDICATE( dwithin, SFCGAL::algorithm::dwithin )
+SFCGAL_GEOMETRY_FUNCTION_BINARY_DISTANCE_PREDICATE( dwithin_3d, SFCGAL::algorithm::dwithin3D )
+
 
 #define SFCGAL_GEOMETRY_FUNCTION_BINARY_CONSTRUCTION( name, sfcgal_function ) \
 	extern "C" sfcgal_geometry_t* sfcgal_geometry_##name( const sfcgal_geometry_t* ga, const sfcgal_geometry_t* gb ) \
@@ -758,6 +1124,51 @@ SFCGAL_GEOMETRY_FUNCTION_BINARY_CONSTRUCTION( difference_3d, SFCGAL::algorithm::
 SFCGAL_GEOMETRY_FUNCTION_BINARY_CONSTRUCTION( union, SFCGAL::algorithm::union_ )
 SFCGAL_GEOMETRY_FUNCTION_BINARY_CONSTRUCTION( union_3d, SFCGAL::algorithm::union3D )
 
+extern "C" sfcgal_geometry_t* sfcgal_geometry_unary_union( const sfcgal_geometry_t* ga, int num_threads )
+{
+    std::unique_ptr<SFCGAL::Geometry> result;
+
+    try {
+        result = SFCGAL::algorithm::unaryUnion( *reinterpret_cast<const SFCGAL::Geometry*>( ga ), num_threads > 1 ? size_t( num_threads ) : size_t( 1 ) );
+    }
+    catch ( std::exception& e ) {
+        SFCGAL_WARNING( "During unary_union(A, %d) :", num_threads );
+        SFCGAL_WARNING( "  with A: %s", ( ( const SFCGAL::Geometry* )( ga ) )->asText().c_str() );
+        SFCGAL_ERROR( "%s", e.what() );
+        return 0;
+    }
+
+    return result.release();
+}
+
+extern "C" int sfcgal_geometry_spatial_join( const sfcgal_geometry_t* ga, const sfcgal_geometry_t* gb, sfcgal_join_predicate_t predicate, double distance, int num_threads, sfcgal_join_callback_t callback, void* data )
+{
+    int count = 0;
+
+    try {
+        SFCGAL::algorithm::spatialJoin(
+            *reinterpret_cast<const SFCGAL::Geometry*>( ga ),
+            *reinterpret_cast<const SFCGAL::Geometry*>( gb ),
+            SFCGAL::algorithm::JoinPredicate( predicate ),
+            [&]( size_t i, size_t j ) {
+                ++count;
+                callback( i, j, data );
+            },
+            distance,
+            num_threads > 1 ? size_t( num_threads ) : size_t( 1 )
+        );
+    }
+    catch ( std::exception& e ) {
+        SFCGAL_WARNING( "During spatial_join(A, B, %d) :", int( predicate ) );
+        SFCGAL_WARNING( "  with A: %s", ( ( const SFCGAL::Geometry* )( ga ) )->asText().c_str() );
+        SFCGAL_WARNING( "   and B: %s", ( ( const SFCGAL::Geometry* )( gb ) )->asText().c_str() );
+        SFCGAL_ERROR( "%s", e.what() );
+        return -1;
+    }
+
+    return count;
+}
+
 #define SFCGAL_GEOMETRY_FUNCTION_UNARY_CONSTRUCTION( name, sfcgal_function ) \
 	extern "C" sfcgal_geometry_t* sfcgal_geometry_##name( const sfcgal_geometry_t* ga ) \
 	{								\
@@ -966,6 +1377,24 @@ extern "C" sfcgal_geometry_t* sfcgal_geometry_extrude( const sfcgal_geometry_t*
     return result.release();
 }
 
+extern "C" sfcgal_geometry_t* sfcgal_geometry_clip( const sfcgal_geometry_t* ga, double xmin, double ymin, double xmax, double ymax )
+{
+    const SFCGAL::Geometry* g = reinterpret_cast<const SFCGAL::Geometry*>( ga );
+    std::unique_ptr<SFCGAL::Geometry> result;
+
+    try {
+        result = SFCGAL::algorithm::clip( *g, SFCGAL::Envelope( xmin, xmax, ymin, ymax ) );
+    }
+    catch ( std::exception& e ) {
+        SFCGAL_WARNING( "During clip(A, %g, %g, %g, %g) :", xmin, ymin, xmax, ymax );
+        SFCGAL_WARNING( "  with A: %s", ( ( const SFCGAL::Geometry* )( ga ) )->asText().c_str() );
+        SFCGAL_ERROR( "%s", e.what() );
+        return 0;
+    }
+
+    return result.release();
+}
+
 extern "C" sfcgal_geometry_t* sfcgal_geometry_round( const sfcgal_geometry_t* ga, int scale )
 {
     const SFCGAL::Geometry* g = reinterpret_cast<const SFCGAL::Geometry*>( ga );
@@ -78,13 +78,48 @@ typedef enum {
     SFCGAL_TYPE_MULTISOLID          = 102
 } sfcgal_geometry_type_t ;
 
+/**
+ * Geometry validation policies
+ * @see SFCGAL::algorithm::ValidationPolicy
+ */
+typedef enum {
+    SFCGAL_VALIDATION_OFF        = 0,
+    SFCGAL_VALIDATION_ON         = 1,
+    SFCGAL_VALIDATION_TRUST_FLAG = 2
+} sfcgal_validation_policy_t ;
+
 /**
  * Set the geometry validation mode
+ * @param enabled 0 disables the validation of the arguments, otherwise arguments are validated unless their validity flag is set
  * @ingroup capi
- * @note obsolete
+ * @see sfcgal_set_geometry_validation_policy
  */
 SFCGAL_API void                      sfcgal_set_geometry_validation( int enabled );
 
+/**
+ * Set the global geometry validation policy
+ * @ingroup capi
+ */
+SFCGAL_API void                      sfcgal_set_geometry_validation_policy( sfcgal_validation_policy_t policy );
+
+/**
+ * Set the geometry validation policy of the calling thread, it overrides the global one
+ * @ingroup capi
+ */
+SFCGAL_API void                      sfcgal_set_thread_geometry_validation_policy( sfcgal_validation_policy_t policy );
+
+/**
+ * Remove the geometry validation policy of the calling thread, the global one applies again
+ * @ingroup capi
+ */
+SFCGAL_API void                      sfcgal_reset_thread_geometry_validation_policy();
+
+/**
+ * Returns the geometry validation policy in effect on the calling thread
+ * @ingroup capi
+ */
+SFCGAL_API sfcgal_validation_policy_t sfcgal_geometry_validation_policy();
+
 /**
  * Returns the type of a given geometry
  * @ingroup capi
@@ -226,6 +261,7 @@ SFCGAL_API size_t                    sfcgal_linestring_num_points( const sfcgal_
  * @pre linestring must be a LineString
  * @pre i >= and i < sfcgal_linestring_num_points
  * @post the returned Point is not writable and must not be deallocated by the caller
+ * @post the returned Point is invalidated by sfcgal_linestring_add_point on the same LineString
  * @ingroup capi
  */
 SFCGAL_API const sfcgal_geometry_t*  sfcgal_linestring_point_n( const sfcgal_geometry_t* linestring, size_t i );
@@ -572,6 +608,173 @@ SFCGAL_API void                        sfcgal_prepared_geometry_set_srid( sfcgal
  */
 SFCGAL_API void                        sfcgal_prepared_geometry_as_ewkt( const sfcgal_prepared_geometry_t* prepared, int num_decimals, char** buffer, size_t* len );
 
+/**
+ * Tests the intersection of the geometry of prepared and geom, reusing the decomposition
+ * and the box tree cached in prepared
+ * @pre isValid(prepared geometry) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_prepared_geometry_intersects( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Tests the 3D intersection of the geometry of prepared and geom, reusing the decomposition
+ * and the box tree cached in prepared
+ * @pre isValid(prepared geometry) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_prepared_geometry_intersects_3d( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Tests if the geometry of prepared covers geom, reusing the decomposition and the box tree cached in prepared
+ * @pre isValid(prepared geometry) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_prepared_geometry_covers( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Tests if the geometry of prepared covers geom in 3D, reusing the decomposition and the box tree cached in prepared
+ * @pre isValid(prepared geometry) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_prepared_geometry_covers_3d( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Computes the distance between the geometry of prepared and geom, reusing the decomposition
+ * and the box trees cached in prepared
+ * @pre isValid(prepared geometry) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API double                      sfcgal_prepared_geometry_distance( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Computes the 3D distance between the geometry of prepared and geom, reusing the primitive tree
+ * cached in prepared
+ * @pre isValid(prepared geometry) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API double                      sfcgal_prepared_geometry_distance_3d( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Tests if the distance between the geometry of prepared and geom is lower than or equal to distance,
+ * reusing the envelope, the decomposition and the box trees cached in prepared
+ * @return 1 if within the distance, 0 otherwise, -1 on error
+ * @pre isValid(prepared geometry) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_prepared_geometry_dwithin( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom, double distance );
+
+/**
+ * Tests if the 3D distance between the geometry of prepared and geom is lower than or equal to distance,
+ * reusing the envelope and the primitive tree cached in prepared
+ * @return 1 if within the distance, 0 otherwise, -1 on error
+ * @pre isValid(prepared geometry) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_prepared_geometry_dwithin_3d( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom, double distance );
+
+/*--------------------------------------------------------------------------------------*
+ *
+ * Support for SFCGAL::index::SpatialIndex
+ *
+ *--------------------------------------------------------------------------------------*/
+
+/**
+ * Opaque type that represents a 2D or 3D SFCGAL::index::SpatialIndex
+ * @ingroup capi
+ */
+typedef void sfcgal_index_t;
+
+/**
+ * Creates an empty spatial index
+ * @param dimension 2 or 3
+ * @ingroup capi
+ */
+SFCGAL_API sfcgal_index_t*             sfcgal_index_create( int dimension );
+
+/**
+ * Creates a built spatial index over the members of a collection, identified by their position
+ * @param dimension 2 or 3
+ * @ingroup capi
+ */
+SFCGAL_API sfcgal_index_t*             sfcgal_index_create_from_geometry( const sfcgal_geometry_t* collection, int dimension );
+
+/**
+ * Deletes a spatial index
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_index_delete( sfcgal_index_t* index );
+
+/**
+ * Returns the dimension (2 or 3) of a spatial index
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_index_dimension( const sfcgal_index_t* index );
+
+/**
+ * Returns the number of entries of a spatial index
+ * @ingroup capi
+ */
+SFCGAL_API size_t                      sfcgal_index_size( const sfcgal_index_t* index );
+
+/**
+ * Adds a box to a spatial index
+ * @param min_coords, max_coords arrays of dimension coordinates
+ * @pre sfcgal_index_build was not called
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_index_insert_box( sfcgal_index_t* index, const double* min_coords, const double* max_coords, size_t id );
+
+/**
+ * Adds the envelope of a geometry to a spatial index
+ * @pre sfcgal_index_build was not called
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_index_insert_geometry( sfcgal_index_t* index, const sfcgal_geometry_t* geom, size_t id );
+
+/**
+ * Packs a spatial index, must be called once after the last insertion
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_index_build( sfcgal_index_t* index );
+
+/**
+ * Returns the identifiers of the entries overlapping a box
+ * @param min_coords, max_coords arrays of dimension coordinates
+ * allocates into size_t**, must be freed by the caller
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_index_query_box( const sfcgal_index_t* index, const double* min_coords, const double* max_coords, size_t** ids, size_t* len );
+
+/**
+ * Returns the identifiers of the entries overlapping the envelope of geom
+ * allocates into size_t**, must be freed by the caller
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_index_query_geometry( const sfcgal_index_t* index, const sfcgal_geometry_t* geom, size_t** ids, size_t* len );
+
+/**
+ * Returns the identifiers of the k entries closest to a box, by increasing box distance
+ * @param min_coords, max_coords arrays of dimension coordinates
+ * allocates into size_t**, must be freed by the caller
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_index_nearest_box( const sfcgal_index_t* index, const double* min_coords, const double* max_coords, size_t k, size_t** ids, size_t* len );
+
+/**
+ * Returns the identifiers of the k entries closest to the envelope of geom, by increasing box distance
+ * allocates into size_t**, must be freed by the caller
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_index_nearest_geometry( const sfcgal_index_t* index, const sfcgal_geometry_t* geom, size_t k, size_t** ids, size_t* len );
+
 /*--------------------------------------------------------------------------------------*
  *
  * I/O functions
@@ -590,6 +793,9 @@ SFCGAL_API sfcgal_prepared_geometry_t* sfcgal_io_read_ewkt( const char*, size_t
 /* allocates into char**, must be freed by the caller */
 SFCGAL_API void                        sfcgal_io_write_binary_prepared( const sfcgal_prepared_geometry_t*, char**, size_t* );
 SFCGAL_API sfcgal_prepared_geometry_t* sfcgal_io_read_binary_prepared( const char*, size_t l );
+/* allocates into char**, must be freed by the caller */
+SFCGAL_API void                        sfcgal_io_write_binary_index( const sfcgal_index_t*, char**, size_t* );
+SFCGAL_API sfcgal_index_t*             sfcgal_io_read_binary_index( const char*, size_t l );
 
 /*--------------------------------------------------------------------------------------*
  *
@@ -613,6 +819,42 @@ SFCGAL_API int                         sfcgal_geometry_intersects( const sfcgal_
  */
 SFCGAL_API int                         sfcgal_geometry_intersects_3d( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2 );
 
+/**
+ * Returns the DE-9IM intersection matrix of geom1 and geom2 as a string of 9 characters
+ * @pre isValid(geom1) == true
+ * @pre isValid(geom2) == true
+ * @post buffer is returned allocated and must be freed by the caller
+ * @post on error, buffer is set to NULL and len to 0
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_geometry_relate( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2, char** buffer, size_t* len );
+
+/**
+ * Returns the 3D DE-9IM intersection matrix of geom1 and geom2 as a string of 9 characters
+ * @pre isValid(geom1) == true
+ * @pre isValid(geom2) == true
+ * @post buffer is returned allocated and must be freed by the caller
+ * @post on error, buffer is set to NULL and len to 0
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_geometry_relate_3d( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2, char** buffer, size_t* len );
+
+/**
+ * Tests the DE-9IM intersection matrix of geom1 and geom2 against a pattern (1 if it matches, 0 if not, -1 on error)
+ * @pre isValid(geom1) == true
+ * @pre isValid(geom2) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_geometry_relate_pattern( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2, const char* pattern );
+
+/**
+ * Tests the 3D DE-9IM intersection matrix of geom1 and geom2 against a pattern (1 if it matches, 0 if not, -1 on error)
+ * @pre isValid(geom1) == true
+ * @pre isValid(geom2) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_geometry_relate_pattern_3d( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2, const char* pattern );
+
 /**
  * Returns the intersection of geom1 and geom2
  * @pre isValid(geom1) == true
@@ -622,6 +864,14 @@ SFCGAL_API int                         sfcgal_geometry_intersects_3d( const sfcg
  */
 SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_intersection( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2 );
 
+/**
+ * Returns the part of geom inside the XY rectangle [xmin,xmax]x[ymin,ymax]. The result
+ * is computed in double precision, without the general boolean operations
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_clip( const sfcgal_geometry_t* geom, double xmin, double ymin, double xmax, double ymax );
+
 /**
  * Returns the 3D intersection of geom1 and geom2
  * @pre isValid(geom1) == true
@@ -667,6 +917,46 @@ SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_union( const sfcgal_geome
  */
 SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_union_3d( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2 );
 
+/**
+ * Returns the union of the members of a collection, reduced in a balanced tree of spatially close members
+ * @param num_threads number of threads used (1 means sequential)
+ * @pre isValid(geom) == true
+ * @post isValid(return) == true
+ * @ingroup capi
+ */
+SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_unary_union( const sfcgal_geometry_t* geom, int num_threads );
+
+/**
+ * Predicates of sfcgal_geometry_spatial_join
+ * @see SFCGAL::algorithm::JoinPredicate
+ */
+typedef enum {
+    SFCGAL_JOIN_INTERSECTS    = 0,
+    SFCGAL_JOIN_INTERSECTS_3D = 1,
+    SFCGAL_JOIN_COVERS        = 2,
+    SFCGAL_JOIN_COVERS_3D     = 3,
+    SFCGAL_JOIN_DWITHIN       = 4,
+    SFCGAL_JOIN_DWITHIN_3D    = 5
+} sfcgal_join_predicate_t ;
+
+/**
+ * Called with the positions (i,j) of the members of a matching pair and the user data
+ */
+typedef void ( *sfcgal_join_callback_t )( size_t i, size_t j, void* data );
+
+/**
+ * Spatial join of the members of two collections : calls callback( i, j, data ) for each pair
+ * of members satisfying predicate. Candidate pairs are found with a single sweep over the envelopes
+ * of the members, then refined on num_threads threads.
+ * @param distance distance of the DWITHIN predicates, ignored by the others
+ * @return the number of matching pairs, -1 on error
+ * @pre isValid(geom1) == true
+ * @pre isValid(geom2) == true
+ * @see SFCGAL::algorithm::spatialJoin
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_geometry_spatial_join( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2, sfcgal_join_predicate_t predicate, double distance, int num_threads, sfcgal_join_callback_t callback, void* data );
+
 /**
  * Returns the convex hull of geom
  * @pre isValid(geom) == true
@@ -786,6 +1076,26 @@ SFCGAL_API double                      sfcgal_geometry_distance( const sfcgal_ge
  */
 SFCGAL_API double                      sfcgal_geometry_distance_3d( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2 );
 
+/**
+ * Tests if the distance of the two given Geometry objects is lower than or equal to distance,
+ * without computing the exact distance
+ * @return 1 if within the distance, 0 otherwise, -1 on error
+ * @pre isValid(geom1) == true
+ * @pre isValid(geom2) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_geometry_dwithin( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2, double distance );
+
+/**
+ * Tests if the 3D distance of the two given Geometry objects is lower than or equal to distance,
+ * without computing the exact distance
+ * @return 1 if within the distance, 0 otherwise, -1 on error
+ * @pre isValid(geom1) == true
+ * @pre isValid(geom2) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_geometry_dwithin_3d( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2, double distance );
+
 /**
  * Round coordinates of the given Geometry
  * @pre isValid(geom) == true
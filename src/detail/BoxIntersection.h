@@ -0,0 +1,173 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_BOXINTERSECTION_H_
+#define _SFCGAL_DETAIL_BOXINTERSECTION_H_
+
+#include <SFCGAL/config.h>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace SFCGAL {
+namespace detail {
+
+///
+/// Box of dimension Dim tagged with the index of its primitive in a sequence,
+/// built from a CGAL::Bbox_2 or a CGAL::Bbox_3
+///
+template < int Dim >
+struct IndexedBox {
+    template < typename Bbox >
+    IndexedBox( const Bbox& bbox, size_t index_ ):
+        index( index_ ) {
+        for ( int i = 0; i < Dim; i++ ) {
+            lo[i] = bbox.min( i );
+            hi[i] = bbox.max( i );
+        }
+    }
+
+    static int dimension() {
+        return Dim;
+    }
+    inline double min_coord( int i ) const {
+        return lo[i];
+    }
+    inline double max_coord( int i ) const {
+        return hi[i];
+    }
+
+    double lo[Dim];
+    double hi[Dim];
+    size_t index;
+};
+
+///
+/// Orders boxes by their lower bound on the first axis
+///
+struct LessMinCoord {
+    template < typename Box >
+    bool operator()( const Box& a, const Box& b ) const {
+        return a.min_coord( 0 ) < b.min_coord( 0 );
+    }
+};
+
+///
+/// Tests the overlap of two closed boxes on all axes but the first one
+///
+template < typename Box1, typename Box2 >
+bool overlapOnOtherAxis( const Box1& a, const Box2& b )
+{
+    for ( int i = 1; i < Box1::dimension(); i++ ) {
+        if ( a.max_coord( i ) < b.min_coord( i ) || b.max_coord( i ) < a.min_coord( i ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// Calls callback( a, b ) for each pair of overlapping boxes, a in [begin1,end1) and
+/// b in [begin2,end2), with a sweep on the first axis.
+///
+/// Unlike CGAL::box_intersection_d, the traversal stops as soon as the callback
+/// returns false, which avoids throwing an exception to get out of it.
+///
+/// Boxes follow the CGAL::Box_intersection_d::Box_d interface (dimension(),
+/// min_coord(), max_coord()) and are considered closed. Both ranges are reordered.
+///
+/// Complexity : O(n log n + m log m + k) where k is the number of pairs overlapping on
+/// the first axis, only filtered on the other axes afterwards. The worst case is O(n.m),
+/// for instance with long boxes that all overlap on the first axis but not on the second
+/// one. CGAL::box_intersection_d is output sensitive on all axes and should be preferred
+/// when such inputs are expected and the traversal has no reason to stop early.
+///
+/// @return false if the callback stopped the traversal
+///
+template < typename RandomAccessIterator1, typename RandomAccessIterator2, typename Callback >
+bool visitIntersectingBoxes(
+    RandomAccessIterator1 begin1, RandomAccessIterator1 end1,
+    RandomAccessIterator2 begin2, RandomAccessIterator2 end2,
+    Callback& callback
+)
+{
+    std::sort( begin1, end1, LessMinCoord() );
+    std::sort( begin2, end2, LessMinCoord() );
+
+    while ( begin1 != end1 && begin2 != end2 ) {
+        if ( begin1->min_coord( 0 ) <= begin2->min_coord( 0 ) ) {
+            // boxes of the second range starting within *begin1
+            for ( RandomAccessIterator2 it = begin2; it != end2 && it->min_coord( 0 ) <= begin1->max_coord( 0 ); ++it ) {
+                if ( overlapOnOtherAxis( *begin1, *it ) && ! callback( *begin1, *it ) ) {
+                    return false;
+                }
+            }
+
+            ++begin1;
+        }
+        else {
+            // boxes of the first range starting within *begin2
+            for ( RandomAccessIterator1 it = begin1; it != end1 && it->min_coord( 0 ) <= begin2->max_coord( 0 ); ++it ) {
+                if ( overlapOnOtherAxis( *it, *begin2 ) && ! callback( *it, *begin2 ) ) {
+                    return false;
+                }
+            }
+
+            ++begin2;
+        }
+    }
+
+    return true;
+}
+
+///
+/// Calls callback( a, b ) once for each pair of distinct overlapping boxes
+/// in [begin,end), with a sweep on the first axis. The range is reordered.
+///
+/// Complexity : O(n log n + k) where k is the number of pairs overlapping on the first
+/// axis, O(n^2) in the worst case (see above).
+///
+/// @return false if the callback stopped the traversal
+///
+template < typename RandomAccessIterator, typename Callback >
+bool visitIntersectingBoxes(
+    RandomAccessIterator begin, RandomAccessIterator end,
+    Callback& callback
+)
+{
+    std::sort( begin, end, LessMinCoord() );
+
+    for ( ; begin != end; ++begin ) {
+        RandomAccessIterator it = begin ;
+
+        for ( ++it; it != end && it->min_coord( 0 ) <= begin->max_coord( 0 ); ++it ) {
+            if ( overlapOnOtherAxis( *begin, *it ) && ! callback( *begin, *it ) ) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
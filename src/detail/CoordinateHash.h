@@ -0,0 +1,100 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_COORDINATEHASH_H_
+#define _SFCGAL_DETAIL_COORDINATEHASH_H_
+
+#include <SFCGAL/config.h>
+
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/Coordinate.h>
+
+#include <boost/functional/hash.hpp>
+
+#include <unordered_map>
+
+namespace SFCGAL {
+namespace detail {
+
+///
+/// Hash of the coordinates of an exact point, consistent with the exact equality.
+///
+/// Each coordinate is hashed on its double value : the approximation when it is
+/// exact (a single value interval), the rounding of the exact value otherwise.
+/// Equal exact values always give the same double, whatever their approximation.
+///
+template < typename Point >
+size_t hashPoint( const Point& p, size_t seed = 0 )
+{
+    for ( int i = 0; i < CGAL::approx( p ).dimension(); i++ ) {
+        const CGAL::Interval_nt<false>& c = CGAL::approx( p ).cartesian( i );
+        double value = c.is_point() ? c.inf() : CGAL::to_double( CGAL::exact( p ).cartesian( i ) );
+
+        // -0.0 == 0.0
+        if ( value == 0.0 ) {
+            value = 0.0;
+        }
+
+        boost::hash_combine( seed, value );
+    }
+
+    return seed;
+}
+
+///
+/// Hash functor for Kernel::Point_2, Kernel::Point_3 and Coordinate, for use in
+/// hashed containers keyed on exact coordinates
+///
+struct CoordinateHash {
+    size_t operator()( const Kernel::Point_2& p ) const {
+        return hashPoint( p );
+    }
+    size_t operator()( const Kernel::Point_3& p ) const {
+        return hashPoint( p );
+    }
+    size_t operator()( const Coordinate& c ) const {
+        if ( c.isEmpty() ) {
+            return 0;
+        }
+
+        if ( c.is3D() ) {
+            return hashPoint( c.toPoint_3() );
+        }
+
+        // a 2D coordinate equals the 3D coordinate with z = 0
+        size_t seed = hashPoint( c.toPoint_2() );
+        boost::hash_combine( seed, 0.0 );
+        return seed;
+    }
+};
+
+///
+/// Hashed index of distinct points (Kernel::Point_2, Kernel::Point_3 or Coordinate),
+/// used to weld vertices
+///
+template < typename Key, typename Value >
+struct CoordinateIndex {
+    typedef std::unordered_map< Key, Value, CoordinateHash > Type;
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
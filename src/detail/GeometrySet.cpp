@@ -35,6 +35,8 @@
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/Envelope.h>
 #include <SFCGAL/detail/TypeForDimension.h>
+#include <SFCGAL/detail/BoxIntersection.h>
+#include <SFCGAL/detail/CoordinateHash.h>
 
 #include <SFCGAL/algorithm/covers.h>
 #include <SFCGAL/algorithm/volume.h>
@@ -45,8 +47,6 @@
 
 #include <boost/graph/adjacency_list.hpp>
 
-#include <map>
-
 bool operator< ( const CGAL::Segment_2<SFCGAL::Kernel>& sega, const CGAL::Segment_2<SFCGAL::Kernel>& segb )
 {
     if ( sega.source() == segb.source() ) {
@@ -166,10 +166,13 @@ GeometrySet<Dim>::GeometrySet( const typename TypeForDimension<Dim>::Volume& g,
 template <int Dim>
 void GeometrySet<Dim>::merge( const GeometrySet<Dim>& g )
 {
-    std::copy( g.points().begin(), g.points().end(), std::inserter( points(), points().end() ) );
-    std::copy( g.segments().begin(), g.segments().end(), std::inserter( segments(), segments().end() ) );
-    std::copy( g.surfaces().begin(), g.surfaces().end(), std::back_inserter( surfaces() ) );
-    std::copy( g.volumes().begin(), g.volumes().end(), std::back_inserter( volumes() ) );
+    // both collections are sorted with the same order, the staged primitives of this
+    // set were added first and are kept over the equal ones of g
+    flush();
+    _points.insert( boost::container::ordered_unique_range, g.points().begin(), g.points().end() );
+    _segments.insert( boost::container::ordered_unique_range, g.segments().begin(), g.segments().end() );
+    _surfaces.insert( _surfaces.end(), g.surfaces().begin(), g.surfaces().end() );
+    _volumes.insert( _volumes.end(), g.volumes().begin(), g.volumes().end() );
 }
 
 template <int Dim>
@@ -183,11 +186,11 @@ void GeometrySet<2>::addPrimitive( const PrimitiveHandle<2>& p )
 {
     switch ( p.handle.which() ) {
     case PrimitivePoint:
-        _points.insert( *boost::get<const TypeForDimension<2>::Point*>( p.handle ) );
+        _pendingPoints.push_back( *boost::get<const TypeForDimension<2>::Point*>( p.handle ) );
         break;
 
     case PrimitiveSegment:
-        _segments.insert( *boost::get<const TypeForDimension<2>::Segment*>( p.handle ) );
+        _pendingSegments.push_back( *boost::get<const TypeForDimension<2>::Segment*>( p.handle ) );
         break;
 
     case PrimitiveSurface:
@@ -204,11 +207,11 @@ void GeometrySet<3>::addPrimitive( const PrimitiveHandle<3>& p )
 {
     switch ( p.handle.which() ) {
     case PrimitivePoint:
-        _points.insert( *boost::get<const TypeForDimension<3>::Point*>( p.handle ) );
+        _pendingPoints.push_back( *boost::get<const TypeForDimension<3>::Point*>( p.handle ) );
         break;
 
     case PrimitiveSegment:
-        _segments.insert( *boost::get<const TypeForDimension<3>::Segment*>( p.handle ) );
+        _pendingSegments.push_back( *boost::get<const TypeForDimension<3>::Segment*>( p.handle ) );
         break;
 
     case PrimitiveSurface:
@@ -233,7 +236,7 @@ void GeometrySet<3>::addPrimitive( const CGAL::Object& o, bool pointsAsRing )
     typedef TypeForDimension<3>::Volume TVolume;
 
     if ( const TPoint* p = CGAL::object_cast<TPoint>( &o ) ) {
-        _points.insert( TPoint( *p ) );
+        _pendingPoints.push_back( TPoint( *p ) );
     }
     else if ( const std::vector<TPoint>* pts = CGAL::object_cast<std::vector<TPoint> >( &o ) ) {
         if ( pointsAsRing ) {
@@ -252,11 +255,11 @@ void GeometrySet<3>::addPrimitive( const CGAL::Object& o, bool pointsAsRing )
             _decompose_polygon( poly, _surfaces, dim_t<3>() );
         }
         else {
-            std::copy( pts->begin(), pts->end(), std::inserter( _points, _points.end() ) );
+            addPoints( pts->begin(), pts->end() );
         }
     }
     else if ( const TSegment* p = CGAL::object_cast<TSegment>( &o ) ) {
-        _segments.insert( TSegment( *p ) );
+        _pendingSegments.push_back( TSegment( *p ) );
     }
     else if ( const TSurface* p = CGAL::object_cast<TSurface>( &o ) ) {
         _surfaces.push_back( TSurface( *p ) );
@@ -276,7 +279,7 @@ void GeometrySet<2>::addPrimitive( const CGAL::Object& o, bool pointsAsRing )
     typedef TypeForDimension<2>::Volume TVolume;
 
     if ( const TPoint* p = CGAL::object_cast<TPoint>( &o ) ) {
-        _points.insert( TPoint( *p ) );
+        _pendingPoints.push_back( TPoint( *p ) );
     }
     else if ( const std::vector<TPoint>* pts = CGAL::object_cast<std::vector<TPoint> >( &o ) ) {
         if ( pointsAsRing ) {
@@ -291,7 +294,7 @@ void GeometrySet<2>::addPrimitive( const CGAL::Object& o, bool pointsAsRing )
             _surfaces.push_back( polyh );
         }
         else {
-            std::copy( pts->begin(), pts->end(), std::inserter( _points, _points.end() ) );
+            addPoints( pts->begin(), pts->end() );
         }
     }
     else if ( const CGAL::Triangle_2<Kernel>* tri = CGAL::object_cast<CGAL::Triangle_2<Kernel> >( &o ) ) {
@@ -304,7 +307,7 @@ void GeometrySet<2>::addPrimitive( const CGAL::Object& o, bool pointsAsRing )
         _surfaces.push_back( polyh );
     }
     else if ( const TSegment* p = CGAL::object_cast<TSegment>( &o ) ) {
-        _segments.insert( TSegment( *p ) );
+        _pendingSegments.push_back( TSegment( *p ) );
     }
     else if ( const TSurface* p = CGAL::object_cast<TSurface>( &o ) ) {
         BOOST_ASSERT( ! p->is_unbounded() );
@@ -318,13 +321,13 @@ void GeometrySet<2>::addPrimitive( const CGAL::Object& o, bool pointsAsRing )
 template <int Dim>
 void GeometrySet<Dim>::addPrimitive( const typename TypeForDimension<Dim>::Point& p, int flags )
 {
-    _points.insert( CollectionElement<typename Point_d<Dim>::Type>( p, flags ) );
+    _pendingPoints.push_back( CollectionElement<typename Point_d<Dim>::Type>( p, flags ) );
 }
 
 template <int Dim>
 void GeometrySet<Dim>::addPrimitive( const typename TypeForDimension<Dim>::Segment& p, int flags )
 {
-    _segments.insert( CollectionElement<typename Segment_d<Dim>::Type>( p, flags ) );
+    _pendingSegments.push_back( CollectionElement<typename Segment_d<Dim>::Type>( p, flags ) );
 }
 
 template <>
@@ -433,6 +436,15 @@ bool GeometrySet<3>::hasVolumes() const
 }
 template <int Dim>
 void GeometrySet<Dim>::_decompose( const Geometry& g )
+{
+    _decompose( g, _pendingPoints, _pendingSegments );
+    flush();
+}
+
+template <int Dim>
+void GeometrySet<Dim>::_decompose( const Geometry& g,
+                                   std::vector< typename PointCollection::value_type >& points,
+                                   std::vector< typename SegmentCollection::value_type >& segments )
 {
     if ( g.isEmpty() ) {
         return;
@@ -442,7 +454,7 @@ void GeometrySet<Dim>::_decompose( const Geometry& g )
         const GeometryCollection& collect = g.as<GeometryCollection>();
 
         for ( size_t i = 0; i < g.numGeometries(); ++i ) {
-            _decompose( collect.geometryN( i ) );
+            _decompose( collect.geometryN( i ), points, segments );
         }
 
         return;
@@ -450,16 +462,17 @@ void GeometrySet<Dim>::_decompose( const Geometry& g )
 
     switch ( g.geometryTypeId() ) {
     case TYPE_POINT:
-        _points.insert( g.as<Point>().toPoint_d<Dim>() );
+        points.push_back( g.as<Point>().toPoint_d<Dim>() );
         break;
 
     case TYPE_LINESTRING: {
         const LineString& ls = g.as<LineString>();
+        segments.reserve( segments.size() + ls.numPoints() - 1 );
 
         for ( size_t i = 0; i < ls.numPoints() - 1; ++i ) {
             typename TypeForDimension<Dim>::Segment seg( ls.pointN( i ).toPoint_d<Dim>(),
                     ls.pointN( i+1 ).toPoint_d<Dim>() );
-            _segments.insert( seg );
+            segments.push_back( seg );
         }
 
         break;
@@ -479,7 +492,7 @@ void GeometrySet<Dim>::_decompose( const Geometry& g )
         const TriangulatedSurface& tri = g.as<TriangulatedSurface>();
 
         for ( size_t i = 0; i < tri.numTriangles(); ++i ) {
-            _decompose( tri.triangleN( i ) );
+            _decompose( tri.triangleN( i ), points, segments );
         }
 
         break;
@@ -489,7 +502,7 @@ void GeometrySet<Dim>::_decompose( const Geometry& g )
         const PolyhedralSurface& tri = g.as<PolyhedralSurface>();
 
         for ( size_t i = 0; i < tri.numPolygons(); ++i ) {
-            _decompose( tri.polygonN( i ) );
+            _decompose( tri.polygonN( i ), points, segments );
         }
 
         break;
@@ -511,7 +524,9 @@ template <int Dim>
 void GeometrySet<Dim>::computeBoundingBoxes( typename HandleCollection<Dim>::Type& handles,
         typename BoxCollection<Dim>::Type& boxes ) const
 {
+    flush();
     boxes.clear();
+    boxes.reserve( _points.size() + _segments.size() + _surfaces.size() + _volumes.size() );
 
     for ( typename PointCollection::const_iterator it = _points.begin(); it != _points.end(); ++it ) {
         const typename TypeForDimension<Dim>::Point* pt = &( it->primitive() );
@@ -555,17 +570,6 @@ void recompose_points( const typename GeometrySet<Dim>::PointCollection& points,
     }
 }
 
-// compare less than
-struct ComparePoints {
-    bool operator()( const CGAL::Point_2<Kernel>& lhs, const CGAL::Point_2<Kernel>& rhs ) const {
-        return lhs.x() == rhs.x() ? lhs.y() < rhs.y() : lhs.x() < rhs.x();
-    }
-    bool operator()( const CGAL::Point_3<Kernel>& lhs, const CGAL::Point_3<Kernel>& rhs ) const {
-        return lhs.x() == rhs.x() ? (lhs.y() == rhs.y() ? lhs.z() < rhs.z() : lhs.y() < rhs.y()) : lhs.x() < rhs.x();
-    }
-};
-
-
 template <int Dim>
 void recompose_segments( const typename GeometrySet<Dim>::SegmentCollection& segments,
                          std::vector<Geometry*>& lines,
@@ -584,28 +588,32 @@ void recompose_segments( const typename GeometrySet<Dim>::SegmentCollection& seg
     typedef std::pair<int,int> Edge;
     std::vector<Edge> edges;
     {
-        typedef typename std::map< typename TypeForDimension<Dim>::Point, int, ComparePoints > PointMap;
+        typedef typename TypeForDimension<Dim>::Point TPoint;
+        typedef typename CoordinateIndex< TPoint, int >::Type PointMap;
         PointMap pointMap;
+        pointMap.reserve( 2 * segments.size() );
 
         for ( typename GeometrySet<Dim>::SegmentCollection::const_iterator it = segments.begin();
                 it != segments.end();
                 ++it ) {
-            const typename PointMap::const_iterator foundSource = pointMap.find( it->primitive().source() );
-            const typename PointMap::const_iterator foundTarget = pointMap.find( it->primitive().target() );
-            const int sourceId = foundSource != pointMap.end() ? foundSource->second : points.size();
+            const TPoint source = it->primitive().source();
+            const std::pair< typename PointMap::iterator, bool > foundSource = pointMap.insert( std::make_pair( source, int( points.size() ) ) );
 
-            if ( foundSource == pointMap.end() ) {
-                points.push_back( it->primitive().source() );
-                pointMap[ it->primitive().source() ] = sourceId;
+            if ( foundSource.second ) {
+                points.push_back( source );
             }
 
-            const int targetId = foundTarget != pointMap.end() ? foundTarget->second : points.size();
+            const int sourceId = foundSource.first->second;
 
-            if ( foundTarget == pointMap.end() ) {
-                points.push_back( it->primitive().target() );
-                pointMap[ it->primitive().target() ] = targetId;
+            const TPoint target = it->primitive().target();
+            const std::pair< typename PointMap::iterator, bool > foundTarget = pointMap.insert( std::make_pair( target, int( points.size() ) ) );
+
+            if ( foundTarget.second ) {
+                points.push_back( target );
             }
 
+            const int targetId = foundTarget.first->second;
+
             edges.push_back( Edge( sourceId, targetId ) );
         }
     }
@@ -791,6 +799,7 @@ std::unique_ptr<Geometry> GeometrySet<Dim>::recompose() const
 {
     std::vector<Geometry*> geometries;
 
+    flush();
     recompose_points( _points, geometries, dim_t<Dim>() );
     recompose_segments( _segments, geometries, dim_t<Dim>() );
     recompose_surfaces( _surfaces, geometries, dim_t<Dim>() );
@@ -848,43 +857,31 @@ std::unique_ptr<Geometry> GeometrySet<Dim>::recompose() const
     return std::unique_ptr<Geometry>( ret );
 }
 
-void _collect_points( const CGAL::Polygon_with_holes_2<Kernel>& poly, GeometrySet<2>::PointCollection& points )
+void _collect_points( const CGAL::Polygon_with_holes_2<Kernel>& poly, std::vector< GeometrySet<2>::PointCollection::value_type >& points )
 {
-    for ( CGAL::Polygon_2<Kernel>::Vertex_iterator vit = poly.outer_boundary().vertices_begin();
-            vit != poly.outer_boundary().vertices_end();
-            ++vit ) {
-        points.insert( *vit );
-    }
+    points.insert( points.end(), poly.outer_boundary().vertices_begin(), poly.outer_boundary().vertices_end() );
 
     for ( CGAL::Polygon_with_holes_2<Kernel>::Hole_const_iterator hit = poly.holes_begin();
             hit != poly.holes_end();
             ++hit ) {
-        for ( CGAL::Polygon_2<Kernel>::Vertex_iterator vit = hit->vertices_begin();
-                vit != hit->vertices_end();
-                ++vit ) {
-            points.insert( *vit );
-        }
+        points.insert( points.end(), hit->vertices_begin(), hit->vertices_end() );
     }
 }
 
-void _collect_points( const CGAL::Triangle_3<Kernel>& tri, GeometrySet<3>::PointCollection& points )
+void _collect_points( const CGAL::Triangle_3<Kernel>& tri, std::vector< GeometrySet<3>::PointCollection::value_type >& points )
 {
-    points.insert( tri.vertex( 0 ) );
-    points.insert( tri.vertex( 1 ) );
-    points.insert( tri.vertex( 2 ) );
+    points.push_back( tri.vertex( 0 ) );
+    points.push_back( tri.vertex( 1 ) );
+    points.push_back( tri.vertex( 2 ) );
 }
 
-void _collect_points( const NoVolume&, GeometrySet<2>::PointCollection& )
+void _collect_points( const NoVolume&, std::vector< GeometrySet<2>::PointCollection::value_type >& )
 {
 }
 
-void _collect_points( const MarkedPolyhedron& poly, GeometrySet<3>::PointCollection& points )
+void _collect_points( const MarkedPolyhedron& poly, std::vector< GeometrySet<3>::PointCollection::value_type >& points )
 {
-    for ( MarkedPolyhedron::Vertex_const_iterator vit = poly.vertices_begin();
-            vit != poly.vertices_end();
-            ++vit ) {
-        points.insert( vit->point() );
-    }
+    points.insert( points.end(), poly.points_begin(), poly.points_end() );
 }
 
 template <int Dim>
@@ -895,62 +892,191 @@ void GeometrySet<Dim>::collectPoints( const PrimitiveHandle<Dim>& pa )
     typedef typename TypeForDimension<Dim>::Surface TSurface;
     typedef typename TypeForDimension<Dim>::Volume TVolume;
 
+    std::vector< typename PointCollection::value_type > points;
+
     switch ( pa.handle.which() ) {
     case PrimitivePoint: {
         const TPoint* pt = boost::get<const TPoint*>( pa.handle );
-        _points.insert( *pt );
+        points.push_back( *pt );
         break;
     }
 
     case PrimitiveSegment: {
         const TSegment* seg = boost::get<const TSegment*>( pa.handle );
-        _points.insert( seg->source() );
-        _points.insert( seg->target() );
+        points.push_back( seg->source() );
+        points.push_back( seg->target() );
         break;
     }
 
     case PrimitiveSurface: {
-        _collect_points( *boost::get<const TSurface*>( pa.handle ), _points );
+        _collect_points( *boost::get<const TSurface*>( pa.handle ), points );
         break;
     }
 
     case PrimitiveVolume: {
-        _collect_points( *boost::get<const TVolume*>( pa.handle ), _points );
+        _collect_points( *boost::get<const TVolume*>( pa.handle ), points );
         break;
     }
     }
+
+    _pendingPoints.insert( _pendingPoints.end(), points.begin(), points.end() );
+    flush();
 }
 
-template <int Dim, class IT>
-void _filter_covered( IT ibegin, IT iend, GeometrySet<Dim>& output )
+template <class Primitive>
+CGAL::Bbox_2 _primitive_bbox( const Primitive& p, dim_t<2> )
+{
+    return p.bbox();
+}
+template <class Primitive>
+CGAL::Bbox_3 _primitive_bbox( const Primitive& p, dim_t<3> )
 {
-    for ( IT it = ibegin; it != iend; ++it ) {
+    return p.bbox();
+}
+CGAL::Bbox_2 _primitive_bbox( const NoVolume& p, dim_t<2> )
+{
+    return compute_solid_bbox( p, dim_t<2>() );
+}
+CGAL::Bbox_3 _primitive_bbox( const MarkedPolyhedron& p, dim_t<3> )
+{
+    return compute_solid_bbox( p, dim_t<3>() );
+}
+
+//
+// A primitive of a collection with its flags and its box, the box index
+// is the rank of the primitive in the filterCovered scan
+template <int Dim>
+struct FilteredElements {
+    std::vector< PrimitiveHandle<Dim> > handles;
+    std::vector< int > flags;
+    std::vector< IndexedBox<Dim> > boxes;
+    // end of each collection in the scan order
+    std::vector< size_t > collectionEnds;
+
+    template <class Collection>
+    void add( const Collection& collection ) {
+        for ( typename Collection::const_iterator it = collection.begin(); it != collection.end(); ++it ) {
+            boxes.push_back( IndexedBox<Dim>( _primitive_bbox( it->primitive(), dim_t<Dim>() ), handles.size() ) );
+            handles.push_back( PrimitiveHandle<Dim>( &it->primitive() ) );
+            flags.push_back( it->flags() );
+        }
+
+        collectionEnds.push_back( handles.size() );
+    }
+};
+
+//
+// Records the overlapping boxes of each primitive
+struct NeighboursCollector {
+    std::vector< std::vector< size_t > >& neighbours;
+
+    NeighboursCollector( std::vector< std::vector< size_t > >& neighbours_ ):
+        neighbours( neighbours_ ) {
+    }
+
+    template <class Box>
+    bool operator()( const Box& a, const Box& b ) {
+        neighbours[a.index].push_back( b.index );
+        neighbours[b.index].push_back( a.index );
+        return true;
+    }
+};
+
+//
+// Adds a primitive with the typed addPrimitive (unclosed volumes are split in triangles)
+template <int Dim>
+void _add_filtered( GeometrySet<Dim>& gs, const PrimitiveHandle<Dim>& h, int flags )
+{
+    switch ( h.handle.which() ) {
+    case PrimitivePoint:
+        gs.addPrimitive( *h.template as< typename TypeForDimension<Dim>::Point >(), flags );
+        break;
+
+    case PrimitiveSegment:
+        gs.addPrimitive( *h.template as< typename TypeForDimension<Dim>::Segment >(), flags );
+        break;
+
+    case PrimitiveSurface:
+        gs.addPrimitive( *h.template as< typename TypeForDimension<Dim>::Surface >(), flags );
+        break;
+
+    case PrimitiveVolume:
+        gs.addPrimitive( *h.template as< typename TypeForDimension<Dim>::Volume >(), flags );
+        break;
+    }
+}
+
+//
+// A primitive is removed if it is covered by a primitive that comes later in its collection,
+// or by the primitives already kept. Both can only be primitives whose box overlaps its box,
+// the candidates are found with a sweep on the boxes instead of testing all the pairs.
+template <int Dim>
+void _filter_covered( const FilteredElements<Dim>& elements, GeometrySet<Dim>& output )
+{
+    const size_t n = elements.handles.size();
+    std::vector< std::vector< size_t > > neighbours( n );
+    {
+        std::vector< IndexedBox<Dim> > boxes( elements.boxes );
+        NeighboursCollector collector( neighbours );
+        visitIntersectingBoxes( boxes.begin(), boxes.end(), collector );
+    }
+
+    // primitives already in output are not indexed, fallback on the whole output for them
+    const bool outputWasEmpty = output.dimension() == -1;
+    std::vector< bool > kept( n, false );
+    size_t collection = 0;
+
+    for ( size_t i = 0; i < n; ++i ) {
+        while ( i >= elements.collectionEnds[collection] ) {
+            ++collection;
+        }
+
+        std::sort( neighbours[i].begin(), neighbours[i].end() );
+
         GeometrySet<Dim> v1;
-        v1.addPrimitive( it->primitive() );
+        _add_filtered( v1, elements.handles[i], 0 );
         bool v1_covered = false;
 
-        for ( IT it2 = it; it2 != iend; ++it2 ) {
-            if ( it == it2 ) {
+        for ( size_t k = 0; k < neighbours[i].size() && ! v1_covered; ++k ) {
+            const size_t j = neighbours[i][k];
+
+            if ( j <= i || j >= elements.collectionEnds[collection] ) {
                 continue;
             }
 
             GeometrySet<Dim> v2;
-            v2.addPrimitive( it2->primitive() );
-
-            if ( algorithm::covers( v2, v1 ) ) {
-                v1_covered = true;
-                break;
-            }
+            _add_filtered( v2, elements.handles[j], 0 );
+            v1_covered = algorithm::covers( v2, v1 );
         }
 
         // if its not covered by another primitive
-        if ( !v1_covered ) {
-            // and not covered by another already inserted primitive
-            bool b = algorithm::covers( output, v1 );
+        if ( v1_covered ) {
+            continue;
+        }
 
-            if ( !b ) {
-                output.addPrimitive( it->primitive(), it->flags() );
+        // and not covered by another already inserted primitive
+        bool b;
+
+        if ( outputWasEmpty ) {
+            GeometrySet<Dim> near;
+
+            for ( size_t k = 0; k < neighbours[i].size(); ++k ) {
+                const size_t j = neighbours[i][k];
+
+                if ( kept[j] ) {
+                    _add_filtered( near, elements.handles[j], elements.flags[j] );
+                }
             }
+
+            b = algorithm::covers( near, v1 );
+        }
+        else {
+            b = algorithm::covers( output, v1 );
+        }
+
+        if ( !b ) {
+            _add_filtered( output, elements.handles[i], elements.flags[i] );
+            kept[i] = true;
         }
     }
 }
@@ -1025,10 +1151,13 @@ int GeometrySet<3>::dimension() const
 template <int Dim>
 void GeometrySet<Dim>::filterCovered( GeometrySet<Dim>& output ) const
 {
-    _filter_covered( _volumes.begin(), _volumes.end(), output );
-    _filter_covered( _surfaces.begin(), _surfaces.end(), output );
-    _filter_covered( _segments.begin(), _segments.end(), output );
-    _filter_covered( _points.begin(), _points.end(), output );
+    flush();
+    FilteredElements<Dim> elements;
+    elements.add( _volumes );
+    elements.add( _surfaces );
+    elements.add( _segments );
+    elements.add( _points );
+    _filter_covered( elements, output );
 }
 
 std::ostream& operator<<( std::ostream& ostr, const GeometrySet<2>& g )
@@ -23,8 +23,13 @@
 #define _SFCGAL_DETAIL_GEOMETRY_SET_H_
 
 #include <boost/ptr_container/ptr_vector.hpp>
+#include <boost/container/flat_set.hpp>
 #include <boost/variant.hpp>
 
+#include <algorithm>
+#include <deque>
+#include <vector>
+
 #include <SFCGAL/config.h>
 
 #include <SFCGAL/Kernel.h>
@@ -89,9 +94,10 @@ struct BoxCollection {
 
 ///
 /// HandleCollection. Used to store PrimitiveHandle
+/// The boxes point to the handles, a deque keeps their address when it grows
 template <int Dim>
 struct HandleCollection {
-    typedef std::list<PrimitiveHandle<Dim> > Type;
+    typedef std::deque<PrimitiveHandle<Dim> > Type;
 };
 
 ///
@@ -139,6 +145,107 @@ private:
     int _flags;
 };
 
+///
+/// Lexicographic comparison of the interval approximations of two points.
+/// Returns -1, 1, 0 if the coordinates are identical and exactly known, or
+/// APPROX_UNDECIDED when an exact comparison is needed.
+const int APPROX_UNDECIDED = 2;
+
+template <class IntervalPoint>
+int compareApprox( const IntervalPoint& a, const IntervalPoint& b )
+{
+    for ( int i = 0; i < a.dimension(); ++i ) {
+        const CGAL::Interval_nt<false>& ia = a.cartesian( i );
+        const CGAL::Interval_nt<false>& ib = b.cartesian( i );
+
+        if ( ia.sup() < ib.inf() ) {
+            return -1;
+        }
+
+        if ( ia.inf() > ib.sup() ) {
+            return 1;
+        }
+
+        if ( ! ia.is_point() || ! ib.is_point() ) {
+            return APPROX_UNDECIDED;
+        }
+    }
+
+    return 0;
+}
+
+///
+/// Filtered comparison of points and segments : the double approximations
+/// decide most comparisons, the exact numbers are only compared when they overlap.
+/// Same order as operator<
+template <class Point>
+bool filteredPointLess( const Point& a, const Point& b )
+{
+    const int c = compareApprox( CGAL::approx( a ), CGAL::approx( b ) );
+
+    if ( c == APPROX_UNDECIDED ) {
+        return a < b;
+    }
+
+    return c < 0;
+}
+
+template <class Segment>
+bool filteredSegmentLess( const Segment& a, const Segment& b )
+{
+    const int c = compareApprox( CGAL::approx( a ).source(), CGAL::approx( b ).source() );
+
+    if ( c == 0 ) {
+        const int ct = compareApprox( CGAL::approx( a ).target(), CGAL::approx( b ).target() );
+
+        if ( ct != APPROX_UNDECIDED ) {
+            return ct < 0;
+        }
+    }
+    else if ( c != APPROX_UNDECIDED ) {
+        return c < 0;
+    }
+
+    return a < b;
+}
+
+///
+/// Ordering of the CollectionElement in the point and segment collections
+struct CollectionElementLess {
+    template <class Kernel_>
+    bool operator()( const CollectionElement< CGAL::Point_2<Kernel_> >& a, const CollectionElement< CGAL::Point_2<Kernel_> >& b ) const {
+        return filteredPointLess( a.primitive(), b.primitive() );
+    }
+    template <class Kernel_>
+    bool operator()( const CollectionElement< CGAL::Point_3<Kernel_> >& a, const CollectionElement< CGAL::Point_3<Kernel_> >& b ) const {
+        return filteredPointLess( a.primitive(), b.primitive() );
+    }
+    template <class Kernel_>
+    bool operator()( const CollectionElement< CGAL::Segment_2<Kernel_> >& a, const CollectionElement< CGAL::Segment_2<Kernel_> >& b ) const {
+        return filteredSegmentLess( a.primitive(), b.primitive() );
+    }
+    template <class Kernel_>
+    bool operator()( const CollectionElement< CGAL::Segment_3<Kernel_> >& a, const CollectionElement< CGAL::Segment_3<Kernel_> >& b ) const {
+        return filteredSegmentLess( a.primitive(), b.primitive() );
+    }
+};
+
+///
+/// Bulk insertion in a point or segment collection : the new elements are sorted
+/// and made unique, then merged in one pass. As with a std::set, an element already
+/// in the collection (or inserted first) is kept.
+template <class Collection>
+void insertSorted( Collection& collection, std::vector< typename Collection::value_type >& elements )
+{
+    typename Collection::value_compare less = collection.value_comp();
+    std::stable_sort( elements.begin(), elements.end(), less );
+    elements.erase( std::unique( elements.begin(), elements.end(),
+    [&less]( const typename Collection::value_type& a, const typename Collection::value_type& b ) {
+        return ! less( a, b );
+    } ), elements.end() );
+    collection.insert( boost::container::ordered_unique_range, elements.begin(), elements.end() );
+}
+
 template <class Primitive>
 std::ostream& operator<<( std::ostream& ostr, const CollectionElement<Primitive>& p )
 {
@@ -151,15 +258,23 @@ std::ostream& operator<<( std::ostream& ostr, const CollectionElement<Primitive>
 /// Primitive are either of dimension 0 (points),
 /// dimension 1 (segments), dimension 2 (surfaces, a.k.a. polygon or triangles)
 /// or dimension 3 (polyhedron)
+///
+/// Points and segments added one at a time are staged in unsorted buffers and merged
+/// in the sorted collections in one pass by the next read (points(), segments(),
+/// computeBoundingBoxes(), ...), so that a set built by repeated addPrimitive stays
+/// O(n log n). Handles on points and segments stay valid while primitives are added,
+/// until that merge. As it may happen in a const method, flush() must be called
+/// before sharing a set between threads (sets built from a Geometry or by a bulk
+/// insertion have nothing staged).
 template <int Dim>
 class GeometrySet {
 public:
-    // Points are stored in an ordered set
-    typedef std::set<CollectionElement<typename Point_d<Dim>::Type> > PointCollection;
-    // Segments are stored in an ordered set
-    typedef std::set<CollectionElement<typename Segment_d<Dim>::Type> > SegmentCollection;
-    typedef std::list<CollectionElement<typename Surface_d<Dim>::Type> > SurfaceCollection;
-    typedef std::list<CollectionElement<typename Volume_d<Dim>::Type> > VolumeCollection;
+    // Points are stored in an ordered set (sorted vector)
+    typedef boost::container::flat_set<CollectionElement<typename Point_d<Dim>::Type>, CollectionElementLess > PointCollection;
+    // Segments are stored in an ordered set (sorted vector)
+    typedef boost::container::flat_set<CollectionElement<typename Segment_d<Dim>::Type>, CollectionElementLess > SegmentCollection;
+    typedef std::vector<CollectionElement<typename Surface_d<Dim>::Type> > SurfaceCollection;
+    typedef std::vector<CollectionElement<typename Volume_d<Dim>::Type> > VolumeCollection;
 
     GeometrySet();
 
@@ -215,7 +330,8 @@ public:
     void addPrimitive( const typename TypeForDimension<Dim>::Point& g, int flags = 0 );
     template <class IT>
     void addPoints( IT ibegin, IT iend ) {
-        std::copy( ibegin, iend, std::inserter( _points, _points.end() ) );
+        _pendingPoints.insert( _pendingPoints.end(), ibegin, iend );
+        flush();
     }
 
     /**
@@ -229,7 +345,8 @@ public:
     void addPrimitive( const typename TypeForDimension<Dim>::Segment& g, int flags = 0 );
     template <class IT>
     void addSegments( IT ibegin, IT iend ) {
-        std::copy( ibegin, iend, std::inserter( _segments, _segments.end() ) );
+        _pendingSegments.insert( _pendingSegments.end(), ibegin, iend );
+        flush();
     }
 
     /**
@@ -238,7 +355,7 @@ public:
     void addPrimitive( const typename TypeForDimension<Dim>::Surface& g, int flags = 0 );
     template <class IT>
     void addSurfaces( IT ibegin, IT iend ) {
-        std::copy( ibegin, iend, std::back_inserter( _surfaces ) );
+        _surfaces.insert( _surfaces.end(), ibegin, iend );
     }
 
     /**
@@ -247,7 +364,7 @@ public:
     void addPrimitive( const typename TypeForDimension<Dim>::Volume& g, int flags = 0 );
     template <class IT>
     void addVolumes( IT ibegin, IT iend ) {
-        std::copy( ibegin, iend, std::back_inserter( _volumes ) );
+        _volumes.insert( _volumes.end(), ibegin, iend );
     }
 
     /**
@@ -276,16 +393,20 @@ public:
     void computeBoundingBoxes( typename HandleCollection<Dim>::Type& handles, typename BoxCollection<Dim>::Type& boxes ) const;
 
     inline PointCollection& points() {
+        flush();
         return _points;
     }
     inline const PointCollection& points() const {
+        flush();
         return _points;
     }
 
     inline SegmentCollection& segments() {
+        flush();
         return _segments;
     }
     inline const SegmentCollection& segments() const {
+        flush();
         return _segments;
     }
 
@@ -330,15 +451,41 @@ public:
      */
     void filterCovered( GeometrySet<Dim>& output ) const;
 
+    /**
+     * Merges the staged points and segments in the sorted collections. Done by
+     * every read, only needed before sharing the set between threads.
+     */
+    inline void flush() const {
+        if ( ! _pendingPoints.empty() ) {
+            insertSorted( _points, _pendingPoints );
+            _pendingPoints.clear();
+        }
+
+        if ( ! _pendingSegments.empty() ) {
+            insertSorted( _segments, _pendingSegments );
+            _pendingSegments.clear();
+        }
+    }
+
 private:
     ///
     /// Given an input SFCGAL::Geometry, decompose it into CGAL primitives
     void _decompose( const Geometry& g );
-
-    PointCollection _points;
-    SegmentCollection _segments;
+    ///
+    /// Recursive decomposition, points and segments are collected for a bulk insertion
+    void _decompose( const Geometry& g,
+                     std::vector< typename PointCollection::value_type >& points,
+                     std::vector< typename SegmentCollection::value_type >& segments );
+
+    // mutable : the staged primitives are merged by the first read
+    mutable PointCollection _points;
+    mutable SegmentCollection _segments;
     SurfaceCollection _surfaces;
     VolumeCollection _volumes;
+
+    // points and segments added one at a time, in insertion order
+    mutable std::vector< typename PointCollection::value_type > _pendingPoints;
+    mutable std::vector< typename SegmentCollection::value_type > _pendingSegments;
 };
 
 ///
@@ -0,0 +1,141 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/detail/IndexedGeometrySet.h>
+
+#include <SFCGAL/Exception.h>
+
+namespace SFCGAL {
+namespace detail {
+
+///
+///
+///
+CGAL::Bbox_2 primitiveBbox( const PrimitiveBox<2>::Type& box )
+{
+    return CGAL::Bbox_2( box.min_coord( 0 ), box.min_coord( 1 ), box.max_coord( 0 ), box.max_coord( 1 ) );
+}
+
+///
+///
+///
+CGAL::Bbox_3 primitiveBbox( const PrimitiveBox<3>::Type& box )
+{
+    return CGAL::Bbox_3(
+               box.min_coord( 0 ), box.min_coord( 1 ), box.min_coord( 2 ),
+               box.max_coord( 0 ), box.max_coord( 1 ), box.max_coord( 2 )
+           );
+}
+
+///
+///
+///
+void GeometrySetBoundary2::collect( const GeometrySet<2>& gs )
+{
+    for ( GeometrySet<2>::PointCollection::const_iterator it = gs.points().begin(); it != gs.points().end(); ++it ) {
+        points.push_back( it->primitive() );
+    }
+
+    for ( GeometrySet<2>::SegmentCollection::const_iterator it = gs.segments().begin(); it != gs.segments().end(); ++it ) {
+        segments.push_back( it->primitive() );
+    }
+
+    for ( GeometrySet<2>::SurfaceCollection::const_iterator it = gs.surfaces().begin(); it != gs.surfaces().end(); ++it ) {
+        const CGAL::Polygon_with_holes_2< Kernel >& polygon = it->primitive();
+        segments.insert( segments.end(), polygon.outer_boundary().edges_begin(), polygon.outer_boundary().edges_end() );
+
+        for ( CGAL::Polygon_with_holes_2< Kernel >::Hole_const_iterator hit = polygon.holes_begin(); hit != polygon.holes_end(); ++hit ) {
+            segments.insert( segments.end(), hit->edges_begin(), hit->edges_end() );
+        }
+    }
+}
+
+///
+///
+///
+template < int Dim >
+IndexedGeometrySet<Dim>::IndexedGeometrySet( const Geometry& g ):
+    _geometrySet( g )
+{
+    _geometrySet.computeBoundingBoxes( _handles, _boxes );
+
+    for ( typename BoxCollection<Dim>::Type::const_iterator it = _boxes.begin(); it != _boxes.end(); ++it ) {
+        _tree.insert( primitiveBbox( *it ), it->handle() );
+    }
+
+    _tree.build();
+}
+
+///
+///
+///
+template <>
+void IndexedGeometrySet<2>::_buildBoundary() const
+{
+    std::unique_ptr< GeometrySetBoundary2 > elements( new GeometrySetBoundary2 );
+    elements->collect( _geometrySet );
+
+    std::unique_ptr< BoundaryTree > tree( new BoundaryTree );
+
+    for ( size_t i = 0; i < elements->points.size(); i++ ) {
+        tree->insert( elements->points[i].bbox(), i );
+    }
+
+    for ( size_t i = 0; i < elements->segments.size(); i++ ) {
+        tree->insert( elements->segments[i].bbox(), elements->points.size() + i );
+    }
+
+    tree->build();
+
+    _boundary.reset( elements.release() );
+    _boundaryTree.reset( tree.release() );
+}
+
+template <>
+void IndexedGeometrySet<3>::_buildBoundary() const
+{
+    BOOST_THROW_EXCEPTION( NotImplementedException( "boundary elements are only available for 2D sets" ) );
+}
+
+///
+///
+///
+template < int Dim >
+const GeometrySetBoundary2& IndexedGeometrySet<Dim>::boundary() const
+{
+    std::call_once( _boundaryFlag, &IndexedGeometrySet<Dim>::_buildBoundary, this );
+    return *_boundary ;
+}
+
+///
+///
+///
+template < int Dim >
+const typename IndexedGeometrySet<Dim>::BoundaryTree& IndexedGeometrySet<Dim>::boundaryTree() const
+{
+    std::call_once( _boundaryFlag, &IndexedGeometrySet<Dim>::_buildBoundary, this );
+    return *_boundaryTree ;
+}
+
+template class IndexedGeometrySet<2>;
+template class IndexedGeometrySet<3>;
+
+} // namespace detail
+} // namespace SFCGAL
@@ -0,0 +1,133 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_INDEXED_GEOMETRY_SET_H_
+#define _SFCGAL_DETAIL_INDEXED_GEOMETRY_SET_H_
+
+#include <SFCGAL/config.h>
+
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/StrTree.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace SFCGAL {
+namespace detail {
+
+/**
+ * Returns the box of a PrimitiveBox as a CGAL::Bbox_2
+ */
+SFCGAL_API CGAL::Bbox_2 primitiveBbox( const PrimitiveBox<2>::Type& box );
+/**
+ * Returns the box of a PrimitiveBox as a CGAL::Bbox_3
+ */
+SFCGAL_API CGAL::Bbox_3 primitiveBbox( const PrimitiveBox<3>::Type& box );
+
+///
+/// Points and segments on the boundary of the primitives of a GeometrySet<2>
+/// (points, segments and the edges of the rings of the surfaces), used for distance computations
+///
+struct SFCGAL_API GeometrySetBoundary2 {
+    std::vector< Kernel::Point_2 >   points;
+    std::vector< Kernel::Segment_2 > segments;
+
+    /**
+     * Collects the boundary elements of a GeometrySet
+     */
+    void collect( const GeometrySet<2>& gs );
+};
+
+///
+/// A GeometrySet with its primitive handles, boxes and a static R-tree on these boxes.
+/// Built once and reused by the prepared variants of the predicates (see PreparedGeometry).
+///
+/// @warning the structure is not copyable, handles point into the GeometrySet
+///
+template < int Dim >
+class SFCGAL_API IndexedGeometrySet : private boost::noncopyable {
+public:
+    typedef typename TypeForDimension<Dim>::Bbox                  Bbox ;
+    typedef StrTree< Bbox, const PrimitiveHandle<Dim>* >          Tree ;
+    typedef StrTree< Bbox, size_t >                               BoundaryTree ;
+
+    /**
+     * Decomposes and indexes a Geometry
+     */
+    IndexedGeometrySet( const Geometry& g );
+
+    inline const GeometrySet<Dim>& geometrySet() const {
+        return _geometrySet ;
+    }
+
+    /**
+     * Primitive handles, referenced by boxes() and tree()
+     */
+    inline const typename HandleCollection<Dim>::Type& handles() const {
+        return _handles ;
+    }
+
+    /**
+     * Primitive boxes, for use with CGAL::box_intersection_d
+     */
+    inline const typename BoxCollection<Dim>::Type& boxes() const {
+        return _boxes ;
+    }
+
+    /**
+     * R-tree on the primitive handles
+     */
+    inline const Tree& tree() const {
+        return _tree ;
+    }
+
+    /**
+     * Boundary elements of the primitives (lazily computed once, thread-safe, 2D only)
+     */
+    const GeometrySetBoundary2& boundary() const ;
+
+    /**
+     * R-tree on the boundary elements, the value is the index in boundary().points,
+     * then in boundary().segments shifted by the number of points (lazily computed once,
+     * thread-safe, 2D only)
+     */
+    const BoundaryTree& boundaryTree() const ;
+
+private:
+    GeometrySet<Dim> _geometrySet ;
+    typename HandleCollection<Dim>::Type _handles ;
+    typename BoxCollection<Dim>::Type _boxes ;
+    Tree _tree ;
+
+    // built together by _buildBoundary, at most once even with concurrent queries
+    mutable std::once_flag _boundaryFlag ;
+    mutable std::unique_ptr< GeometrySetBoundary2 > _boundary ;
+    mutable std::unique_ptr< BoundaryTree > _boundaryTree ;
+
+    void _buildBoundary() const ;
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
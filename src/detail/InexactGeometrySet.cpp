@@ -0,0 +1,564 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/detail/InexactGeometrySet.h>
+
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/detail/StrTree.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace SFCGAL {
+namespace detail {
+
+typedef InexactGeometrySet::Point_2              IPoint_2 ;
+typedef InexactGeometrySet::Segment_2            ISegment_2 ;
+typedef InexactGeometrySet::Polygon_2            IPolygon_2 ;
+typedef InexactGeometrySet::Polygon_with_holes_2 IPolygon_with_holes_2 ;
+
+///
+///
+///
+InexactKernel::Point_2 toInexactPoint_2( const Point& p )
+{
+    return InexactKernel::Point_2( CGAL::to_double( p.x() ), CGAL::to_double( p.y() ) );
+}
+
+///
+///
+///
+Point toExactPoint( const InexactKernel::Point_2& p )
+{
+    const double x = p.x();
+    const double y = p.y();
+    return Point( x, y );
+}
+
+namespace {
+
+//
+// Build a CGAL::Polygon_2 from a closed ring, skipping the closing point and repeated points
+IPolygon_2 _toInexactPolygon_2( const LineString& ring )
+{
+    IPolygon_2 result;
+
+    for ( size_t i = 0; i + 1 < ring.numPoints(); ++i ) {
+        const IPoint_2 p = toInexactPoint_2( ring.pointN( i ) );
+
+        if ( result.is_empty() || p != *( result.vertices_end() - 1 ) ) {
+            result.push_back( p );
+        }
+    }
+
+    return result;
+}
+
+//
+// rings (exterior and interior) of a polygon
+std::vector< const IPolygon_2* > _rings( const IPolygon_with_holes_2& poly )
+{
+    std::vector< const IPolygon_2* > rings;
+    rings.push_back( &poly.outer_boundary() );
+
+    for ( IPolygon_with_holes_2::Hole_const_iterator hit = poly.holes_begin(); hit != poly.holes_end(); ++hit ) {
+        rings.push_back( &( *hit ) );
+    }
+
+    return rings;
+}
+
+//
+// edges of the rings (exterior and interior) of a polygon
+std::vector< ISegment_2 > _edges( const IPolygon_with_holes_2& poly )
+{
+    const std::vector< const IPolygon_2* > rings = _rings( poly );
+    std::vector< ISegment_2 > edges;
+
+    for ( size_t r = 0; r < rings.size(); ++r ) {
+        edges.insert( edges.end(), rings[r]->edges_begin(), rings[r]->edges_end() );
+    }
+
+    return edges;
+}
+
+//
+// stops the sweep on the first pair of intersecting segments
+struct SegmentsIntersect {
+    SegmentsIntersect( const std::vector< ISegment_2 >& a_, const std::vector< ISegment_2 >& b_ ):
+        a( a_ ), b( b_ ), found( false ) {}
+
+    bool operator()( const IndexedBox<2>& boxA, const IndexedBox<2>& boxB ) {
+        found = CGAL::do_intersect( a[ boxA.index ], b[ boxB.index ] );
+        return ! found;
+    }
+
+    const std::vector< ISegment_2 >& a;
+    const std::vector< ISegment_2 >& b;
+    bool found;
+};
+
+std::vector< IndexedBox<2> > _edgeBoxes( const std::vector< ISegment_2 >& segments )
+{
+    std::vector< IndexedBox<2> > boxes;
+    boxes.reserve( segments.size() );
+
+    for ( size_t i = 0; i < segments.size(); ++i ) {
+        boxes.push_back( IndexedBox<2>( segments[i].bbox(), i ) );
+    }
+
+    return boxes;
+}
+
+//-- primitive intersection tests
+
+bool _intersects( const IPoint_2& a, const IPoint_2& b )
+{
+    return a == b;
+}
+
+bool _intersects( const ISegment_2& s, const IPoint_2& p )
+{
+    return s.has_on( p );
+}
+
+bool _intersects( const IPoint_2& p, const ISegment_2& s )
+{
+    return s.has_on( p );
+}
+
+bool _intersects( const ISegment_2& a, const ISegment_2& b )
+{
+    return CGAL::do_intersect( a, b );
+}
+
+bool _intersects( const IPolygon_with_holes_2& poly, const IPoint_2& p )
+{
+    const CGAL::Bounded_side b = poly.outer_boundary().bounded_side( p );
+
+    if ( b == CGAL::ON_BOUNDARY ) {
+        return true;
+    }
+
+    if ( b == CGAL::ON_UNBOUNDED_SIDE ) {
+        return false;
+    }
+
+    for ( IPolygon_with_holes_2::Hole_const_iterator hit = poly.holes_begin(); hit != poly.holes_end(); ++hit ) {
+        if ( hit->bounded_side( p ) == CGAL::ON_BOUNDED_SIDE ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool _intersects( const IPoint_2& p, const IPolygon_with_holes_2& poly )
+{
+    return _intersects( poly, p );
+}
+
+bool _intersects( const IPolygon_with_holes_2& poly, const ISegment_2& s )
+{
+    const CGAL::Bbox_2 sbox = s.bbox();
+    const std::vector< const IPolygon_2* > rings = _rings( poly );
+
+    for ( size_t r = 0; r < rings.size(); ++r ) {
+        for ( IPolygon_2::Edge_const_iterator eit = rings[r]->edges_begin(); eit != rings[r]->edges_end(); ++eit ) {
+            if ( CGAL::do_overlap( eit->bbox(), sbox ) && CGAL::do_intersect( *eit, s ) ) {
+                return true;
+            }
+        }
+    }
+
+    // no intersection with the boundary, the segment is either inside or outside
+    return _intersects( poly, s.source() );
+}
+
+bool _intersects( const ISegment_2& s, const IPolygon_with_holes_2& poly )
+{
+    return _intersects( poly, s );
+}
+
+bool _intersects( const IPolygon_with_holes_2& a, const IPolygon_with_holes_2& b )
+{
+    const std::vector< ISegment_2 > edgesA = _edges( a );
+    const std::vector< ISegment_2 > edgesB = _edges( b );
+    std::vector< IndexedBox<2> > boxesA = _edgeBoxes( edgesA );
+    std::vector< IndexedBox<2> > boxesB = _edgeBoxes( edgesB );
+
+    SegmentsIntersect callback( edgesA, edgesB );
+    visitIntersectingBoxes( boxesA.begin(), boxesA.end(), boxesB.begin(), boxesB.end(), callback );
+
+    if ( callback.found ) {
+        return true;
+    }
+
+    // boundaries are disjoint, one polygon may still be inside the other one
+    return _intersects( a, *b.outer_boundary().vertices_begin() )
+           || _intersects( b, *a.outer_boundary().vertices_begin() );
+}
+
+//
+// intersection test between the primitive index of a set (see InexactGeometrySet::_indexedBoxes)
+// and another primitive
+template < typename Primitive >
+bool _intersects( const InexactGeometrySet& g, size_t index, const Primitive& p )
+{
+    if ( index < g.points().size() ) {
+        return _intersects( g.points()[ index ], p );
+    }
+
+    index -= g.points().size();
+
+    if ( index < g.segments().size() ) {
+        return _intersects( g.segments()[ index ], p );
+    }
+
+    return _intersects( g.surfaces()[ index - g.segments().size() ], p );
+}
+
+bool _intersects( const InexactGeometrySet& a, size_t indexA, const InexactGeometrySet& b, size_t indexB )
+{
+    if ( indexB < b.points().size() ) {
+        return _intersects( a, indexA, b.points()[ indexB ] );
+    }
+
+    indexB -= b.points().size();
+
+    if ( indexB < b.segments().size() ) {
+        return _intersects( a, indexA, b.segments()[ indexB ] );
+    }
+
+    return _intersects( a, indexA, b.surfaces()[ indexB - b.segments().size() ] );
+}
+
+//
+// stops the sweep on the first pair of intersecting primitives
+struct PrimitivesIntersect {
+    PrimitivesIntersect( const InexactGeometrySet& a_, const InexactGeometrySet& b_ ):
+        a( a_ ), b( b_ ), found( false ) {}
+
+    bool operator()( const IndexedBox<2>& boxA, const IndexedBox<2>& boxB ) {
+        found = _intersects( a, boxA.index, b, boxB.index );
+        return ! found;
+    }
+
+    const InexactGeometrySet& a;
+    const InexactGeometrySet& b;
+    bool found;
+};
+
+//
+// Points and segments (including the edges of the surfaces) of a set, used for distance computations
+struct BoundaryPrimitives {
+    std::vector< IPoint_2 > points;
+    std::vector< ISegment_2 > segments;
+};
+
+//
+// R-tree on boundary primitives, the value is the index in points, then in segments
+// shifted by the number of points
+typedef StrTree< CGAL::Bbox_2, size_t > BoundaryTree;
+
+template < typename Primitive >
+double _squaredDistance( const BoundaryPrimitives& g, size_t index, const Primitive& p )
+{
+    if ( index < g.points.size() ) {
+        return CGAL::to_double( CGAL::squared_distance( g.points[ index ], p ) );
+    }
+
+    return CGAL::to_double( CGAL::squared_distance( g.segments[ index - g.points.size() ], p ) );
+}
+
+//
+// squared distance between two items of the boundary trees
+struct BoundarySquaredDistance {
+    BoundarySquaredDistance( const BoundaryPrimitives& a_, const BoundaryPrimitives& b_ ):
+        a( a_ ), b( b_ ) {}
+
+    double operator()( const BoundaryTree::Item& itemA, const BoundaryTree::Item& itemB ) const {
+        if ( itemB.second < b.points.size() ) {
+            return _squaredDistance( a, itemA.second, b.points[ itemB.second ] );
+        }
+
+        return _squaredDistance( a, itemA.second, b.segments[ itemB.second - b.points.size() ] );
+    }
+
+    const BoundaryPrimitives& a;
+    const BoundaryPrimitives& b;
+};
+
+} // namespace
+
+///
+///
+///
+InexactGeometrySet::InexactGeometrySet()
+{
+}
+
+///
+///
+///
+InexactGeometrySet::InexactGeometrySet( const Geometry& g )
+{
+    _decompose( g );
+}
+
+///
+///
+///
+void InexactGeometrySet::addGeometry( const Geometry& g )
+{
+    _decompose( g );
+}
+
+///
+///
+///
+bool InexactGeometrySet::isEmpty() const
+{
+    return _points.empty() && _segments.empty() && _surfaces.empty();
+}
+
+///
+///
+///
+void InexactGeometrySet::_addLineString( const LineString& ls )
+{
+    for ( size_t i = 0; i + 1 < ls.numPoints(); ++i ) {
+        const ISegment_2 seg( toInexactPoint_2( ls.pointN( i ) ), toInexactPoint_2( ls.pointN( i + 1 ) ) );
+        _segments.push_back( seg );
+        _segmentBoxes.push_back( seg.bbox() );
+    }
+}
+
+///
+///
+///
+void InexactGeometrySet::_addPolygon( const Polygon& poly )
+{
+    IPolygon_with_holes_2 result( _toInexactPolygon_2( poly.exteriorRing() ) );
+
+    if ( result.outer_boundary().is_empty() ) {
+        return;
+    }
+
+    for ( size_t i = 0; i < poly.numInteriorRings(); ++i ) {
+        const IPolygon_2 hole = _toInexactPolygon_2( poly.interiorRingN( i ) );
+
+        if ( ! hole.is_empty() ) {
+            result.add_hole( hole );
+        }
+    }
+
+    _surfaces.push_back( result );
+    _surfaceBoxes.push_back( result.outer_boundary().bbox() );
+}
+
+///
+///
+///
+void InexactGeometrySet::_decompose( const Geometry& g )
+{
+    if ( g.isEmpty() ) {
+        return;
+    }
+
+    if ( g.is< GeometryCollection >() ) {
+        for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+            _decompose( g.geometryN( i ) );
+        }
+
+        return;
+    }
+
+    switch ( g.geometryTypeId() ) {
+    case TYPE_POINT: {
+        const IPoint_2 p = toInexactPoint_2( g.as< Point >() );
+        _points.push_back( p );
+        _pointBoxes.push_back( p.bbox() );
+        break;
+    }
+
+    case TYPE_LINESTRING:
+        _addLineString( g.as< LineString >() );
+        break;
+
+    case TYPE_TRIANGLE:
+        _addPolygon( g.as< Triangle >().toPolygon() );
+        break;
+
+    case TYPE_POLYGON:
+        _addPolygon( g.as< Polygon >() );
+        break;
+
+    case TYPE_TRIANGULATEDSURFACE: {
+        const TriangulatedSurface& tin = g.as< TriangulatedSurface >();
+
+        for ( size_t i = 0; i < tin.numTriangles(); ++i ) {
+            _addPolygon( tin.triangleN( i ).toPolygon() );
+        }
+
+        break;
+    }
+
+    case TYPE_POLYHEDRALSURFACE: {
+        const PolyhedralSurface& surface = g.as< PolyhedralSurface >();
+
+        for ( size_t i = 0; i < surface.numPolygons(); ++i ) {
+            _addPolygon( surface.polygonN( i ) );
+        }
+
+        break;
+    }
+
+    default:
+        // solids are ignored in 2D, as for GeometrySet<2>
+        break;
+    }
+}
+
+///
+///
+///
+double InexactGeometrySet::area() const
+{
+    double result = 0.0;
+
+    for ( size_t i = 0; i < _surfaces.size(); ++i ) {
+        result += std::abs( _surfaces[i].outer_boundary().area() );
+
+        for ( IPolygon_with_holes_2::Hole_const_iterator hit = _surfaces[i].holes_begin(); hit != _surfaces[i].holes_end(); ++hit ) {
+            result -= std::abs( hit->area() );
+        }
+    }
+
+    return result;
+}
+
+///
+///
+///
+std::vector< IndexedBox<2> > InexactGeometrySet::_indexedBoxes() const
+{
+    std::vector< IndexedBox<2> > boxes;
+    boxes.reserve( _points.size() + _segments.size() + _surfaces.size() );
+
+    for ( size_t i = 0; i < _points.size(); ++i ) {
+        boxes.push_back( IndexedBox<2>( _pointBoxes[i], boxes.size() ) );
+    }
+
+    for ( size_t i = 0; i < _segments.size(); ++i ) {
+        boxes.push_back( IndexedBox<2>( _segmentBoxes[i], boxes.size() ) );
+    }
+
+    for ( size_t i = 0; i < _surfaces.size(); ++i ) {
+        boxes.push_back( IndexedBox<2>( _surfaceBoxes[i], boxes.size() ) );
+    }
+
+    return boxes;
+}
+
+///
+///
+///
+bool InexactGeometrySet::intersects( const InexactGeometrySet& other ) const
+{
+    std::vector< IndexedBox<2> > boxes = _indexedBoxes();
+    std::vector< IndexedBox<2> > otherBoxes = other._indexedBoxes();
+
+    PrimitivesIntersect callback( *this, other );
+    visitIntersectingBoxes( boxes.begin(), boxes.end(), otherBoxes.begin(), otherBoxes.end(), callback );
+    return callback.found;
+}
+
+namespace {
+BoundaryPrimitives _boundaryPrimitives( const InexactGeometrySet& g )
+{
+    BoundaryPrimitives result;
+    result.points = g.points();
+    result.segments = g.segments();
+
+    for ( size_t i = 0; i < g.surfaces().size(); ++i ) {
+        const std::vector< ISegment_2 > edges = _edges( g.surfaces()[i] );
+        result.segments.insert( result.segments.end(), edges.begin(), edges.end() );
+    }
+
+    return result;
+}
+
+BoundaryTree _boundaryTree( const BoundaryPrimitives& g )
+{
+    BoundaryTree tree;
+
+    for ( size_t i = 0; i < g.points.size(); ++i ) {
+        tree.insert( g.points[i].bbox(), i );
+    }
+
+    for ( size_t i = 0; i < g.segments.size(); ++i ) {
+        tree.insert( g.segments[i].bbox(), g.points.size() + i );
+    }
+
+    tree.build();
+    return tree;
+}
+}
+
+///
+///
+///
+double InexactGeometrySet::distance( const InexactGeometrySet& other ) const
+{
+    if ( isEmpty() || other.isEmpty() ) {
+        return std::numeric_limits< double >::infinity() ;
+    }
+
+    if ( intersects( other ) ) {
+        return 0.0;
+    }
+
+    // no intersection, the distance is reached between boundaries
+    const BoundaryPrimitives a = _boundaryPrimitives( *this );
+    const BoundaryPrimitives b = _boundaryPrimitives( other );
+
+    // branch and bound on the pairs of boundary primitives
+    const BoundaryTree treeA = _boundaryTree( a );
+    const BoundaryTree treeB = _boundaryTree( b );
+
+    const double dMin = treeA.minimum(
+                            treeB,
+                            &squaredDistance< CGAL::Bbox_2 >,
+                            BoundarySquaredDistance( a, b )
+                        );
+
+    return std::sqrt( dMin );
+}
+
+} // namespace detail
+} // namespace SFCGAL
@@ -0,0 +1,133 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_INEXACT_GEOMETRY_SET_H_
+#define _SFCGAL_DETAIL_INEXACT_GEOMETRY_SET_H_
+
+#include <vector>
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/detail/BoxIntersection.h>
+
+#include <CGAL/Bbox_2.h>
+#include <CGAL/Polygon_2.h>
+#include <CGAL/Polygon_with_holes_2.h>
+
+namespace SFCGAL {
+class Geometry;
+class Point;
+class LineString;
+class Polygon;
+namespace detail {
+
+/**
+ * Converts a Point to a double precision CGAL::Point_2
+ */
+SFCGAL_API InexactKernel::Point_2 toInexactPoint_2( const Point& p );
+
+/**
+ * Converts a double precision CGAL::Point_2 to an exact SFCGAL::Point
+ */
+SFCGAL_API Point toExactPoint( const InexactKernel::Point_2& p );
+
+///
+/// A InexactGeometrySet is the double precision counterpart of GeometrySet<2>,
+/// used by the FastMode variants of algorithms.
+///
+/// Points and segments are kept as is, surfaces as CGAL::Polygon_with_holes_2.
+/// Solids are ignored, as for GeometrySet<2>.
+///
+class SFCGAL_API InexactGeometrySet {
+public:
+    typedef InexactKernel::Point_2                       Point_2 ;
+    typedef InexactKernel::Segment_2                     Segment_2 ;
+    typedef CGAL::Polygon_2< InexactKernel >             Polygon_2 ;
+    typedef CGAL::Polygon_with_holes_2< InexactKernel >  Polygon_with_holes_2 ;
+
+    InexactGeometrySet();
+
+    /**
+     * Construct a InexactGeometrySet from a SFCGAL::Geometry
+     */
+    InexactGeometrySet( const Geometry& g );
+
+    /**
+     * Add a geometry by decomposing it into CGAL primitives
+     */
+    void addGeometry( const Geometry& g );
+
+    inline const std::vector< Point_2 >& points() const {
+        return _points;
+    }
+    inline const std::vector< Segment_2 >& segments() const {
+        return _segments;
+    }
+    inline const std::vector< Polygon_with_holes_2 >& surfaces() const {
+        return _surfaces;
+    }
+
+    /**
+     * Returns true if the set holds no primitive
+     */
+    bool isEmpty() const;
+
+    /**
+     * Sum of the areas of the surfaces
+     */
+    double area() const;
+
+    /**
+     * Intersection test with another set, candidate pairs of primitives are found
+     * with a sweep on their boxes
+     */
+    bool intersects( const InexactGeometrySet& other ) const;
+
+    /**
+     * Distance to another set (infinity if one of the sets is empty), computed with a
+     * branch and bound on R-trees of the boundary primitives
+     */
+    double distance( const InexactGeometrySet& other ) const;
+
+private:
+    void _decompose( const Geometry& g );
+    void _addPolygon( const Polygon& g );
+    void _addLineString( const LineString& g );
+
+    /**
+     * Boxes of the primitives, indexed by their position in points(), then in segments()
+     * shifted by the number of points, then in surfaces() shifted by the number of points
+     * and segments
+     */
+    std::vector< IndexedBox<2> > _indexedBoxes() const;
+
+    std::vector< Point_2 > _points;
+    std::vector< Segment_2 > _segments;
+    std::vector< Polygon_with_holes_2 > _surfaces;
+
+    std::vector< CGAL::Bbox_2 > _pointBoxes;
+    std::vector< CGAL::Bbox_2 > _segmentBoxes;
+    std::vector< CGAL::Bbox_2 > _surfaceBoxes;
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
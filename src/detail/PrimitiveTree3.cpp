@@ -0,0 +1,128 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/PrimitiveTree3.h>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/triangulate/triangulatePolygon.h>
+
+namespace SFCGAL {
+namespace detail {
+
+///
+///
+///
+PrimitiveTree3::PrimitiveTree3( const Geometry& g ):
+    _hasVolume( false )
+{
+    _collect( g );
+
+    for ( size_t i = 0; i < _points.size(); i++ ) {
+        _tree.insert( _points[i].bbox(), i );
+    }
+
+    for ( size_t i = 0; i < _segments.size(); i++ ) {
+        _tree.insert( _segments[i].bbox(), _points.size() + i );
+    }
+
+    for ( size_t i = 0; i < _triangles.size(); i++ ) {
+        _tree.insert( _triangles[i].bbox(), _points.size() + _segments.size() + i );
+    }
+
+    _tree.build();
+}
+
+///
+///
+///
+void PrimitiveTree3::_collect( const Geometry& g )
+{
+    if ( g.isEmpty() ) {
+        return ;
+    }
+
+    switch ( g.geometryTypeId() ) {
+    case TYPE_POINT:
+        _points.push_back( g.as< Point >().toPoint_3() );
+        return ;
+
+    case TYPE_LINESTRING: {
+        const LineString& lineString = g.as< LineString >();
+
+        if ( lineString.numPoints() == 1 ) {
+            _points.push_back( lineString.pointN( 0 ).toPoint_3() );
+        }
+
+        for ( size_t i = 0; i + 1 < lineString.numPoints(); i++ ) {
+            _segments.push_back( Kernel::Segment_3( lineString.pointN( i ).toPoint_3(), lineString.pointN( i + 1 ).toPoint_3() ) );
+        }
+
+        return ;
+    }
+
+    case TYPE_TRIANGLE:
+        _triangles.push_back( g.as< Triangle >().toTriangle_3() );
+        return ;
+
+    case TYPE_SOLID:
+    case TYPE_MULTISOLID:
+        // shells are triangulated
+        _hasVolume = true ;
+        _collectTriangulated( g );
+        return ;
+
+    case TYPE_POLYGON:
+    case TYPE_TRIANGULATEDSURFACE:
+    case TYPE_POLYHEDRALSURFACE:
+    case TYPE_MULTIPOLYGON:
+        _collectTriangulated( g );
+        return ;
+
+    case TYPE_MULTIPOINT:
+    case TYPE_MULTILINESTRING:
+    case TYPE_GEOMETRYCOLLECTION:
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            _collect( g.geometryN( i ) );
+        }
+
+        return ;
+
+    default:
+        return ;
+    }
+}
+
+///
+///
+///
+void PrimitiveTree3::_collectTriangulated( const Geometry& g )
+{
+    TriangulatedSurface surface ;
+    triangulate::triangulatePolygon3D( g, surface );
+
+    for ( size_t i = 0; i < surface.numTriangles(); i++ ) {
+        _triangles.push_back( surface.triangleN( i ).toTriangle_3() );
+    }
+}
+
+} // namespace detail
+} // namespace SFCGAL
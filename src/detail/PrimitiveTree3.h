@@ -0,0 +1,102 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_PRIMITIVE_TREE_3_H_
+#define _SFCGAL_DETAIL_PRIMITIVE_TREE_3_H_
+
+#include <SFCGAL/config.h>
+
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/detail/StrTree.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <vector>
+
+namespace SFCGAL {
+class Geometry;
+
+namespace detail {
+
+///
+/// Points, segments and triangles of a Geometry in 3D (polygons and shells are
+/// triangulated) with a static R-tree on their boxes, used for 3D distance computations.
+///
+/// The value of an item of the tree is its index in points(), then in segments()
+/// shifted by the number of points, then in triangles() shifted by the number of
+/// points and segments.
+///
+class SFCGAL_API PrimitiveTree3 : private boost::noncopyable {
+public:
+    typedef StrTree< CGAL::Bbox_3, size_t > Tree ;
+
+    /**
+     * Decomposes and indexes a Geometry
+     */
+    PrimitiveTree3( const Geometry& g );
+
+    inline const std::vector< Kernel::Point_3 >& points() const {
+        return _points ;
+    }
+
+    inline const std::vector< Kernel::Segment_3 >& segments() const {
+        return _segments ;
+    }
+
+    inline const std::vector< Kernel::Triangle_3 >& triangles() const {
+        return _triangles ;
+    }
+
+    inline const Tree& tree() const {
+        return _tree ;
+    }
+
+    /**
+     * Returns true if the geometry contains a Solid, i.e. if the triangles may
+     * bound a volume
+     */
+    inline bool hasVolume() const {
+        return _hasVolume ;
+    }
+
+    /**
+     * Returns true if there is no primitive
+     */
+    inline bool isEmpty() const {
+        return _tree.empty();
+    }
+
+private:
+    std::vector< Kernel::Point_3 >    _points ;
+    std::vector< Kernel::Segment_3 >  _segments ;
+    std::vector< Kernel::Triangle_3 > _triangles ;
+    bool _hasVolume ;
+    Tree _tree ;
+
+    void _collect( const Geometry& g );
+    /**
+     * collects the triangles of the triangulation of a surface or of the shells of a solid
+     */
+    void _collectTriangulated( const Geometry& g );
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
@@ -0,0 +1,490 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_STRTREE_H_
+#define _SFCGAL_DETAIL_STRTREE_H_
+
+#include <SFCGAL/config.h>
+
+#include <CGAL/Bbox_2.h>
+#include <CGAL/Bbox_3.h>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace SFCGAL {
+namespace detail {
+
+///
+/// Squared distance between two boxes (0 if they overlap)
+///
+template < typename Box >
+double squaredDistance( const Box& a, const Box& b )
+{
+    double result = 0.0 ;
+
+    for ( int i = 0; i < a.dimension(); i++ ) {
+        const double d = std::max( 0.0, std::max( a.min( i ) - b.max( i ), b.min( i ) - a.max( i ) ) );
+        result += d * d ;
+    }
+
+    return result ;
+}
+
+///
+/// Box expanded by a distance in every direction, rounded outward so that it contains
+/// every point within the distance of the box
+///
+inline CGAL::Bbox_2 expand( const CGAL::Bbox_2& box, double distance )
+{
+    const double inf = std::numeric_limits< double >::infinity() ;
+    return CGAL::Bbox_2(
+               std::nextafter( box.xmin() - distance, -inf ), std::nextafter( box.ymin() - distance, -inf ),
+               std::nextafter( box.xmax() + distance, inf ), std::nextafter( box.ymax() + distance, inf )
+           );
+}
+
+inline CGAL::Bbox_3 expand( const CGAL::Bbox_3& box, double distance )
+{
+    const double inf = std::numeric_limits< double >::infinity() ;
+    return CGAL::Bbox_3(
+               std::nextafter( box.xmin() - distance, -inf ), std::nextafter( box.ymin() - distance, -inf ),
+               std::nextafter( box.zmin() - distance, -inf ),
+               std::nextafter( box.xmax() + distance, inf ), std::nextafter( box.ymax() + distance, inf ),
+               std::nextafter( box.zmax() + distance, inf )
+           );
+}
+
+///
+/// Static R-tree packed with the Sort-Tile-Recursive algorithm
+/// (Leutenegger, Lopez and Edgington, 1997).
+///
+/// Box is either CGAL::Bbox_2 or CGAL::Bbox_3. Items are added with insert() and
+/// the tree is built once with build(), it is read-only afterwards.
+///
+template < typename Box, typename Value >
+class StrTree {
+public:
+    typedef std::pair< Box, Value > Item ;
+
+    ///
+    /// @param nodeCapacity maximum number of children of a node
+    ///
+    StrTree( size_t nodeCapacity = 16 ):
+        _nodeCapacity( std::max( nodeCapacity, size_t( 2 ) ) ),
+        _built( false ) {
+    }
+
+    ///
+    /// Adds an item
+    /// @pre build() was not called
+    ///
+    void insert( const Box& box, const Value& value ) {
+        BOOST_ASSERT( ! _built );
+        _items.push_back( Item( box, value ) );
+    }
+
+    ///
+    /// Builds the tree
+    ///
+    void build() {
+        _nodes.clear();
+
+        if ( _items.empty() ) {
+            _built = true ;
+            return ;
+        }
+
+        // leaves, items are sorted in place
+        _strSort( _items.begin(), _items.end(), 0 );
+        std::vector< Node > level ;
+
+        for ( size_t i = 0; i < _items.size(); i += _nodeCapacity ) {
+            Node node ;
+            node.begin = i ;
+            node.end   = std::min( i + _nodeCapacity, _items.size() );
+            node.leaf  = true ;
+            node.box   = _items[i].first ;
+
+            for ( size_t j = node.begin + 1; j < node.end; j++ ) {
+                node.box = node.box + _items[j].first ;
+            }
+
+            level.push_back( node );
+        }
+
+        // upper levels, nodes of a level are stored before their parents
+        while ( level.size() > 1 ) {
+            _strSort( level.begin(), level.end(), 0 );
+            const size_t offset = _nodes.size();
+            _nodes.insert( _nodes.end(), level.begin(), level.end() );
+
+            std::vector< Node > parents ;
+
+            for ( size_t i = 0; i < level.size(); i += _nodeCapacity ) {
+                Node node ;
+                node.begin = offset + i ;
+                node.end   = offset + std::min( i + _nodeCapacity, level.size() );
+                node.leaf  = false ;
+                node.box   = level[i].box ;
+
+                for ( size_t j = i + 1; j < std::min( i + _nodeCapacity, level.size() ); j++ ) {
+                    node.box = node.box + level[j].box ;
+                }
+
+                parents.push_back( node );
+            }
+
+            level.swap( parents );
+        }
+
+        _nodes.push_back( level.front() );
+        _built = true ;
+    }
+
+    ///
+    /// Returns true if the tree holds no item
+    ///
+    inline bool empty() const {
+        return _items.empty();
+    }
+
+    ///
+    /// Returns the number of items
+    ///
+    inline size_t size() const {
+        return _items.size();
+    }
+
+    ///
+    /// Returns the items (in tree order once built)
+    ///
+    inline const std::vector< Item >& items() const {
+        return _items ;
+    }
+
+    ///
+    /// Returns the bounding box of all the items
+    /// @pre ! empty() and build() was called
+    ///
+    inline const Box& bbox() const {
+        BOOST_ASSERT( _built && ! _nodes.empty() );
+        return _nodes.back().box ;
+    }
+
+    ///
+    /// Calls visitor( item ) for each item whose box overlaps box. The visitor returns
+    /// false to stop the traversal.
+    /// @return false if the traversal was stopped by the visitor
+    ///
+    template < typename Visitor >
+    bool query( const Box& box, Visitor& visitor ) const {
+        BOOST_ASSERT( _built );
+
+        if ( _nodes.empty() ) {
+            return true ;
+        }
+
+        std::vector< size_t > stack ;
+        stack.push_back( _nodes.size() - 1 );
+
+        while ( ! stack.empty() ) {
+            const Node& node = _nodes[ stack.back() ];
+            stack.pop_back();
+
+            if ( ! CGAL::do_overlap( node.box, box ) ) {
+                continue ;
+            }
+
+            for ( size_t i = node.begin; i < node.end; i++ ) {
+                if ( ! node.leaf ) {
+                    stack.push_back( i );
+                }
+                else if ( CGAL::do_overlap( _items[i].first, box ) && ! visitor( _items[i] ) ) {
+                    return false ;
+                }
+            }
+        }
+
+        return true ;
+    }
+
+    ///
+    /// Branch and bound search of the minimum of itemDistance( item ) over the items.
+    /// boxDistance( box ) must be a lower bound of itemDistance for the items in the box.
+    /// Nodes are visited by increasing lower bound and pruned against the best value
+    /// found so far, which is initialized to upperBound.
+    ///
+    /// @return the minimum, or upperBound if no item is closer
+    ///
+    template < typename BoxDistance, typename ItemDistance >
+    double minimum(
+        BoxDistance boxDistance,
+        ItemDistance itemDistance,
+        double upperBound = std::numeric_limits< double >::infinity()
+    ) const {
+        BOOST_ASSERT( _built );
+
+        if ( _nodes.empty() ) {
+            return upperBound ;
+        }
+
+        typedef std::pair< double, size_t > Entry ;
+        std::priority_queue< Entry, std::vector< Entry >, std::greater< Entry > > queue ;
+        queue.push( Entry( boxDistance( _nodes.back().box ), _nodes.size() - 1 ) );
+
+        double best = upperBound ;
+
+        while ( ! queue.empty() && queue.top().first < best ) {
+            const Node& node = _nodes[ queue.top().second ];
+            queue.pop();
+
+            for ( size_t i = node.begin; i < node.end; i++ ) {
+                if ( ! node.leaf ) {
+                    const double d = boxDistance( _nodes[i].box );
+
+                    if ( d < best ) {
+                        queue.push( Entry( d, i ) );
+                    }
+                }
+                else if ( boxDistance( _items[i].first ) < best ) {
+                    best = std::min( best, itemDistance( _items[i] ) );
+                }
+            }
+        }
+
+        return best ;
+    }
+
+    ///
+    /// Branch and bound search of the minimum of itemDistance( item, otherItem ) over the
+    /// pairs of items of this tree and other, traversing both trees at once.
+    /// boxDistance( box, otherBox ) must be a lower bound of itemDistance for the items in
+    /// the boxes. Pairs of nodes are visited by increasing lower bound, the largest node
+    /// of a pair is split first.
+    ///
+    /// @return the minimum, or upperBound if no pair is closer
+    ///
+    template < typename BoxDistance, typename ItemDistance >
+    double minimum(
+        const StrTree& other,
+        BoxDistance boxDistance,
+        ItemDistance itemDistance,
+        double upperBound = std::numeric_limits< double >::infinity()
+    ) const {
+        BOOST_ASSERT( _built && other._built );
+
+        if ( _nodes.empty() || other._nodes.empty() ) {
+            return upperBound ;
+        }
+
+        typedef std::pair< double, std::pair< size_t, size_t > > Entry ;
+        std::priority_queue< Entry, std::vector< Entry >, std::greater< Entry > > queue ;
+        queue.push( Entry(
+                        boxDistance( _nodes.back().box, other._nodes.back().box ),
+                        std::make_pair( _nodes.size() - 1, other._nodes.size() - 1 )
+                    ) );
+
+        double best = upperBound ;
+
+        while ( ! queue.empty() && queue.top().first < best ) {
+            const Node& a = _nodes[ queue.top().second.first ];
+            const Node& b = other._nodes[ queue.top().second.second ];
+            const size_t ia = queue.top().second.first ;
+            const size_t ib = queue.top().second.second ;
+            queue.pop();
+
+            if ( a.leaf && b.leaf ) {
+                for ( size_t i = a.begin; i < a.end; i++ ) {
+                    for ( size_t j = b.begin; j < b.end; j++ ) {
+                        if ( boxDistance( _items[i].first, other._items[j].first ) < best ) {
+                            best = std::min( best, itemDistance( _items[i], other._items[j] ) );
+                        }
+                    }
+                }
+            }
+            else if ( b.leaf || ( ! a.leaf && _extent( a.box ) >= _extent( b.box ) ) ) {
+                for ( size_t i = a.begin; i < a.end; i++ ) {
+                    const double d = boxDistance( _nodes[i].box, b.box );
+
+                    if ( d < best ) {
+                        queue.push( Entry( d, std::make_pair( i, ib ) ) );
+                    }
+                }
+            }
+            else {
+                for ( size_t j = b.begin; j < b.end; j++ ) {
+                    const double d = boxDistance( a.box, other._nodes[j].box );
+
+                    if ( d < best ) {
+                        queue.push( Entry( d, std::make_pair( ia, j ) ) );
+                    }
+                }
+            }
+        }
+
+        return best ;
+    }
+
+    ///
+    /// Incremental nearest neighbour traversal (Hjaltason and Samet, 1999): calls
+    /// visitor( item ) for each item by increasing boxDistance( item box ). boxDistance
+    /// must not decrease from a node to its children. The visitor returns false to stop.
+    /// @return false if the traversal was stopped by the visitor
+    ///
+    template < typename BoxDistance, typename Visitor >
+    bool nearest( BoxDistance boxDistance, Visitor& visitor ) const {
+        BOOST_ASSERT( _built );
+
+        if ( _nodes.empty() ) {
+            return true ;
+        }
+
+        std::priority_queue< QueueEntry, std::vector< QueueEntry >, std::greater< QueueEntry > > queue ;
+        queue.push( QueueEntry( boxDistance( _nodes.back().box ), _nodes.size() - 1, false ) );
+
+        while ( ! queue.empty() ) {
+            const QueueEntry entry = queue.top();
+            queue.pop();
+
+            if ( entry.item ) {
+                if ( ! visitor( _items[ entry.index ] ) ) {
+                    return false ;
+                }
+
+                continue ;
+            }
+
+            const Node& node = _nodes[ entry.index ];
+
+            for ( size_t i = node.begin; i < node.end; i++ ) {
+                const Box& box = node.leaf ? _items[i].first : _nodes[i].box ;
+                queue.push( QueueEntry( boxDistance( box ), i, node.leaf ) );
+            }
+        }
+
+        return true ;
+    }
+
+private:
+    struct Node {
+        Box    box ;
+        size_t begin ;
+        size_t end ;
+        bool   leaf ;
+    };
+
+    //
+    // entry of the nearest() queue, either a node or an item. Items come first on ties
+    // so that they are reported as soon as possible
+    struct QueueEntry {
+        QueueEntry( double distance_, size_t index_, bool item_ ):
+            distance( distance_ ), index( index_ ), item( item_ ) {}
+
+        bool operator>( const QueueEntry& other ) const {
+            if ( distance != other.distance ) {
+                return distance > other.distance ;
+            }
+
+            return item < other.item ;
+        }
+
+        double distance ;
+        size_t index ;
+        bool   item ;
+    };
+
+    template < typename T >
+    struct CenterLess {
+        CenterLess( int axis_ ): axis( axis_ ) {}
+
+        bool operator()( const T& a, const T& b ) const {
+            const Box& ba = boxOf( a ) ;
+            const Box& bb = boxOf( b ) ;
+            return ba.min( axis ) + ba.max( axis ) < bb.min( axis ) + bb.max( axis );
+        }
+
+        int axis ;
+    };
+
+    //
+    // sum of the extents of a box, used to choose the node to split
+    static double _extent( const Box& box ) {
+        double result = 0.0 ;
+
+        for ( int i = 0; i < box.dimension(); i++ ) {
+            result += box.max( i ) - box.min( i );
+        }
+
+        return result ;
+    }
+
+    static const Box& boxOf( const Item& item ) {
+        return item.first ;
+    }
+    static const Box& boxOf( const Node& node ) {
+        return node.box ;
+    }
+
+    //
+    // Sort-Tile-Recursive: sort by the center on an axis, cut in slabs and recurse on the next axis
+    template < typename Iterator >
+    void _strSort( Iterator begin, Iterator end, int axis ) {
+        typedef typename std::iterator_traits< Iterator >::value_type T ;
+        const size_t n = end - begin ;
+
+        if ( n <= _nodeCapacity ) {
+            return ;
+        }
+
+        std::sort( begin, end, CenterLess< T >( axis ) );
+
+        const int dimension = Box().dimension();
+
+        if ( axis + 1 == dimension ) {
+            return ;
+        }
+
+        // number of pages and number of slabs along this axis
+        const double pages = std::ceil( double( n ) / _nodeCapacity );
+        const size_t slabs = size_t( std::ceil( std::pow( pages, 1.0 / ( dimension - axis ) ) ) );
+        const size_t slabSize = _nodeCapacity * size_t( std::ceil( pages / slabs ) );
+
+        for ( size_t i = 0; i < n; i += slabSize ) {
+            _strSort( begin + i, begin + std::min( i + slabSize, n ), axis + 1 );
+        }
+    }
+
+    size_t _nodeCapacity ;
+    bool _built ;
+    std::vector< Item > _items ;
+    std::vector< Node > _nodes ;
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
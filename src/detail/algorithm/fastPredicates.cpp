@@ -0,0 +1,377 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/detail/algorithm/fastPredicates.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/volume.h>
+#include <SFCGAL/detail/TypeForDimension.h>
+#include <SFCGAL/detail/StrTree.h>
+#include <SFCGAL/detail/Point_inside_polyhedron.h>
+
+#include <CGAL/Polygon_2_algorithms.h>
+
+#include <vector>
+
+namespace SFCGAL {
+namespace detail {
+namespace algorithm {
+
+namespace {
+
+//
+// Box of the envelope of a geometry. The envelope coordinates are rounded to the nearest
+// double, this rounding is monotone so disjoint (resp. non nested) boxes imply disjoint
+// (resp. non nested) geometries.
+template < int Dim >
+typename TypeForDimension<Dim>::Bbox envelopeBox( const Geometry& g );
+
+template <>
+CGAL::Bbox_2 envelopeBox<2>( const Geometry& g )
+{
+    return g.envelope().toBbox_2();
+}
+
+template <>
+CGAL::Bbox_3 envelopeBox<3>( const Geometry& g )
+{
+    return g.envelope().toBbox_3();
+}
+
+template < int Dim >
+bool boxContains( const typename TypeForDimension<Dim>::Bbox& a, const typename TypeForDimension<Dim>::Bbox& b )
+{
+    for ( int i = 0; i < Dim; i++ ) {
+        if ( b.min( i ) < a.min( i ) || b.max( i ) > a.max( i ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//
+// Point on a LineString, zero length segments are tested as points
+template < int Dim >
+bool intersectsPointLineString( const Point& p, const LineString& lineString )
+{
+    typedef typename TypeForDimension<Dim>::Point   Point_d;
+    typedef typename TypeForDimension<Dim>::Segment Segment_d;
+
+    const Point_d q = p.toPoint_d<Dim>();
+
+    for ( size_t i = 0; i + 1 < lineString.numPoints(); i++ ) {
+        const Point_d a = lineString.pointN( i ).toPoint_d<Dim>();
+        const Point_d b = lineString.pointN( i + 1 ).toPoint_d<Dim>();
+
+        if ( a == b ? q == a : Segment_d( a, b ).has_on( q ) ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//
+// Side of a point relatively to a closed ring (the closing point is skipped)
+CGAL::Bounded_side sideOfRing( const Kernel::Point_2& p, const LineString& ring )
+{
+    std::vector< Kernel::Point_2 > points;
+    points.reserve( ring.numPoints() );
+
+    for ( size_t i = 0; i + 1 < ring.numPoints(); i++ ) {
+        points.push_back( ring.pointN( i ).toPoint_2() );
+    }
+
+    return CGAL::bounded_side_2( points.begin(), points.end(), p, Kernel() );
+}
+
+//
+// Point in the closure of a Polygon
+bool intersectsPointPolygon( const Point& p, const Polygon& polygon )
+{
+    const Kernel::Point_2 q = p.toPoint_2();
+
+    if ( sideOfRing( q, polygon.exteriorRing() ) == CGAL::ON_UNBOUNDED_SIDE ) {
+        return false;
+    }
+
+    for ( size_t i = 0; i < polygon.numInteriorRings(); i++ ) {
+        if ( sideOfRing( q, polygon.interiorRingN( i ) ) == CGAL::ON_BOUNDED_SIDE ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//
+// Point in the closed volume bounded by the exterior shell of a Solid, as in the
+// GeometrySet decomposition of the solid. The point is on the boundary or inside.
+boost::optional< bool > intersectsPointSolid( const Point& p, const Solid& solid )
+{
+    MarkedPolyhedron polyhedron = *solid.exteriorShell().toPolyhedron_3< Kernel, MarkedPolyhedron >();
+
+    if ( ! polyhedron.is_closed() ) {
+        return boost::none;
+    }
+
+    if ( SFCGAL::algorithm::volume( solid, SFCGAL::algorithm::NoValidityCheck() ) < 0 ) {
+        polyhedron.inside_out();
+    }
+
+    Point_inside_polyhedron< MarkedPolyhedron, Kernel > side( polyhedron );
+    return side( p.toPoint_3() ) != CGAL::ON_UNBOUNDED_SIDE;
+}
+
+//
+// Visitor of a segment tree, stops on the first segment intersecting a segment
+template < int Dim >
+struct SegmentIntersectsVisitor {
+    typedef typename TypeForDimension<Dim>::Segment Segment_d;
+
+    SegmentIntersectsVisitor( const Segment_d& segment_, const std::vector< Segment_d >& segments_ ):
+        segment( segment_ ), segments( segments_ ) {}
+
+    bool operator()( const std::pair< typename TypeForDimension<Dim>::Bbox, size_t >& item ) const {
+        return ! CGAL::do_intersect( segment, segments[ item.second ] );
+    }
+
+    const Segment_d& segment;
+    const std::vector< Segment_d >& segments;
+};
+
+//
+// Non degenerated segments of a LineString
+template < int Dim >
+std::vector< typename TypeForDimension<Dim>::Segment > lineStringSegments( const LineString& lineString )
+{
+    typedef typename TypeForDimension<Dim>::Point   Point_d;
+    typedef typename TypeForDimension<Dim>::Segment Segment_d;
+
+    std::vector< Segment_d > segments;
+    segments.reserve( lineString.numPoints() );
+
+    for ( size_t i = 0; i + 1 < lineString.numPoints(); i++ ) {
+        const Point_d a = lineString.pointN( i ).toPoint_d<Dim>();
+        const Point_d b = lineString.pointN( i + 1 ).toPoint_d<Dim>();
+
+        if ( a != b ) {
+            segments.push_back( Segment_d( a, b ) );
+        }
+    }
+
+    return segments;
+}
+
+//
+// Segments of the largest LineString in a static R-tree, searched with the boxes of the
+// segments of the other one
+template < int Dim >
+boost::optional< bool > intersectsLineStringLineString( const LineString& la, const LineString& lb )
+{
+    typedef typename TypeForDimension<Dim>::Segment Segment_d;
+
+    const std::vector< Segment_d > a = lineStringSegments<Dim>( la );
+    const std::vector< Segment_d > b = lineStringSegments<Dim>( lb );
+
+    if ( a.empty() || b.empty() ) {
+        return boost::none;
+    }
+
+    const std::vector< Segment_d >& indexed = a.size() < b.size() ? b : a ;
+    const std::vector< Segment_d >& queries = a.size() < b.size() ? a : b ;
+
+    StrTree< typename TypeForDimension<Dim>::Bbox, size_t > tree;
+
+    for ( size_t i = 0; i < indexed.size(); i++ ) {
+        tree.insert( indexed[i].bbox(), i );
+    }
+
+    tree.build();
+
+    for ( size_t i = 0; i < queries.size(); i++ ) {
+        SegmentIntersectsVisitor<Dim> visitor( queries[i], indexed );
+
+        if ( ! tree.query( queries[i].bbox(), visitor ) ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//
+// Point against any geometry, members of collections are tested one by one
+template < int Dim >
+boost::optional< bool > intersectsPointGeometry( const Point& p, const Geometry& g )
+{
+    switch ( g.geometryTypeId() ) {
+    case TYPE_POINT:
+        return p.toPoint_d<Dim>() == g.as< Point >().toPoint_d<Dim>();
+
+    case TYPE_LINESTRING:
+        return intersectsPointLineString<Dim>( p, g.as< LineString >() );
+
+    case TYPE_POLYGON:
+        if ( Dim == 2 ) {
+            return intersectsPointPolygon( p, g.as< Polygon >() );
+        }
+
+        return boost::none;
+
+    case TYPE_TRIANGLE:
+        if ( Dim == 2 ) {
+            const Kernel::Triangle_2 triangle = g.as< Triangle >().toTriangle_2();
+
+            if ( triangle.is_degenerate() ) {
+                return boost::none;
+            }
+
+            return triangle.bounded_side( p.toPoint_2() ) != CGAL::ON_UNBOUNDED_SIDE;
+        }
+
+        return boost::none;
+
+    case TYPE_SOLID:
+        if ( Dim == 3 ) {
+            return intersectsPointSolid( p, g.as< Solid >() );
+        }
+
+        return boost::none;
+
+    case TYPE_MULTIPOINT:
+    case TYPE_MULTILINESTRING:
+    case TYPE_MULTIPOLYGON:
+    case TYPE_GEOMETRYCOLLECTION: {
+        bool result = false;
+
+        for ( size_t i = 0; i < g.numGeometries() && ! result; i++ ) {
+            if ( g.geometryN( i ).isEmpty() ) {
+                continue;
+            }
+
+            const boost::optional< bool > r = intersectsPointGeometry<Dim>( p, g.geometryN( i ) );
+
+            if ( ! r ) {
+                return boost::none;
+            }
+
+            result = *r;
+        }
+
+        return result;
+    }
+
+    default:
+        return boost::none;
+    }
+}
+
+template < int Dim >
+boost::optional< bool > intersectsFastPathImpl( const Geometry& ga, const Geometry& gb )
+{
+    if ( ga.isEmpty() || gb.isEmpty() ) {
+        return false;
+    }
+
+    if ( ! CGAL::do_overlap( envelopeBox<Dim>( ga ), envelopeBox<Dim>( gb ) ) ) {
+        return false;
+    }
+
+    if ( ga.geometryTypeId() == TYPE_POINT ) {
+        return intersectsPointGeometry<Dim>( ga.as< Point >(), gb );
+    }
+
+    if ( gb.geometryTypeId() == TYPE_POINT ) {
+        return intersectsPointGeometry<Dim>( gb.as< Point >(), ga );
+    }
+
+    if ( ga.geometryTypeId() == TYPE_LINESTRING && gb.geometryTypeId() == TYPE_LINESTRING ) {
+        return intersectsLineStringLineString<Dim>( ga.as< LineString >(), gb.as< LineString >() );
+    }
+
+    return boost::none;
+}
+
+template < int Dim >
+boost::optional< bool > coversFastPathImpl( const Geometry& ga, const Geometry& gb )
+{
+    if ( ga.isEmpty() || gb.isEmpty() ) {
+        return false;
+    }
+
+    if ( ! boxContains<Dim>( envelopeBox<Dim>( ga ), envelopeBox<Dim>( gb ) ) ) {
+        return false;
+    }
+
+    // a point is covered as soon as it intersects
+    if ( gb.geometryTypeId() == TYPE_POINT ) {
+        return intersectsPointGeometry<Dim>( gb.as< Point >(), ga );
+    }
+
+    return boost::none;
+}
+
+}
+
+///
+///
+///
+boost::optional< bool > intersectsFastPath( const Geometry& ga, const Geometry& gb )
+{
+    return intersectsFastPathImpl<2>( ga, gb );
+}
+
+///
+///
+///
+boost::optional< bool > intersects3DFastPath( const Geometry& ga, const Geometry& gb )
+{
+    return intersectsFastPathImpl<3>( ga, gb );
+}
+
+///
+///
+///
+boost::optional< bool > coversFastPath( const Geometry& ga, const Geometry& gb )
+{
+    return coversFastPathImpl<2>( ga, gb );
+}
+
+///
+///
+///
+boost::optional< bool > covers3DFastPath( const Geometry& ga, const Geometry& gb )
+{
+    return coversFastPathImpl<3>( ga, gb );
+}
+
+}
+}
+}
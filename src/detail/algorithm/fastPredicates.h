@@ -0,0 +1,71 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef SFCGAL_FAST_PREDICATES_ALGORITHM
+#define SFCGAL_FAST_PREDICATES_ALGORITHM
+
+#include <SFCGAL/config.h>
+
+#include <boost/optional.hpp>
+
+namespace SFCGAL {
+class Geometry;
+namespace detail {
+namespace algorithm {
+
+/**
+ * Intersection test on 2D geometries for the common type pairs, without GeometrySet decomposition :
+ * disjoint envelopes, Point x Point, Point x LineString, Point x Polygon/Triangle and LineString x LineString
+ * @return the result of the test, or none if the pair of types is not handled
+ * @pre ga and gb are valid geometries
+ * @ingroup detail
+ */
+SFCGAL_API boost::optional< bool > intersectsFastPath( const Geometry& ga, const Geometry& gb );
+
+/**
+ * Intersection test on 3D geometries for the common type pairs, without GeometrySet decomposition :
+ * disjoint envelopes, Point x Point, Point x LineString, Point x Solid and LineString x LineString
+ * @return the result of the test, or none if the pair of types is not handled
+ * @pre ga and gb are valid geometries
+ * @ingroup detail
+ */
+SFCGAL_API boost::optional< bool > intersects3DFastPath( const Geometry& ga, const Geometry& gb );
+
+/**
+ * Cover test on 2D geometries for the common type pairs : envelope of gb not contained in the
+ * envelope of ga, and gb a Point (where covers is intersects)
+ * @return the result of the test, or none if the pair of types is not handled
+ * @pre ga and gb are valid geometries
+ * @ingroup detail
+ */
+SFCGAL_API boost::optional< bool > coversFastPath( const Geometry& ga, const Geometry& gb );
+
+/**
+ * Cover test on 3D geometries for the common type pairs, see coversFastPath
+ * @return the result of the test, or none if the pair of types is not handled
+ * @pre ga and gb are valid geometries
+ * @ingroup detail
+ */
+SFCGAL_API boost::optional< bool > covers3DFastPath( const Geometry& ga, const Geometry& gb );
+
+}
+}
+}
+
+#endif
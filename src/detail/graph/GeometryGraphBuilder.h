@@ -29,6 +29,7 @@
 #include <SFCGAL/TriangulatedSurface.h>
 
 #include <SFCGAL/detail/graph/GeometryGraph.h>
+#include <SFCGAL/detail/CoordinateHash.h>
 
 namespace SFCGAL {
 namespace graph {
@@ -53,7 +54,7 @@ public:
     /**
      * allows to match duplicates
      */
-    typedef std::map< Coordinate, vertex_descriptor >  coordinate_list ;
+    typedef typename detail::CoordinateIndex< Coordinate, vertex_descriptor >::Type  coordinate_list ;
 
     /**
      * default constructor
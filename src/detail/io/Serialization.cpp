@@ -32,6 +32,9 @@
 #include <SFCGAL/MultiLineString.h>
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/Exception.h>
+
+#include <boost/format.hpp>
 
 namespace SFCGAL {
 namespace io {
@@ -118,6 +121,59 @@ std::unique_ptr<PreparedGeometry> readBinaryPrepared( const std::string& str )
     iarc >> pg;
     return std::unique_ptr<PreparedGeometry>( pg );
 }
+
+///
+///
+///
+template <int Dim>
+std::string writeBinaryIndex( const index::SpatialIndex<Dim>& idx )
+{
+    std::ostringstream ostr;
+    BinarySerializer arc( ostr );
+    const int dimension = Dim;
+    arc << dimension;
+    arc << idx;
+    return ostr.str();
+}
+
+///
+///
+///
+template <int Dim>
+std::unique_ptr< index::SpatialIndex<Dim> > readBinaryIndex( const std::string& str )
+{
+    std::istringstream istr( str );
+    BinaryUnserializer iarc( istr );
+    int dimension;
+    iarc >> dimension;
+
+    if ( dimension != Dim ) {
+        BOOST_THROW_EXCEPTION( Exception(
+                                   ( boost::format( "can't read a %1%D spatial index as a %2%D one" ) % dimension % Dim ).str()
+                               ) );
+    }
+
+    std::unique_ptr< index::SpatialIndex<Dim> > idx( new index::SpatialIndex<Dim>() );
+    iarc >> *idx;
+    return idx;
+}
+
+///
+///
+///
+int readBinaryIndexDimension( const std::string& str )
+{
+    std::istringstream istr( str );
+    BinaryUnserializer iarc( istr );
+    int dimension;
+    iarc >> dimension;
+    return dimension;
+}
+
+template SFCGAL_API std::string writeBinaryIndex<2>( const index::SpatialIndex<2>& );
+template SFCGAL_API std::string writeBinaryIndex<3>( const index::SpatialIndex<3>& );
+template SFCGAL_API std::unique_ptr< index::SpatialIndex<2> > readBinaryIndex<2>( const std::string& );
+template SFCGAL_API std::unique_ptr< index::SpatialIndex<3> > readBinaryIndex<3>( const std::string& );
 }
 }
 namespace boost {
@@ -26,6 +26,7 @@
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Geometry.h>
 #include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/index/SpatialIndex.h>
 
 #include <boost/assert.hpp>
 #include <boost/serialization/split_member.hpp>
@@ -74,6 +75,25 @@ SFCGAL_API std::unique_ptr<SFCGAL::Geometry> readBinaryGeometry( const std::stri
  * Read a PreparedGeometry from a binary representation
  */
 SFCGAL_API std::unique_ptr<SFCGAL::PreparedGeometry> readBinaryPrepared( const std::string& );
+
+/**
+ * Convert a spatial index to its binary representation (dimension followed by the entries)
+ * @warning resulting string may contain 0s
+ */
+template <int Dim>
+SFCGAL_API std::string writeBinaryIndex( const SFCGAL::index::SpatialIndex<Dim>& );
+
+/**
+ * Read a spatial index from a binary representation
+ * @throws Exception if the stored index is not of dimension Dim
+ */
+template <int Dim>
+SFCGAL_API std::unique_ptr< SFCGAL::index::SpatialIndex<Dim> > readBinaryIndex( const std::string& );
+
+/**
+ * Returns the dimension (2 or 3) of a spatial index stored in a binary representation
+ */
+SFCGAL_API int readBinaryIndexDimension( const std::string& );
 }
 }
 
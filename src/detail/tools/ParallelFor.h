@@ -0,0 +1,184 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_TOOLS_PARALLELFOR_H_
+#define _SFCGAL_DETAIL_TOOLS_PARALLELFOR_H_
+
+#include <SFCGAL/config.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace SFCGAL {
+namespace tools {
+
+///
+/// Minimum number of tasks given to each thread by parallelFor, fewer tasks
+/// are not worth starting a thread
+///
+const size_t PARALLEL_FOR_MIN_TASKS_PER_THREAD = 4 ;
+
+///
+/// Flag set on the threads running the tasks of a parallelFor
+///
+inline bool& parallelForWorkerFlag()
+{
+    static thread_local bool inside = false ;
+    return inside ;
+}
+
+///
+/// Tests if the current thread runs a task of a parallelFor. Nested parallelFor are
+/// run sequentially, callers may use it to skip the preparation of parallel work.
+///
+inline bool insideParallelFor()
+{
+    return parallelForWorkerFlag() ;
+}
+
+namespace detail {
+///
+/// Sets the worker flag of the current thread for the lifetime of the object
+///
+class ParallelForWorkerScope {
+public:
+    ParallelForWorkerScope():
+        _previous( parallelForWorkerFlag() ) {
+        parallelForWorkerFlag() = true ;
+    }
+    ~ParallelForWorkerScope() {
+        parallelForWorkerFlag() = _previous ;
+    }
+private:
+    bool _previous ;
+
+    ParallelForWorkerScope( const ParallelForWorkerScope& );
+    ParallelForWorkerScope& operator=( const ParallelForWorkerScope& );
+};
+
+///
+/// Joins the started threads, including when leaving on an exception
+///
+class ThreadJoiner {
+public:
+    explicit ThreadJoiner( std::vector< std::thread >& threads ):
+        _threads( threads ) {
+    }
+    ~ThreadJoiner() {
+        for ( size_t t = 0; t < _threads.size(); ++t ) {
+            if ( _threads[t].joinable() ) {
+                _threads[t].join();
+            }
+        }
+    }
+private:
+    std::vector< std::thread >& _threads ;
+
+    ThreadJoiner( const ThreadJoiner& );
+    ThreadJoiner& operator=( const ThreadJoiner& );
+};
+} // namespace detail
+
+///
+/// Calls task( i ) for i in [0,numTasks) on numThreads threads (the calling thread
+/// included). Threads pick the next task from a shared counter, so that a slow task
+/// doesn't hold back the others.
+///
+/// Threads are started for each call : at most one thread is used for each
+/// PARALLEL_FOR_MIN_TASKS_PER_THREAD tasks, and a parallelFor called from a task of
+/// another one runs sequentially on the calling thread, so that nested calls
+/// don't oversubscribe the machine. If a thread can't be started, the started
+/// ones share the tasks.
+///
+/// The order in which tasks are run is unspecified : to get a deterministic result,
+/// each task must write to its own output, and outputs must be combined in task order.
+///
+/// The first exception thrown by a task is rethrown once all the threads are joined,
+/// remaining tasks are skipped.
+///
+template < typename Task >
+void parallelFor( size_t numTasks, size_t numThreads, Task& task )
+{
+    numThreads = std::min( std::max( numThreads, size_t( 1 ) ), numTasks / PARALLEL_FOR_MIN_TASKS_PER_THREAD );
+
+    if ( numThreads <= 1 || insideParallelFor() ) {
+        for ( size_t i = 0; i < numTasks; ++i ) {
+            task( i );
+        }
+
+        return;
+    }
+
+    std::atomic< size_t > next( 0 );
+    std::atomic< bool > failed( false );
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        detail::ParallelForWorkerScope scope ;
+
+        for ( size_t i = next++; i < numTasks && ! failed; i = next++ ) {
+            try {
+                task( i );
+            }
+            catch ( ... ) {
+                std::lock_guard< std::mutex > lock( errorMutex );
+
+                if ( ! error ) {
+                    error = std::current_exception();
+                }
+
+                failed = true;
+            }
+        }
+    };
+
+    std::vector< std::thread > threads;
+    threads.reserve( numThreads - 1 );
+
+    {
+        detail::ThreadJoiner joiner( threads );
+
+        try {
+            for ( size_t t = 1; t < numThreads; ++t ) {
+                // no reallocation, a thread is never left unowned
+                threads.emplace_back( worker );
+            }
+        }
+        catch ( std::system_error& ) {
+            // no more threads available, the started ones do the work
+        }
+
+        worker();
+    }
+
+    if ( error ) {
+        std::rethrow_exception( error );
+    }
+}
+
+} // namespace tools
+} // namespace SFCGAL
+
+#endif
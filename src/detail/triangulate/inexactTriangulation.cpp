@@ -0,0 +1,147 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/detail/triangulate/inexactTriangulation.h>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/Exception.h>
+
+#include <SFCGAL/detail/InexactGeometrySet.h>
+
+namespace SFCGAL {
+namespace triangulate {
+namespace detail {
+
+typedef InexactCDT::Vertex_handle Vertex_handle ;
+
+namespace {
+
+Vertex_handle _addVertex( InexactCDT& cdt, const Point& p )
+{
+    Vertex_handle vertex = cdt.insert( SFCGAL::detail::toInexactPoint_2( p ) );
+    vertex->info().original = p.coordinate() ;
+    return vertex ;
+}
+
+void _addLineString( InexactCDT& cdt, const LineString& g )
+{
+    Vertex_handle last ;
+
+    for ( size_t i = 0; i < g.numPoints(); i++ ) {
+        Vertex_handle vertex = _addVertex( cdt, g.pointN( i ) );
+
+        if ( i != 0 && last != vertex ) {
+            cdt.insert_constraint( last, vertex ) ;
+        }
+
+        last = vertex ;
+    }
+}
+
+}
+
+///
+///
+///
+void insertInexact2DZ( const Geometry& g, InexactCDT& cdt )
+{
+    if ( g.isEmpty() ) {
+        return;
+    }
+
+    switch ( g.geometryTypeId() ) {
+    case TYPE_POINT:
+        _addVertex( cdt, g.as< Point >() );
+        return ;
+
+    case TYPE_LINESTRING:
+        _addLineString( cdt, g.as< LineString >() );
+        return ;
+
+    case TYPE_POLYGON: {
+        const Polygon& polygon = g.as< Polygon >();
+
+        for ( size_t i = 0; i < polygon.numRings(); i++ ) {
+            _addLineString( cdt, polygon.ringN( i ) ) ;
+        }
+
+        return ;
+    }
+
+    case TYPE_TRIANGLE:
+        _addLineString( cdt, g.as< Triangle >().toPolygon().exteriorRing() );
+        return ;
+
+    case TYPE_MULTIPOINT:
+    case TYPE_MULTILINESTRING:
+    case TYPE_MULTIPOLYGON:
+    case TYPE_POLYHEDRALSURFACE:
+    case TYPE_TRIANGULATEDSURFACE:
+    case TYPE_GEOMETRYCOLLECTION:
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            insertInexact2DZ( g.geometryN( i ), cdt ) ;
+        }
+
+        return ;
+
+    case TYPE_SOLID:
+    case TYPE_MULTISOLID:
+        BOOST_THROW_EXCEPTION(
+            InappropriateGeometryException(
+                ( boost::format( "can't process 2DZ triangulation for type '%1%'" ) % g.geometryType() ).str()
+            )
+        );
+    }
+}
+
+///
+///
+///
+bool getInexactTriangles( const InexactCDT& cdt, TriangulatedSurface& triangulatedSurface, bool filterExteriorParts )
+{
+    bool complete = true ;
+
+    for ( InexactCDT::Finite_faces_iterator it = cdt.finite_faces_begin(); it != cdt.finite_faces_end(); ++it ) {
+        if ( filterExteriorParts && ( it->info().nestingLevel % 2 == 0 ) ) {
+            continue ;
+        }
+
+        const Coordinate& a = it->vertex( 0 )->info().original ;
+        const Coordinate& b = it->vertex( 1 )->info().original ;
+        const Coordinate& c = it->vertex( 2 )->info().original ;
+
+        if ( !a.isEmpty() &&  !b.isEmpty() && !c.isEmpty() ) {
+            triangulatedSurface.addTriangle( new Triangle( Point( a ), Point( b ), Point( c ) ) );
+        }
+        else {
+            complete = false ;
+        }
+    }
+
+    return complete ;
+}
+
+} // namespace detail
+} // namespace triangulate
+} // namespace SFCGAL
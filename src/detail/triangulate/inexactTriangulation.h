@@ -0,0 +1,66 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_TRIANGULATE_DETAIL_INEXACTTRIANGULATION_H_
+#define _SFCGAL_TRIANGULATE_DETAIL_INEXACTTRIANGULATION_H_
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/detail/triangulate/ConstraintDelaunayTriangulation.h>
+
+namespace SFCGAL {
+class Geometry ;
+class TriangulatedSurface ;
+}
+
+namespace SFCGAL {
+namespace triangulate {
+namespace detail {
+
+typedef CGAL::Triangulation_vertex_base_with_info_2< ConstraintDelaunayTriangulation::VertexInfo, InexactKernel >  InexactTriangulation_vertex_base ;
+typedef CGAL::Triangulation_face_base_with_info_2< ConstraintDelaunayTriangulation::FaceInfo, InexactKernel >      InexactTriangulation_face_base ;
+typedef CGAL::Constrained_triangulation_face_base_2< InexactKernel, InexactTriangulation_face_base >                InexactConstrained_triangulation_face_base ;
+typedef CGAL::Triangulation_data_structure_2< InexactTriangulation_vertex_base,
+        InexactConstrained_triangulation_face_base >                                                               InexactTriangulation_data_structure ;
+
+/**
+ * @brief double precision counterpart of ConstraintDelaunayTriangulation::CDT (OXY plane only)
+ */
+typedef CGAL::Constrained_Delaunay_triangulation_2< InexactKernel, InexactTriangulation_data_structure, CGAL::Exact_predicates_tag > InexactCDT ;
+
+/**
+ * @brief insert the points and the constraints of a Geometry in a double precision triangulation,
+ * keeping the original coordinates in the vertex info
+ * @throw InappropriateGeometryException for solids
+ */
+SFCGAL_API void insertInexact2DZ( const Geometry& g, InexactCDT& cdt ) ;
+
+/**
+ * @brief Append the triangles of a double precision triangulation to a TriangulatedSurface
+ * @return false if a triangle has been skipped because one of its vertices was created by
+ * the intersection of two constraints (no original coordinate)
+ */
+SFCGAL_API bool getInexactTriangles( const InexactCDT& cdt, TriangulatedSurface& triangulatedSurface, bool filterExteriorParts = false ) ;
+
+} // namespace detail
+} // namespace triangulate
+} // namespace SFCGAL
+
+#endif
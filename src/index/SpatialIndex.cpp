@@ -0,0 +1,262 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/index/SpatialIndex.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/GeometryCollection.h>
+
+namespace SFCGAL {
+namespace index {
+
+namespace {
+
+//
+// collects the identifiers of the visited items, up to a maximum count
+struct CollectIds {
+    CollectIds( std::vector< size_t >& ids_, size_t maxCount_ ):
+        ids( ids_ ), maxCount( maxCount_ ) {}
+
+    template < typename Item >
+    bool operator()( const Item& item ) {
+        ids.push_back( item.second );
+        return ids.size() < maxCount ;
+    }
+
+    std::vector< size_t >& ids ;
+    size_t maxCount ;
+};
+
+//
+// squared distance from the boxes of the tree to a fixed box
+template < typename Box >
+struct DistanceToBox {
+    DistanceToBox( const Box& box_ ): box( box_ ) {}
+
+    double operator()( const Box& other ) const {
+        return detail::squaredDistance( box, other );
+    }
+
+    const Box& box ;
+};
+
+}
+
+///
+///
+///
+template < int Dim >
+SpatialIndex<Dim>::SpatialIndex( size_t nodeCapacity ):
+    _nodeCapacity( nodeCapacity ),
+    _built( false ),
+    _tree( nodeCapacity )
+{
+}
+
+///
+///
+///
+template < int Dim >
+SpatialIndex<Dim>::SpatialIndex( const Geometry& geometry, size_t nodeCapacity ):
+    _nodeCapacity( nodeCapacity ),
+    _built( false ),
+    _tree( nodeCapacity )
+{
+    if ( geometry.is< GeometryCollection >() ) {
+        for ( size_t i = 0; i < geometry.numGeometries(); i++ ) {
+            insert( geometry.geometryN( i ), i );
+        }
+    }
+    else {
+        insert( geometry, 0 );
+    }
+
+    build();
+}
+
+///
+///
+///
+template < int Dim >
+void SpatialIndex<Dim>::insert( const Box& box, size_t id )
+{
+    if ( _built ) {
+        BOOST_THROW_EXCEPTION( Exception( "can't insert in a spatial index once it is built" ) );
+    }
+
+    _tree.insert( box, id );
+}
+
+///
+///
+///
+template < int Dim >
+void SpatialIndex<Dim>::insert( const Envelope& envelope, size_t id )
+{
+    if ( envelope.isEmpty() ) {
+        return ;
+    }
+
+    insert( toBox( envelope ), id );
+}
+
+///
+///
+///
+template < int Dim >
+void SpatialIndex<Dim>::insert( const Geometry& geometry, size_t id )
+{
+    if ( geometry.isEmpty() ) {
+        return ;
+    }
+
+    insert( geometry.envelope(), id );
+}
+
+///
+///
+///
+template < int Dim >
+void SpatialIndex<Dim>::build()
+{
+    if ( _built ) {
+        return ;
+    }
+
+    _tree.build();
+    _built = true ;
+}
+
+///
+///
+///
+template < int Dim >
+std::vector< size_t > SpatialIndex<Dim>::query( const Box& box ) const
+{
+    if ( ! _built ) {
+        BOOST_THROW_EXCEPTION( Exception( "spatial index queried before being built" ) );
+    }
+
+    std::vector< size_t > ids ;
+    CollectIds visitor( ids, _tree.size() + 1 );
+    _tree.query( box, visitor );
+    return ids ;
+}
+
+///
+///
+///
+template < int Dim >
+std::vector< size_t > SpatialIndex<Dim>::query( const Envelope& envelope ) const
+{
+    if ( envelope.isEmpty() ) {
+        return std::vector< size_t >();
+    }
+
+    return query( toBox( envelope ) );
+}
+
+///
+///
+///
+template < int Dim >
+std::vector< size_t > SpatialIndex<Dim>::candidates( const Geometry& geometry ) const
+{
+    if ( geometry.isEmpty() ) {
+        return std::vector< size_t >();
+    }
+
+    return query( geometry.envelope() );
+}
+
+///
+///
+///
+template < int Dim >
+std::vector< size_t > SpatialIndex<Dim>::nearest( const Box& box, size_t k ) const
+{
+    if ( ! _built ) {
+        BOOST_THROW_EXCEPTION( Exception( "spatial index queried before being built" ) );
+    }
+
+    std::vector< size_t > ids ;
+
+    if ( k == 0 ) {
+        return ids ;
+    }
+
+    CollectIds visitor( ids, k );
+    _tree.nearest( DistanceToBox< Box >( box ), visitor );
+    return ids ;
+}
+
+///
+///
+///
+template < int Dim >
+std::vector< size_t > SpatialIndex<Dim>::nearest( const Envelope& envelope, size_t k ) const
+{
+    if ( envelope.isEmpty() ) {
+        return std::vector< size_t >();
+    }
+
+    return nearest( toBox( envelope ), k );
+}
+
+///
+///
+///
+template <>
+SpatialIndex<2>::Box SpatialIndex<2>::toBox( const Envelope& envelope )
+{
+    return envelope.toBbox_2();
+}
+
+///
+///
+///
+template <>
+SpatialIndex<3>::Box SpatialIndex<3>::toBox( const Envelope& envelope )
+{
+    return envelope.toBbox_3();
+}
+
+///
+///
+///
+template <>
+SpatialIndex<2>::Box SpatialIndex<2>::_makeBox( const double* lo, const double* hi )
+{
+    return CGAL::Bbox_2( lo[0], lo[1], hi[0], hi[1] );
+}
+
+///
+///
+///
+template <>
+SpatialIndex<3>::Box SpatialIndex<3>::_makeBox( const double* lo, const double* hi )
+{
+    return CGAL::Bbox_3( lo[0], lo[1], lo[2], hi[0], hi[1], hi[2] );
+}
+
+template class SpatialIndex<2>;
+template class SpatialIndex<3>;
+
+} // namespace index
+} // namespace SFCGAL
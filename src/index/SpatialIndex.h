@@ -0,0 +1,276 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_INDEX_SPATIALINDEX_H_
+#define _SFCGAL_INDEX_SPATIALINDEX_H_
+
+#include <SFCGAL/config.h>
+
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/detail/StrTree.h>
+
+#include <boost/serialization/split_member.hpp>
+#include <boost/format.hpp>
+
+#include <vector>
+
+#include <stdint.h> // uint64_t
+
+namespace SFCGAL {
+
+class Geometry;
+
+namespace index {
+
+/**
+ * Type of the keys of a SpatialIndex<Dim>
+ */
+template < int Dim >
+struct IndexBox {};
+
+template <>
+struct IndexBox<2> {
+    typedef CGAL::Bbox_2 Type ;
+};
+
+template <>
+struct IndexBox<3> {
+    typedef CGAL::Bbox_3 Type ;
+};
+
+/**
+ * Static R-tree over 2D (CGAL::Bbox_2) or 3D (CGAL::Bbox_3) boxes associated with
+ * user identifiers, bulk loaded with the Sort-Tile-Recursive algorithm.
+ *
+ * Entries are added with insert() and the index is packed once with build(); it is
+ * read-only afterwards and can be queried concurrently.
+ *
+ * In 3D, 2D envelopes are indexed with a null extent in Z.
+ */
+template < int Dim >
+class SpatialIndex {
+public:
+    typedef typename IndexBox<Dim>::Type Box ;
+
+    /**
+     * Empty index
+     * @param nodeCapacity maximum number of children of a node
+     */
+    SpatialIndex( size_t nodeCapacity = 16 );
+
+    /**
+     * Builds an index over the members of a collection (or over the geometry itself
+     * if it is not a collection). The identifier of a member is its position in the
+     * collection, empty members are not indexed.
+     */
+    explicit SpatialIndex( const Geometry& geometry, size_t nodeCapacity = 16 );
+
+    /**
+     * Adds a box
+     * @pre build() was not called
+     */
+    void insert( const Box& box, size_t id );
+
+    /**
+     * Adds an envelope, empty envelopes are ignored
+     * @pre build() was not called
+     */
+    void insert( const Envelope& envelope, size_t id );
+
+    /**
+     * Adds the envelope of a geometry, empty geometries are ignored
+     * @pre build() was not called
+     */
+    void insert( const Geometry& geometry, size_t id );
+
+    /**
+     * Packs the index. Must be called once, after the last insertion
+     */
+    void build();
+
+    /**
+     * Returns true if build() was called
+     */
+    inline bool isBuilt() const {
+        return _built ;
+    }
+
+    /**
+     * Number of indexed entries
+     */
+    inline size_t size() const {
+        return _tree.size();
+    }
+
+    /**
+     * Returns true if the index holds no entry
+     */
+    inline bool isEmpty() const {
+        return _tree.empty();
+    }
+
+    /**
+     * Node capacity of the tree
+     */
+    inline size_t nodeCapacity() const {
+        return _nodeCapacity ;
+    }
+
+    /**
+     * Window query : returns the identifiers of the entries overlapping box
+     * @pre build() was called
+     */
+    std::vector< size_t > query( const Box& box ) const;
+
+    /**
+     * Window query : returns the identifiers of the entries overlapping envelope
+     * @pre build() was called
+     */
+    std::vector< size_t > query( const Envelope& envelope ) const;
+
+    /**
+     * Returns the identifiers of the entries that may intersect geometry, i.e. those
+     * whose box overlaps the envelope of geometry
+     * @pre build() was called
+     */
+    std::vector< size_t > candidates( const Geometry& geometry ) const;
+
+    /**
+     * Returns the identifiers of the k entries whose boxes are the closest to box,
+     * by increasing box distance
+     * @pre build() was called
+     */
+    std::vector< size_t > nearest( const Box& box, size_t k = 1 ) const;
+
+    /**
+     * Returns the identifiers of the k entries whose boxes are the closest to
+     * envelope, by increasing box distance
+     * @pre build() was called
+     */
+    std::vector< size_t > nearest( const Envelope& envelope, size_t k = 1 ) const;
+
+    /**
+     * Underlying tree, whose values are the identifiers
+     */
+    inline const detail::StrTree< Box, size_t >& tree() const {
+        return _tree ;
+    }
+
+    /**
+     * Converts an envelope to a key
+     * @pre ! envelope.isEmpty()
+     */
+    static Box toBox( const Envelope& envelope );
+
+    /**
+     * Serializer, the entries are stored and the tree is packed again on loading
+     */
+    template <class Archive>
+    void save( Archive& ar, const unsigned int /*version*/ ) const {
+        int dimension = Dim ;
+        ar& dimension;
+        uint64_t capacity = _nodeCapacity ;
+        ar& capacity;
+        bool built = _built ;
+        ar& built;
+        uint64_t n = _tree.size() ;
+        ar& n;
+
+        for ( size_t i = 0; i < _tree.items().size(); i++ ) {
+            const typename detail::StrTree< Box, size_t >::Item& item = _tree.items()[i];
+
+            for ( int j = 0; j < Dim; j++ ) {
+                double lo = item.first.min( j );
+                double hi = item.first.max( j );
+                ar& lo;
+                ar& hi;
+            }
+
+            uint64_t id = item.second ;
+            ar& id;
+        }
+    }
+
+    template <class Archive>
+    void load( Archive& ar, const unsigned int /*version*/ ) {
+        int dimension ;
+        ar& dimension;
+
+        if ( dimension != Dim ) {
+            BOOST_THROW_EXCEPTION( Exception(
+                                       ( boost::format( "can't load a %1%D spatial index as a %2%D one" ) % dimension % Dim ).str()
+                                   ) );
+        }
+
+        uint64_t capacity ;
+        ar& capacity;
+        bool built ;
+        ar& built;
+        uint64_t n ;
+        ar& n;
+
+        _nodeCapacity = capacity ;
+        _tree = detail::StrTree< Box, size_t >( _nodeCapacity );
+        _built = false ;
+
+        for ( uint64_t i = 0; i < n; i++ ) {
+            double lo[3] = { 0.0, 0.0, 0.0 };
+            double hi[3] = { 0.0, 0.0, 0.0 };
+
+            for ( int j = 0; j < Dim; j++ ) {
+                ar& lo[j];
+                ar& hi[j];
+            }
+
+            uint64_t id ;
+            ar& id;
+            insert( _makeBox( lo, hi ), id );
+        }
+
+        if ( built ) {
+            build();
+        }
+    }
+
+    template <class Archive>
+    void serialize( Archive& ar, const unsigned int version ) {
+        boost::serialization::split_member( ar, *this, version );
+    }
+
+private:
+    size_t _nodeCapacity ;
+    bool _built ;
+    detail::StrTree< Box, size_t > _tree ;
+
+    static Box _makeBox( const double* lo, const double* hi );
+};
+
+template <> CGAL::Bbox_2 SpatialIndex<2>::toBox( const Envelope& envelope );
+template <> CGAL::Bbox_3 SpatialIndex<3>::toBox( const Envelope& envelope );
+template <> CGAL::Bbox_2 SpatialIndex<2>::_makeBox( const double* lo, const double* hi );
+template <> CGAL::Bbox_3 SpatialIndex<3>::_makeBox( const double* lo, const double* hi );
+
+typedef SpatialIndex<2> SpatialIndex2D ;
+typedef SpatialIndex<3> SpatialIndex3D ;
+
+} // namespace index
+} // namespace SFCGAL
+
+#endif
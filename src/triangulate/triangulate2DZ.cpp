@@ -24,9 +24,12 @@
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/Polygon.h>
 #include <SFCGAL/Triangle.h>
+#include <SFCGAL/TriangulatedSurface.h>
 
 #include <SFCGAL/Exception.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/computationMode.h>
+#include <SFCGAL/detail/triangulate/inexactTriangulation.h>
 
 namespace SFCGAL {
 namespace triangulate {
@@ -162,6 +165,25 @@ ConstraintDelaunayTriangulation triangulate2DZ( const Geometry& g )
     return triangulation ;
 }
 
+///
+///
+///
+std::unique_ptr< TriangulatedSurface > triangulate2DZ( const Geometry& g, algorithm::FastMode )
+{
+    std::unique_ptr< TriangulatedSurface > result( new TriangulatedSurface );
+
+    if ( g.isEmpty() ) {
+        return result;
+    }
+
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+
+    detail::InexactCDT cdt ;
+    detail::insertInexact2DZ( g, cdt );
+    detail::getInexactTriangles( cdt, *result );
+    return result ;
+}
+
 
 }//triangulate
 }//SFCGAL
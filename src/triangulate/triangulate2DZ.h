@@ -27,6 +27,10 @@
 #include <SFCGAL/detail/triangulate/ConstraintDelaunayTriangulation.h>
 
 namespace SFCGAL {
+namespace algorithm {
+struct FastMode;
+}
+
 namespace triangulate {
 /**
  * @brief Constraint 2DZ Delaunay Triangulation (keep Z if defined, a projectionPlane may be provided)
@@ -36,6 +40,12 @@ SFCGAL_API void triangulate2DZ( const Geometry& g, ConstraintDelaunayTriangulati
  * @brief Constraint 2DZ Delaunay Triangulation (keep Z if defined, project points in OXY plane)
  */
 SFCGAL_API ConstraintDelaunayTriangulation triangulate2DZ( const Geometry& g );
+/**
+ * @brief Constraint 2DZ Delaunay Triangulation in double precision (keep Z if defined, project points in OXY plane)
+ * @return the triangles of the triangulation
+ * @see algorithm::FastMode for the robustness contract
+ */
+SFCGAL_API std::unique_ptr< TriangulatedSurface > triangulate2DZ( const Geometry& g, algorithm::FastMode );
 
 }//algorithm
 }//SFCGAL
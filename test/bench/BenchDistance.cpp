@@ -0,0 +1,134 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/MultiPolygon.h>
+
+#include "../test_config.h"
+#include "Bench.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/algorithm/distance.h>
+
+#include <cmath>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchDistance )
+
+namespace {
+//
+// closed wavy "coastline" of n points around a circle of radius 100
+std::unique_ptr< LineString > coastline( size_t n )
+{
+    std::unique_ptr< LineString > ring( new LineString() );
+
+    for ( size_t i = 0; i < n; i++ ) {
+        const double angle = 2.0 * M_PI * i / n ;
+        const double radius = 100.0 + 2.0 * std::sin( 200.0 * angle );
+        ring->addPoint( Point( radius * std::cos( angle ), radius * std::sin( angle ) ) );
+    }
+
+    const Point start = ring->startPoint();
+    ring->addPoint( start );
+    return ring;
+}
+}
+
+//
+// short LineStrings against a large shoreline
+BOOST_AUTO_TEST_CASE( testDistanceLineStringShoreline )
+{
+    const size_t N = 100 ;
+    std::unique_ptr< LineString > shoreline = coastline( 50000 );
+
+    std::vector< LineString > tracks ;
+
+    for ( size_t i = 0; i < N; i++ ) {
+        const double angle = 2.0 * M_PI * i / N ;
+        tracks.push_back( LineString(
+                              Point( 110.0 * std::cos( angle ), 110.0 * std::sin( angle ) ),
+                              Point( 120.0 * std::cos( angle ), 120.0 * std::sin( angle ) )
+                          ) );
+    }
+
+    bench().start( boost::format( "distance shoreline(50000) x %1% linestrings" ) % N ) ;
+
+    for ( size_t i = 0; i < N; i++ ) {
+        algorithm::distanceLineStringLineString( tracks[i], *shoreline );
+    }
+
+    bench().stop();
+}
+
+//
+// polygon against a polygon with a large ring
+BOOST_AUTO_TEST_CASE( testDistancePolygonPolygon )
+{
+    Polygon island( *coastline( 20000 ) );
+    std::unique_ptr< LineString > ring = coastline( 2000 );
+
+    bench().start( "distance polygon(20000) x polygon(2000)" ) ;
+
+    for ( size_t i = 0; i < 10; i++ ) {
+        std::unique_ptr< LineString > shifted( new LineString() );
+
+        for ( size_t j = 0; j < ring->numPoints(); j++ ) {
+            shifted->addPoint( Point( ring->pointN( j ).x() + 250.0 + i, ring->pointN( j ).y() ) );
+        }
+
+        algorithm::distancePolygonPolygon( island, Polygon( *shifted ) );
+    }
+
+    bench().stop();
+}
+
+//
+// points against a chain of small islands
+BOOST_AUTO_TEST_CASE( testDistanceIslandChain )
+{
+    const size_t N = 50000 ;
+    MultiPolygon islands ;
+
+    for ( size_t i = 0; i < N; i++ ) {
+        const double x = 3.0 * i ;
+        const double y = 10.0 * std::sin( 0.01 * i );
+        std::unique_ptr< LineString > ring( new LineString() );
+        ring->addPoint( Point( x, y ) );
+        ring->addPoint( Point( x + 1.0, y ) );
+        ring->addPoint( Point( x + 1.0, y + 1.0 ) );
+        ring->addPoint( Point( x, y + 1.0 ) );
+        ring->addPoint( Point( x, y ) );
+        islands.addGeometry( new Polygon( ring.release() ) );
+    }
+
+    bench().start( boost::format( "distance multipolygon(%1%) x 100 points" ) % N ) ;
+
+    for ( size_t i = 0; i < 100; i++ ) {
+        algorithm::distance( Point( 1500.0 * i, 50.0 ), islands );
+    }
+
+    bench().stop();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
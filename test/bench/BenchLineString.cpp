@@ -0,0 +1,284 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <fstream>
+#include <new>
+#include <vector>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/detail/GetPointsVisitor.h>
+
+#include "../test_config.h"
+#include "Bench.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/format.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+namespace {
+
+//
+// Allocations done through CountingAllocator and CountingCloneAllocator, only the
+// containers being measured use them (the global operator new is left untouched)
+size_t numAllocations = 0 ;
+size_t liveBytes = 0 ;
+
+void* countedAllocate( size_t size )
+{
+    void* p = ::operator new( size );
+    ++numAllocations ;
+    liveBytes += size ;
+    return p ;
+}
+
+void countedDeallocate( void* p, size_t size )
+{
+    liveBytes -= size ;
+    ::operator delete( p );
+}
+
+/**
+ * std allocator counting its allocations
+ */
+template < typename T >
+struct CountingAllocator {
+    typedef T value_type ;
+
+    CountingAllocator() {}
+    template < typename U >
+    CountingAllocator( const CountingAllocator< U >& ) {}
+
+    T* allocate( size_t n ) {
+        return static_cast< T* >( countedAllocate( n * sizeof( T ) ) );
+    }
+    void deallocate( T* p, size_t n ) {
+        countedDeallocate( p, n * sizeof( T ) );
+    }
+};
+
+template < typename T, typename U >
+bool operator == ( const CountingAllocator< T >&, const CountingAllocator< U >& )
+{
+    return true ;
+}
+
+template < typename T, typename U >
+bool operator != ( const CountingAllocator< T >&, const CountingAllocator< U >& )
+{
+    return false ;
+}
+
+/**
+ * boost::ptr_container clone allocator counting the allocation of each element
+ */
+struct CountingCloneAllocator {
+    template < typename U >
+    static U* allocate_clone( const U& r ) {
+        void* p = countedAllocate( sizeof( U ) );
+
+        try {
+            return new ( p ) U( r );
+        }
+        catch ( ... ) {
+            countedDeallocate( p, sizeof( U ) );
+            throw ;
+        }
+    }
+
+    template < typename U >
+    static void deallocate_clone( const U* r ) {
+        if ( r == NULL ) {
+            return ;
+        }
+
+        r->~U();
+        countedDeallocate( const_cast< U* >( r ), sizeof( U ) );
+    }
+};
+
+/**
+ * Measures the counted allocations done during its lifetime
+ */
+struct AllocationCounter {
+    AllocationCounter():
+        _numAllocations( numAllocations ),
+        _liveBytes( liveBytes ) {
+    }
+
+    size_t allocations() const {
+        return numAllocations - _numAllocations ;
+    }
+
+    /**
+     * bytes allocated and not released since the construction (allocator overhead excluded)
+     */
+    long long bytes() const {
+        return static_cast< long long >( liveBytes ) - static_cast< long long >( _liveBytes ) ;
+    }
+
+    size_t _numAllocations ;
+    size_t _liveBytes ;
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchLineString )
+
+namespace {
+
+std::vector< std::string > readCountries()
+{
+    std::string filename( SFCGAL_TEST_DIRECTORY );
+    filename += "/data/countries.wkt" ;
+
+    std::ifstream ifs( filename.c_str() );
+    BOOST_REQUIRE( ifs.good() ) ;
+
+    std::vector< std::string > wkts ;
+    std::string line ;
+
+    while ( std::getline( ifs, line ) ) {
+        if ( ! line.empty() ) {
+            wkts.push_back( line );
+        }
+    }
+
+    return wkts ;
+}
+
+}
+
+//
+// Read countries.wkt, the LineStrings of the rings store their points contiguously
+BOOST_AUTO_TEST_CASE( testReadCountries )
+{
+    const std::vector< std::string > wkts = readCountries();
+
+    bench().start( boost::format( "READ WKT countries (%1% geometries)" ) % wkts.size() );
+
+    for ( size_t i = 0; i < wkts.size(); i++ ) {
+        io::readWkt( wkts[i] ) ;
+    }
+
+    bench().stop() ;
+}
+
+//
+// Compare the former boost::ptr_vector< Point > storage with the contiguous one
+BOOST_AUTO_TEST_CASE( testPointStorageCountries )
+{
+    const std::vector< std::string > wkts = readCountries();
+
+    boost::ptr_vector< Geometry > geometries ;
+
+    for ( size_t i = 0; i < wkts.size(); i++ ) {
+        geometries.push_back( io::readWkt( wkts[i] ).release() );
+    }
+
+    detail::GetPointsVisitor visitor ;
+
+    for ( size_t i = 0; i < geometries.size(); i++ ) {
+        geometries[i].accept( visitor );
+    }
+
+    const size_t N = visitor.points.size() ;
+
+    bench().s() << "countries.wkt vertices\t" << N << std::endl ;
+
+    // former layout : one heap Point per vertex
+    {
+        AllocationCounter counter ;
+        boost::ptr_vector< Point, CountingCloneAllocator, CountingAllocator< void* > > points ;
+        points.reserve( N );
+
+        for ( size_t i = 0; i < N; i++ ) {
+            points.push_back( CountingCloneAllocator::allocate_clone( *visitor.points[i] ) ) ;
+        }
+
+        bench().s() << "ptr_vector< Point > storage (measured bytes)\t" << counter.bytes() << " (" << counter.allocations() << " allocations)" << std::endl ;
+    }
+    // LineString layout : the points by value in one buffer
+    {
+        AllocationCounter counter ;
+        std::vector< Point, CountingAllocator< Point > > points ;
+        points.reserve( N );
+
+        for ( size_t i = 0; i < N; i++ ) {
+            points.push_back( *visitor.points[i] ) ;
+        }
+
+        bench().s() << "LineString storage (measured bytes)\t" << counter.bytes() << " (" << counter.allocations() << " allocations)" << std::endl ;
+    }
+    // coordinates only, lower bound for the LineString layout
+    {
+        AllocationCounter counter ;
+        std::vector< Coordinate, CountingAllocator< Coordinate > > coordinates ;
+        coordinates.reserve( N );
+
+        for ( size_t i = 0; i < N; i++ ) {
+            coordinates.push_back( visitor.points[i]->coordinate() ) ;
+        }
+
+        bench().s() << "Coordinate storage (measured bytes)\t" << counter.bytes() << " (" << counter.allocations() << " allocations)" << std::endl ;
+    }
+
+    bench().start( boost::format( "boost::ptr_vector< Point > create (%1% points)" ) % N ) ;
+    {
+        boost::ptr_vector< Point > points ;
+
+        for ( size_t i = 0; i < N; i++ ) {
+            points.push_back( visitor.points[i]->clone() ) ;
+        }
+    }
+    bench().stop() ;
+
+    bench().start( boost::format( "LineString create (%1% points)" ) % N ) ;
+    {
+        LineString points ;
+
+        for ( size_t i = 0; i < N; i++ ) {
+            points.addPoint( *visitor.points[i] ) ;
+        }
+    }
+    bench().stop() ;
+
+    bench().start( boost::format( "LineString copy (%1% points)" ) % N ) ;
+    {
+        LineString points ;
+        points.reserve( N );
+
+        for ( size_t i = 0; i < N; i++ ) {
+            points.addPoint( *visitor.points[i] ) ;
+        }
+
+        LineString copy( points );
+    }
+    bench().stop() ;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
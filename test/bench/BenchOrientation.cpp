@@ -0,0 +1,139 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <fstream>
+#include <sstream>
+
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/algorithm/orientation.h>
+#include <SFCGAL/algorithm/connection.h>
+
+#include "../test_config.h"
+#include "Bench.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/format.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchOrientation )
+
+namespace {
+
+//
+// reads the vertices and the triangular faces of a wavefront obj file,
+// every other triangle is reversed
+TriangulatedSurface readObj( const std::string& name )
+{
+    std::string filename( SFCGAL_TEST_DIRECTORY );
+    filename += "/data/" + name ;
+    std::ifstream ifs( filename.c_str() );
+    BOOST_REQUIRE( ifs.good() );
+
+    std::vector< Point > vertices ;
+    TriangulatedSurface tin ;
+    std::string line ;
+
+    while ( std::getline( ifs, line ) ) {
+        std::istringstream iss( line );
+        std::string tag ;
+        iss >> tag ;
+
+        if ( tag == "v" ) {
+            double x, y, z ;
+            iss >> x >> y >> z ;
+            vertices.push_back( Point( x, y, z ) );
+        }
+        else if ( tag == "f" ) {
+            size_t a, b, c ;
+            iss >> a >> b >> c ;
+
+            if ( tin.numTriangles() % 2 ) {
+                std::swap( b, c );
+            }
+
+            tin.addTriangle( Triangle( vertices[a - 1], vertices[b - 1], vertices[c - 1] ) );
+        }
+    }
+
+    return tin ;
+}
+
+//
+// N x N grid of squares split in two triangles, every other triangle is reversed
+TriangulatedSurface grid( int N )
+{
+    TriangulatedSurface tin ;
+
+    for ( int i = 0; i < N; i++ ) {
+        for ( int j = 0; j < N; j++ ) {
+            const Point a( i, j, 0.0 ), b( i + 1, j, 0.0 ), c( i + 1, j + 1, 0.0 ), d( i, j + 1, 0.0 ) ;
+            tin.addTriangle( Triangle( a, b, c ) );
+            tin.addTriangle( Triangle( a, d, c ) );
+        }
+    }
+
+    return tin ;
+}
+
+void benchOrientation( const std::string& name, const TriangulatedSurface& tin )
+{
+    TriangulatedSurface result( tin );
+
+    bench().start( boost::format( "makeConsistentOrientation3D %1% (%2% triangles)" ) % name % tin.numTriangles() ) ;
+
+    try {
+        algorithm::makeConsistentOrientation3D( result );
+    }
+    catch ( Exception& e ) {
+        // non orientable mesh, the time until the detection is still measured
+        BOOST_TEST_MESSAGE( name << " : " << e.what() );
+    }
+
+    bench().stop();
+
+    bench().start( boost::format( "SurfaceGraph %1% (%2% triangles)" ) % name % tin.numTriangles() ) ;
+    algorithm::SurfaceGraph graph( result );
+    bench().stop();
+
+    BOOST_CHECK_EQUAL( boost::num_vertices( graph.faceGraph() ), tin.numTriangles() );
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( testTeddy )
+{
+    benchOrientation( "teddy.obj", readObj( "teddy.obj" ) );
+}
+
+BOOST_AUTO_TEST_CASE( testTeapot )
+{
+    benchOrientation( "teapot.obj", readObj( "teapot.obj" ) );
+}
+
+BOOST_AUTO_TEST_CASE( testGrid )
+{
+    benchOrientation( "grid(500)", grid( 500 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
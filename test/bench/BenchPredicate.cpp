@@ -22,8 +22,16 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <CGAL/box_intersection_d.h>
+
+
 #include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/detail/generator/sierpinski.h>
+#include <SFCGAL/detail/GeometrySet.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
 
 using namespace boost::unit_test ;
@@ -66,6 +74,197 @@ BOOST_AUTO_TEST_CASE( testPointCompare )
     bench().stop();
 }
 
+//
+// one big polygon tested against many points
+BOOST_AUTO_TEST_CASE( testPreparedIntersects )
+{
+    const int N = 1000 ;
+    std::unique_ptr< MultiPolygon > fractal( generator::sierpinski( 5 ) );
+    const Envelope box = fractal->envelope();
+
+    std::vector< Point > points ;
+
+    for ( int i = 0; i < N; i++ ) {
+        points.push_back( Point(
+                              box.xMin() + randf() * ( box.xMax() - box.xMin() ),
+                              box.yMin() + randf() * ( box.yMax() - box.yMin() )
+                          ) );
+    }
+
+    fractal->forceValidityFlag( true );
+
+    for ( int i = 0; i < N; i++ ) {
+        points[i].forceValidityFlag( true );
+    }
+
+    bench().start( boost::format( "intersects sierpinski(5) x %1% points" ) % N ) ;
+    int count = 0 ;
+
+    for ( int i = 0; i < N; i++ ) {
+        count += algorithm::intersects( *fractal, points[i] ) ? 1 : 0 ;
+    }
+
+    bench().stop();
+
+    bench().start( boost::format( "prepared intersects sierpinski(5) x %1% points" ) % N ) ;
+    PreparedGeometry prepared( fractal.release() );
+    int preparedCount = 0 ;
+
+    for ( int i = 0; i < N; i++ ) {
+        preparedCount += algorithm::intersects( prepared, points[i] ) ? 1 : 0 ;
+    }
+
+    bench().stop();
+
+    BOOST_CHECK_EQUAL( count, preparedCount );
+}
+
+namespace {
+struct found_an_intersection {};
+
+//
+// reference implementation of intersects(), leaving the box traversal with an exception
+template <int Dim>
+struct throwing_intersects_cb {
+    void operator()( const typename detail::PrimitiveBox<Dim>::Type& a,
+                     const typename detail::PrimitiveBox<Dim>::Type& b ) {
+        if ( algorithm::intersects( *a.handle(), *b.handle() ) ) {
+            throw found_an_intersection();
+        }
+    }
+};
+
+template <int Dim>
+bool throwingIntersects( const detail::GeometrySet<Dim>& a, const detail::GeometrySet<Dim>& b )
+{
+    typename detail::HandleCollection<Dim>::Type ahandles, bhandles;
+    typename detail::BoxCollection<Dim>::Type aboxes, bboxes;
+    a.computeBoundingBoxes( ahandles, aboxes );
+    b.computeBoundingBoxes( bhandles, bboxes );
+
+    try {
+        throwing_intersects_cb<Dim> cb;
+        CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
+                                  bboxes.begin(), bboxes.end(),
+                                  cb );
+    }
+    catch ( found_an_intersection& ) {
+        return true;
+    }
+
+    return false;
+}
+}
+
+//
+// mostly positive intersects() answers, early exit with an exception vs. a return value
+BOOST_AUTO_TEST_CASE( testIntersectsEarlyExit )
+{
+    const int N = 1000 ;
+    std::unique_ptr< MultiPolygon > fractal( generator::sierpinski( 4 ) );
+    const detail::GeometrySet<2> gsa( *fractal );
+
+    // centers of the fractal triangles, every answer is positive
+    std::vector< Point > points ;
+
+    for ( int i = 0; i < N; i++ ) {
+        const LineString& ring = fractal->polygonN( i % fractal->numGeometries() ).exteriorRing();
+        points.push_back( Point(
+                              ( ring.pointN( 0 ).x() + ring.pointN( 1 ).x() + ring.pointN( 2 ).x() ) / 3,
+                              ( ring.pointN( 0 ).y() + ring.pointN( 1 ).y() + ring.pointN( 2 ).y() ) / 3
+                          ) );
+    }
+
+    bench().start( boost::format( "throwing intersects sierpinski(4) x %1% points" ) % N ) ;
+    int throwingCount = 0 ;
+
+    for ( int i = 0; i < N; i++ ) {
+        const detail::GeometrySet<2> gsb( points[i] );
+        throwingCount += throwingIntersects( gsa, gsb ) ? 1 : 0 ;
+    }
+
+    bench().stop();
+
+    bench().start( boost::format( "intersects sierpinski(4) x %1% points" ) % N ) ;
+    int count = 0 ;
+
+    for ( int i = 0; i < N; i++ ) {
+        const detail::GeometrySet<2> gsb( points[i] );
+        count += algorithm::intersects( gsa, gsb ) ? 1 : 0 ;
+    }
+
+    bench().stop();
+
+    BOOST_CHECK_EQUAL( count, throwingCount );
+}
+
+//
+// point in polygon, fast path on the geometries vs. GeometrySet decomposition
+BOOST_AUTO_TEST_CASE( testPointInPolygon )
+{
+    const int N = 10000 ;
+    std::unique_ptr< MultiPolygon > fractal( generator::sierpinski( 3 ) );
+    const Polygon& polygon = fractal->polygonN( 0 );
+    const Envelope box = polygon.envelope();
+
+    std::vector< Point > points ;
+
+    for ( int i = 0; i < N; i++ ) {
+        points.push_back( Point(
+                              box.xMin() + randf() * ( box.xMax() - box.xMin() ),
+                              box.yMin() + randf() * ( box.yMax() - box.yMin() )
+                          ) );
+    }
+
+    bench().start( boost::format( "GeometrySet intersects polygon x %1% points" ) % N ) ;
+    int setCount = 0 ;
+
+    for ( int i = 0; i < N; i++ ) {
+        setCount += algorithm::intersects( detail::GeometrySet<2>( polygon ), detail::GeometrySet<2>( points[i] ) ) ? 1 : 0 ;
+    }
+
+    bench().stop();
+
+    bench().start( boost::format( "intersects polygon x %1% points" ) % N ) ;
+    int count = 0 ;
+
+    for ( int i = 0; i < N; i++ ) {
+        count += algorithm::intersects( polygon, points[i], algorithm::NoValidityCheck() ) ? 1 : 0 ;
+    }
+
+    bench().stop();
+
+    BOOST_CHECK_EQUAL( count, setCount );
+}
+
+//
+// decomposition of a big polygon and of its boundary
+BOOST_AUTO_TEST_CASE( testDecompose )
+{
+    const int N = 100 ;
+    std::unique_ptr< MultiPolygon > fractal( generator::sierpinski( 6 ) );
+    std::unique_ptr< Geometry > boundary( fractal->boundary() );
+
+    bench().start( boost::format( "decompose sierpinski(6) x %1%" ) % N ) ;
+    size_t count = 0 ;
+
+    for ( int i = 0; i < N; i++ ) {
+        count += detail::GeometrySet<2>( *fractal ).surfaces().size();
+    }
+
+    bench().stop();
+
+    bench().start( boost::format( "decompose boundary of sierpinski(6) x %1%" ) % N ) ;
+
+    for ( int i = 0; i < N; i++ ) {
+        count += detail::GeometrySet<2>( *boundary ).segments().size();
+    }
+
+    bench().stop();
+
+    BOOST_CHECK( count > 0 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -32,6 +32,7 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/io/wkt.h>
+#include <SFCGAL/GeometryArena.h>
 
 #include "../test_config.h"
 #include "Bench.h"
@@ -120,7 +121,35 @@ BOOST_AUTO_TEST_CASE( testReadSolid )
     bench().stop();
 }
 
+//
+// Request scoped processing, geometries allocated in a GeometryArena
+BOOST_AUTO_TEST_CASE( testReadMultiPolygonArena )
+{
+    const int N = 10000 ;
+    const std::string wkt = "MULTIPOLYGON(((0 0,0 1000,1000 1000,1000 0,0 0),(10 10,20 10,20 20,10 20,10 10)),((2000 0,2000 1000,3000 1000,3000 0,2000 0)))" ;
+
+    bench().start( boost::format( "READ WKT MULTIPOLYGON" ) ) ;
+
+    for ( int i = 0; i < N; i++ ) {
+        io::readWkt( wkt ) ;
+    }
+
+    bench().stop();
+
+    bench().start( boost::format( "READ WKT MULTIPOLYGON (arena)" ) ) ;
+    GeometryArena arena ;
+
+    for ( int i = 0; i < N; i++ ) {
+        {
+            GeometryArenaScope scope( arena );
+            io::readWkt( wkt ) ;
+        }
 
+        arena.release();
+    }
+
+    bench().stop();
+}
 
 
 BOOST_AUTO_TEST_SUITE_END()
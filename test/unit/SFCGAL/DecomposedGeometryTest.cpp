@@ -0,0 +1,125 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/DecomposedGeometry.h>
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/union.h>
+#include <SFCGAL/algorithm/difference.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/area.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_DecomposedGeometryTest )
+
+namespace {
+const char* aWkt = "POLYGON((0 0,4 0,4 4,0 4,0 0))" ;
+const char* bWkt = "POLYGON((2 0,6 0,6 4,2 4,2 0))" ;
+const char* cWkt = "POLYGON((1 1,5 1,5 3,1 3,1 1))" ;
+}
+
+BOOST_AUTO_TEST_CASE( testEmpty )
+{
+    DecomposedGeometry<2> empty;
+    BOOST_CHECK( empty.isEmpty() );
+    BOOST_CHECK_EQUAL( empty.dimension(), -1 );
+    BOOST_CHECK( empty.recompose()->isEmpty() );
+}
+
+BOOST_AUTO_TEST_CASE( testRecompose )
+{
+    std::unique_ptr< Geometry > a( io::readWkt( aWkt ) );
+    DecomposedGeometry<2> da( *a );
+    BOOST_CHECK( ! da.isEmpty() );
+    BOOST_CHECK_EQUAL( da.dimension(), 2 );
+    std::unique_ptr< Geometry > recomposed( da.recompose() );
+    BOOST_CHECK_EQUAL( recomposed->geometryTypeId(), TYPE_POLYGON );
+    BOOST_CHECK_EQUAL( algorithm::area( *recomposed ), 16.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testCopyAndMove )
+{
+    DecomposedGeometry<2> da( *io::readWkt( aWkt ) );
+    DecomposedGeometry<2> copy( da );
+    BOOST_CHECK_EQUAL( copy.recompose()->asText( 0 ), da.recompose()->asText( 0 ) );
+
+    DecomposedGeometry<2> moved( std::move( da ) );
+    BOOST_CHECK( da.isEmpty() );
+    BOOST_CHECK_EQUAL( moved.recompose()->asText( 0 ), copy.recompose()->asText( 0 ) );
+
+    da = moved;
+    BOOST_CHECK_EQUAL( da.recompose()->asText( 0 ), copy.recompose()->asText( 0 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testChainedOperations )
+{
+    std::unique_ptr< Geometry > a( io::readWkt( aWkt ) );
+    std::unique_ptr< Geometry > b( io::readWkt( bWkt ) );
+    std::unique_ptr< Geometry > c( io::readWkt( cWkt ) );
+
+    DecomposedGeometry<2> da( *a ), db( *b ), dc( *c );
+
+    // (a U b) ^ c
+    std::unique_ptr< Geometry > chained( algorithm::intersection( algorithm::union_( da, db ), dc ).recompose() );
+    std::unique_ptr< Geometry > expected( algorithm::intersection( *algorithm::union_( *a, *b ), *c ) );
+    BOOST_CHECK_EQUAL( algorithm::area( *chained ), 8.0 );
+    BOOST_CHECK_EQUAL( algorithm::area( *chained ), algorithm::area( *expected ) );
+
+    // (a U b) - c
+    chained = algorithm::difference( algorithm::union_( da, db ), dc ).recompose();
+    expected = algorithm::difference( *algorithm::union_( *a, *b ), *c );
+    BOOST_CHECK_EQUAL( algorithm::area( *chained ), 16.0 );
+    BOOST_CHECK_EQUAL( algorithm::area( *chained ), algorithm::area( *expected ) );
+}
+
+BOOST_AUTO_TEST_CASE( testPredicates )
+{
+    DecomposedGeometry<2> da( *io::readWkt( aWkt ) );
+    DecomposedGeometry<2> db( *io::readWkt( bWkt ) );
+    DecomposedGeometry<2> dc( *io::readWkt( cWkt ) );
+    DecomposedGeometry<2> far( *io::readWkt( "POINT(10 10)" ) );
+
+    const DecomposedGeometry<2> ab = algorithm::union_( da, db );
+    BOOST_CHECK( algorithm::intersects( ab, dc ) );
+    BOOST_CHECK( algorithm::covers( ab, dc ) );
+    BOOST_CHECK( ! algorithm::covers( da, dc ) );
+    BOOST_CHECK( ! algorithm::intersects( ab, far ) );
+    BOOST_CHECK( algorithm::intersection( ab, far ).isEmpty() );
+}
+
+BOOST_AUTO_TEST_CASE( testChainedOperations3D )
+{
+    DecomposedGeometry<3> da( *io::readWkt( "LINESTRING(0 0 0,4 0 0)" ) );
+    DecomposedGeometry<3> db( *io::readWkt( "LINESTRING(2 0 0,6 0 0)" ) );
+    DecomposedGeometry<3> dc( *io::readWkt( "POINT(5 0 0)" ) );
+
+    const DecomposedGeometry<3> ab = algorithm::union_( da, db );
+    BOOST_CHECK_EQUAL( ab.dimension(), 1 );
+    BOOST_CHECK( algorithm::intersects( ab, dc ) );
+    BOOST_CHECK( algorithm::covers( ab, dc ) );
+    BOOST_CHECK_EQUAL( algorithm::intersection( ab, dc ).recompose()->asText( 0 ), "POINT(5 0 0)" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
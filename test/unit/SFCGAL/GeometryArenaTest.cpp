@@ -0,0 +1,159 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/GeometryArena.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/io/wkt.h>
+
+#include <thread>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_GeometryArenaTest )
+
+BOOST_AUTO_TEST_CASE( testDefaultIsHeap )
+{
+    BOOST_CHECK( GeometryArenaScope::current() == NULL );
+    std::unique_ptr< Geometry > g( new Point( 1.0, 2.0 ) );
+    BOOST_CHECK_EQUAL( g->asText( 0 ), "POINT(1 2)" );
+}
+
+BOOST_AUTO_TEST_CASE( testScope )
+{
+    GeometryArena arena ;
+    {
+        GeometryArenaScope scope( arena );
+        BOOST_CHECK( GeometryArenaScope::current() == &arena );
+
+        std::unique_ptr< Geometry > g( io::readWkt( "MULTIPOLYGON(((0 0,1 0,1 1,0 1,0 0)),((2 0,3 0,3 1,2 1,2 0)))" ) );
+        // the multipolygon, its two polygons and their exterior rings
+        BOOST_CHECK_EQUAL( arena.numLiveObjects(), 5U );
+        BOOST_CHECK( arena.capacity() > 0 );
+
+        std::unique_ptr< Geometry > copy( g->clone() );
+        BOOST_CHECK_EQUAL( arena.numLiveObjects(), 10U );
+        BOOST_CHECK_EQUAL( copy->asText( 0 ), g->asText( 0 ) );
+    }
+    BOOST_CHECK( GeometryArenaScope::current() == NULL );
+    BOOST_CHECK_EQUAL( arena.numLiveObjects(), 0U );
+
+    arena.release();
+    BOOST_CHECK_EQUAL( arena.capacity(), 0U );
+}
+
+BOOST_AUTO_TEST_CASE( testNestedScopes )
+{
+    GeometryArena a ;
+    GeometryArena b ;
+    {
+        GeometryArenaScope scopeA( a );
+        {
+            GeometryArenaScope scopeB( b );
+            BOOST_CHECK( GeometryArenaScope::current() == &b );
+            std::unique_ptr< Geometry > g( new Point( 0.0, 0.0 ) );
+            BOOST_CHECK_EQUAL( b.numLiveObjects(), 1U );
+        }
+        BOOST_CHECK( GeometryArenaScope::current() == &a );
+    }
+    BOOST_CHECK_EQUAL( a.numLiveObjects(), 0U );
+}
+
+BOOST_AUTO_TEST_CASE( testHeapGeometryInScope )
+{
+    std::unique_ptr< Geometry > heap( new Point( 1.0, 2.0 ) );
+
+    GeometryArena arena ;
+    {
+        GeometryArenaScope scope( arena );
+        std::unique_ptr< Geometry > g( new Point( 0.0, 0.0 ) );
+        BOOST_CHECK( arena.owns( g.get() ) );
+        BOOST_CHECK( ! arena.owns( heap.get() ) );
+        BOOST_CHECK( GeometryArena::owner( g.get() ) == &arena );
+        BOOST_CHECK( GeometryArena::owner( heap.get() ) == NULL );
+
+        // released on the heap, the arena is not notified
+        heap.reset();
+        BOOST_CHECK_EQUAL( arena.numLiveObjects(), 1U );
+    }
+    BOOST_CHECK_EQUAL( arena.numLiveObjects(), 0U );
+}
+
+//
+// geometries of an arena deleted by another thread go back to their arena
+BOOST_AUTO_TEST_CASE( testDeleteOnAnotherThread )
+{
+    GeometryArena arena ;
+    Geometry* inArena = NULL ;
+    {
+        GeometryArenaScope scope( arena );
+        inArena = io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0))" ).release();
+    }
+    BOOST_CHECK_EQUAL( arena.numLiveObjects(), 2U );
+
+    Geometry* onHeap = new Point( 1.0, 2.0 );
+    bool ownedByArena = false ;
+    bool ownedByNone = false ;
+
+    std::thread worker( [&]() {
+        ownedByArena = GeometryArena::owner( inArena ) == &arena ;
+        ownedByNone = GeometryArena::owner( onHeap ) == NULL ;
+        delete inArena ;
+        delete onHeap ;
+    } );
+    worker.join();
+
+    BOOST_CHECK( ownedByArena );
+    BOOST_CHECK( ownedByNone );
+    BOOST_CHECK_EQUAL( arena.numLiveObjects(), 0U );
+}
+
+BOOST_AUTO_TEST_CASE( testArrayForms )
+{
+    GeometryArena arena ;
+    {
+        GeometryArenaScope scope( arena );
+        Point* points = new Point[3] ;
+        BOOST_CHECK( arena.owns( points ) );
+        BOOST_CHECK_EQUAL( arena.numLiveObjects(), 1U );
+        delete [] points ;
+    }
+    BOOST_CHECK_EQUAL( arena.numLiveObjects(), 0U );
+
+    Point* points = new Point[3] ;
+    BOOST_CHECK( ! arena.owns( points ) );
+    delete [] points ;
+}
+
+BOOST_AUTO_TEST_CASE( testLargeAllocation )
+{
+    GeometryArena arena( 16 );
+    void* p = arena.allocate( 1024 );
+    BOOST_CHECK( p != NULL );
+    BOOST_CHECK( arena.capacity() >= 1024U );
+    BOOST_CHECK( arena.owns( static_cast< char* >( p ) + 1023 ) );
+    BOOST_CHECK( ! arena.owns( static_cast< char* >( p ) + 1024 ) );
+    arena.deallocate( p );
+    arena.release();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
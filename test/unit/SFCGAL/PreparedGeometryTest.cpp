@@ -0,0 +1,199 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/distance3d.h>
+#include <SFCGAL/detail/IndexedGeometrySet.h>
+
+#include <thread>
+#include <vector>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_PreparedGeometryTest )
+
+namespace {
+const char* polygonWkt = "POLYGON((0 0,10 0,10 10,0 10,0 0),(2 2,2 4,4 4,4 2,2 2))" ;
+
+const char* others[] = {
+    "POINT(1 1)",
+    "POINT(3 3)",
+    "POINT(10 5)",
+    "POINT(12 12)",
+    "LINESTRING(1 1,5 5)",
+    "LINESTRING(2.5 2.5,3.5 3.5)",
+    "LINESTRING(11 0,11 10)",
+    "POLYGON((5 5,6 5,6 6,5 6,5 5))",
+    "POLYGON((-1 -1,11 -1,11 11,-1 11,-1 -1))",
+    "MULTIPOINT((1 1),(5 5))",
+    "MULTIPOINT((1 1),(3 3))",
+    "TRIANGLE((20 0,21 0,20 1,20 0))"
+};
+}
+
+BOOST_AUTO_TEST_CASE( testCache )
+{
+    PreparedGeometry prepared( io::readWkt( polygonWkt ) );
+    const detail::IndexedGeometrySet<2>& indexed = prepared.indexedGeometrySet2D();
+    BOOST_CHECK_EQUAL( &indexed, &prepared.indexedGeometrySet2D() );
+    BOOST_CHECK_EQUAL( indexed.tree().size(), 1U );
+    BOOST_CHECK_EQUAL( indexed.boundary().segments.size(), 8U );
+
+    prepared.resetGeometry( io::readWkt( "MULTIPOINT((0 0),(1 1))" ).release() );
+    BOOST_CHECK_EQUAL( prepared.indexedGeometrySet2D().tree().size(), 2U );
+}
+
+BOOST_AUTO_TEST_CASE( testIntersects )
+{
+    PreparedGeometry prepared( io::readWkt( polygonWkt ) );
+
+    for ( size_t i = 0; i < sizeof( others ) / sizeof( others[0] ); i++ ) {
+        std::unique_ptr< Geometry > g( io::readWkt( others[i] ) );
+        BOOST_CHECK_MESSAGE(
+            algorithm::intersects( prepared, *g ) == algorithm::intersects( prepared.geometry(), *g ),
+            others[i]
+        );
+        BOOST_CHECK_MESSAGE(
+            algorithm::intersects3D( prepared, *g ) == algorithm::intersects3D( prepared.geometry(), *g ),
+            others[i]
+        );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testCovers )
+{
+    PreparedGeometry prepared( io::readWkt( polygonWkt ) );
+
+    for ( size_t i = 0; i < sizeof( others ) / sizeof( others[0] ); i++ ) {
+        std::unique_ptr< Geometry > g( io::readWkt( others[i] ) );
+        BOOST_CHECK_MESSAGE(
+            algorithm::covers( prepared, *g ) == algorithm::covers( prepared.geometry(), *g ),
+            others[i]
+        );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testDistance )
+{
+    PreparedGeometry prepared( io::readWkt( polygonWkt ) );
+
+    for ( size_t i = 0; i < sizeof( others ) / sizeof( others[0] ); i++ ) {
+        std::unique_ptr< Geometry > g( io::readWkt( others[i] ) );
+        BOOST_CHECK_CLOSE( algorithm::distance( prepared, *g ), algorithm::distance( prepared.geometry(), *g ), 1e-9 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testDWithin )
+{
+    PreparedGeometry prepared( io::readWkt( polygonWkt ) );
+
+    for ( size_t i = 0; i < sizeof( others ) / sizeof( others[0] ); i++ ) {
+        std::unique_ptr< Geometry > g( io::readWkt( others[i] ) );
+        const double d = algorithm::distance( prepared.geometry(), *g );
+        BOOST_CHECK_MESSAGE( algorithm::dwithin( prepared, *g, d + 0.5 ), others[i] );
+        BOOST_CHECK_MESSAGE( algorithm::dwithin( prepared, *g, d - 0.5 ) == algorithm::dwithin( prepared.geometry(), *g, d - 0.5 ), others[i] );
+    }
+}
+
+//
+// once warmed up as documented, the boundary caches are built safely by concurrent queries
+//
+BOOST_AUTO_TEST_CASE( testConcurrentDistance )
+{
+    PreparedGeometry prepared( io::readWkt( polygonWkt ) );
+    prepared.indexedGeometrySet2D();
+
+    const size_t numOthers = sizeof( others ) / sizeof( others[0] );
+    std::vector< double > expected( numOthers );
+
+    for ( size_t i = 0; i < numOthers; i++ ) {
+        std::unique_ptr< Geometry > g( io::readWkt( others[i] ) );
+        expected[i] = algorithm::distance( prepared.geometry(), *g );
+    }
+
+    const size_t numThreads = 4 ;
+    std::vector< std::vector< double > > results( numThreads, std::vector< double >( numOthers ) );
+    std::vector< std::thread > threads ;
+
+    for ( size_t t = 0; t < numThreads; t++ ) {
+        threads.push_back( std::thread( [&prepared, &results, t, numOthers]() {
+            for ( size_t i = 0; i < numOthers; i++ ) {
+                std::unique_ptr< Geometry > g( io::readWkt( others[i] ) );
+                results[t][i] = algorithm::distance( prepared, *g );
+            }
+        } ) );
+    }
+
+    for ( size_t t = 0; t < numThreads; t++ ) {
+        threads[t].join();
+    }
+
+    for ( size_t t = 0; t < numThreads; t++ ) {
+        for ( size_t i = 0; i < numOthers; i++ ) {
+            BOOST_CHECK_CLOSE( results[t][i], expected[i], 1e-9 );
+        }
+    }
+}
+
+//
+// the other geometry is validated the same way by all the prepared predicates
+BOOST_AUTO_TEST_CASE( testInvalidOther )
+{
+    PreparedGeometry prepared( io::readWkt( polygonWkt ) );
+
+    LineString collapsed ;
+    collapsed.addPoint( Point( 1.0, 1.0 ) );
+    collapsed.addPoint( Point( 1.0, 1.0 ) );
+
+    BOOST_CHECK_THROW( algorithm::intersects( prepared, collapsed ), GeometryInvalidityException );
+    BOOST_CHECK_THROW( algorithm::intersects3D( prepared, collapsed ), GeometryInvalidityException );
+    BOOST_CHECK_THROW( algorithm::covers( prepared, collapsed ), GeometryInvalidityException );
+    BOOST_CHECK_THROW( algorithm::covers3D( prepared, collapsed ), GeometryInvalidityException );
+    BOOST_CHECK_THROW( algorithm::distance( prepared, collapsed ), GeometryInvalidityException );
+}
+
+BOOST_AUTO_TEST_CASE( testDistance3D )
+{
+    PreparedGeometry prepared( io::readWkt( "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" ) );
+
+    const char* others3D[] = {
+        "POINT(0.5 0.5 0.5)",
+        "POINT(0.5 0.5 3)",
+        "LINESTRING(2 0 0,2 1 1)",
+        "TRIANGLE((0 0 2,1 0 2,0 1 2,0 0 2))",
+        "TIN(((3 0 0,4 0 0,3 1 0,3 0 0)))"
+    };
+
+    for ( size_t i = 0; i < sizeof( others3D ) / sizeof( others3D[0] ); i++ ) {
+        std::unique_ptr< Geometry > g( io::readWkt( others3D[i] ) );
+        BOOST_CHECK_CLOSE( algorithm::distance3D( prepared, *g ), algorithm::distance3D( prepared.geometry(), *g ), 1e-9 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,164 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/clip.h>
+#include <SFCGAL/algorithm/area.h>
+#include <SFCGAL/algorithm/intersection.h>
+
+using namespace SFCGAL ;
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_ClipTest )
+
+namespace {
+//
+// clips a geometry and checks the area against the exact intersection with the envelope polygon
+void checkPolygonClip( const std::string& wkt, const Envelope& box, const std::string& expectedType, double expectedArea )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( wkt ) );
+    std::unique_ptr< Geometry > result = algorithm::clip( *g, box );
+
+    BOOST_CHECK_MESSAGE( result->geometryType() == expectedType, wkt << " " << result->asText( 1 ) );
+    BOOST_CHECK_CLOSE( algorithm::area( *result ), expectedArea, 1e-9 );
+
+    std::unique_ptr< Geometry > exact = algorithm::intersection( *g, *box.toPolygon() );
+    BOOST_CHECK_CLOSE( algorithm::area( *result ), algorithm::area( *exact ), 1e-9 );
+}
+}
+
+BOOST_AUTO_TEST_CASE( testClipPoint )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "POINT(1 1)" ) );
+
+    BOOST_CHECK( *algorithm::clip( *g, Envelope( 0, 2, 0, 2 ) ) == *g );
+    BOOST_CHECK( algorithm::clip( *g, Envelope( 2, 3, 2, 3 ) )->isEmpty() );
+
+    std::unique_ptr< Geometry > multi( io::readWkt( "MULTIPOINT(1 1,3 3,2 0)" ) );
+    BOOST_CHECK_EQUAL( algorithm::clip( *multi, Envelope( 0, 2, 0, 2 ) )->asText( 0 ), "MULTIPOINT((1 1),(2 0))" );
+}
+
+BOOST_AUTO_TEST_CASE( testClipLineString )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "LINESTRING(-1 1,3 1)" ) );
+    BOOST_CHECK_EQUAL( algorithm::clip( *g, Envelope( 0, 2, 0, 2 ) )->asText( 0 ), "LINESTRING(0 1,2 1)" );
+
+    // leaves and enters again
+    std::unique_ptr< Geometry > zigzag( io::readWkt( "LINESTRING(0 1,4 1,4 3,0 3)" ) );
+    BOOST_CHECK_EQUAL( algorithm::clip( *zigzag, Envelope( 0, 2, 0, 4 ) )->asText( 0 ), "MULTILINESTRING((0 1,2 1),(2 3,0 3))" );
+
+    // entirely inside, copied
+    std::unique_ptr< Geometry > inside( io::readWkt( "LINESTRING(0.5 0.5,1 1)" ) );
+    BOOST_CHECK( *algorithm::clip( *inside, Envelope( 0, 2, 0, 2 ) ) == *inside );
+
+    BOOST_CHECK( algorithm::clip( *g, Envelope( 0, 2, 2.5, 3 ) )->isEmpty() );
+}
+
+BOOST_AUTO_TEST_CASE( testClipLineStringZM )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "LINESTRING ZM(-1 1 0 10,3 1 4 14)" ) );
+    std::unique_ptr< Geometry > result = algorithm::clip( *g, Envelope( 0, 2, 0, 2 ) );
+    std::unique_ptr< Geometry > expected( io::readWkt( "LINESTRING ZM(0 1 1 11,2 1 3 13)" ) );
+
+    BOOST_CHECK( *result == *expected );
+    BOOST_CHECK( result->isMeasured() );
+    BOOST_CHECK_EQUAL( result->as< LineString >().pointN( 1 ).m(), 13.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testClipPolygon )
+{
+    checkPolygonClip( "POLYGON((-5 -5,5 -5,5 5,-5 5,-5 -5))", Envelope( 0, 10, 0, 10 ), "Polygon", 25.0 );
+
+    // clockwise exterior ring
+    checkPolygonClip( "POLYGON((-5 -5,-5 5,5 5,5 -5,-5 -5))", Envelope( 0, 10, 0, 10 ), "Polygon", 25.0 );
+
+    // entirely outside
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON((-5 -5,5 -5,5 5,-5 5,-5 -5))" ) );
+    BOOST_CHECK( algorithm::clip( *g, Envelope( 6, 10, 6, 10 ) )->isEmpty() );
+}
+
+BOOST_AUTO_TEST_CASE( testClipConcavePolygon )
+{
+    // the box crosses both arms of a U
+    checkPolygonClip( "POLYGON((0 0,10 0,10 10,7 10,7 3,3 3,3 10,0 10,0 0))", Envelope( -1, 11, 5, 8 ), "MultiPolygon", 18.0 );
+    checkPolygonClip( "POLYGON((0 0,10 0,10 10,7 10,7 3,3 3,3 10,0 10,0 0))", Envelope( -1, 11, 2, 8 ), "Polygon", 40.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testClipPolygonWithHoles )
+{
+    // the hole crosses the boundary of the box
+    checkPolygonClip( "POLYGON((0 0,10 0,10 10,0 10,0 0),(4 4,4 6,6 6,6 4,4 4))", Envelope( 5, 10, 0, 10 ), "Polygon", 48.0 );
+
+    // the hole is inside the box
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0),(4 4,4 6,6 6,6 4,4 4))" ) );
+    std::unique_ptr< Geometry > result = algorithm::clip( *g, Envelope( 2, 12, 2, 12 ) );
+    BOOST_REQUIRE_EQUAL( result->geometryTypeId(), TYPE_POLYGON );
+    BOOST_CHECK_EQUAL( result->as< Polygon >().numInteriorRings(), 1U );
+    BOOST_CHECK_CLOSE( algorithm::area( *result ), 60.0, 1e-9 );
+
+    // the box is inside the hole
+    BOOST_CHECK( algorithm::clip( *g, Envelope( 4.5, 5.5, 4.5, 5.5 ) )->isEmpty() );
+}
+
+BOOST_AUTO_TEST_CASE( testClipBoxInsidePolygon )
+{
+    checkPolygonClip( "POLYGON((0 0,10 0,10 10,0 10,0 0))", Envelope( 2, 4, 2, 4 ), "Polygon", 4.0 );
+
+    // with a hole inside the box
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0),(2.5 2.5,2.5 3.5,3.5 3.5,3.5 2.5,2.5 2.5))" ) );
+    std::unique_ptr< Geometry > result = algorithm::clip( *g, Envelope( 2, 4, 2, 4 ) );
+    BOOST_REQUIRE_EQUAL( result->geometryTypeId(), TYPE_POLYGON );
+    BOOST_CHECK_EQUAL( result->as< Polygon >().numInteriorRings(), 1U );
+    BOOST_CHECK_CLOSE( algorithm::area( *result ), 3.0, 1e-9 );
+}
+
+BOOST_AUTO_TEST_CASE( testClipPolygonZ )
+{
+    // corners of the box take the z of the plane of the polygon
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON Z((-5 -5 -5,5 -5 -5,5 5 5,-5 5 5,-5 -5 -5))" ) );
+    std::unique_ptr< Geometry > result = algorithm::clip( *g, Envelope( 0, 10, 0, 10 ) );
+    std::unique_ptr< Geometry > expected( io::readWkt( "POLYGON Z((5 0 0,5 5 5,0 5 5,0 0 0,5 0 0))" ) );
+
+    BOOST_CHECK_MESSAGE( *result == *expected, result->asText( 1 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testClipCollections )
+{
+    std::unique_ptr< Geometry > tin( io::readWkt( "TIN(((0 0,4 0,0 4,0 0)),((4 0,4 4,0 4,4 0)))" ) );
+    std::unique_ptr< Geometry > result = algorithm::clip( *tin, Envelope( 1, 3, 1, 3 ) );
+    BOOST_CHECK_EQUAL( result->geometryTypeId(), TYPE_POLYHEDRALSURFACE );
+    BOOST_CHECK_CLOSE( algorithm::area( *result ), 4.0, 1e-9 );
+
+    std::unique_ptr< Geometry > collection( io::readWkt( "GEOMETRYCOLLECTION(POINT(5 5),LINESTRING(0 1,4 1))" ) );
+    BOOST_CHECK_EQUAL( algorithm::clip( *collection, Envelope( 0, 2, 0, 2 ) )->asText( 0 ), "GEOMETRYCOLLECTION(LINESTRING(0 1,2 1))" );
+}
+
+BOOST_AUTO_TEST_CASE( testClipSolid )
+{
+    std::unique_ptr< Geometry > g( Envelope( 0, 1, 0, 1, 0, 1 ).toSolid() );
+    BOOST_CHECK_THROW( algorithm::clip( *g, Envelope( 0, 0.5, 0, 0.5 ) ), NotImplementedException );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,162 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/computationMode.h>
+#include <SFCGAL/algorithm/area.h>
+#include <SFCGAL/algorithm/length.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/convexHull.h>
+#include <SFCGAL/algorithm/tesselate.h>
+#include <SFCGAL/triangulate/triangulate2DZ.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_ComputationModeTest )
+
+BOOST_AUTO_TEST_CASE( testDefaultMode )
+{
+    BOOST_CHECK_EQUAL( algorithm::computationMode(), algorithm::EXACT_COMPUTATION );
+}
+
+BOOST_AUTO_TEST_CASE( testAreaLength )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "MULTIPOLYGON(((0 0,4 0,4 4,0 4,0 0),(1 1,1 2,2 2,2 1,1 1)),((5 0,6 0,6 1,5 0)))" ) );
+    BOOST_CHECK_CLOSE( algorithm::area( *g, algorithm::FastMode() ), algorithm::area( *g ), 1e-12 );
+
+    std::unique_ptr< Geometry > l( io::readWkt( "MULTILINESTRING((0 0,3 4),(0 0,0 1))" ) );
+    BOOST_CHECK_CLOSE( algorithm::length( *l, algorithm::FastMode() ), 6.0, 1e-12 );
+}
+
+BOOST_AUTO_TEST_CASE( testIntersects )
+{
+    const char* wkts[][2] = {
+        { "POINT(1 1)", "POINT(1 1)" },
+        { "POINT(1 1)", "LINESTRING(0 0,2 2)" },
+        { "POINT(0.5 0.5)", "POLYGON((0 0,1 0,1 1,0 1,0 0))" },
+        { "POINT(0.5 0.5)", "POLYGON((0 0,4 0,4 4,0 4,0 0),(0.25 0.25,0.75 0.25,0.75 0.75,0.25 0.75,0.25 0.25))" },
+        { "LINESTRING(0 0,1 1)", "LINESTRING(0 1,1 0)" },
+        { "LINESTRING(2 2,3 3)", "LINESTRING(0 1,1 0)" },
+        { "LINESTRING(0.5 0.5,0.6 0.6)", "POLYGON((0 0,1 0,1 1,0 1,0 0))" },
+        { "POLYGON((0 0,1 0,1 1,0 1,0 0))", "POLYGON((0.2 0.2,0.8 0.2,0.8 0.8,0.2 0.8,0.2 0.2))" },
+        { "POLYGON((0 0,1 0,1 1,0 1,0 0))", "POLYGON((2 0,3 0,3 1,2 1,2 0))" },
+        { "TIN(((0 0,1 0,0 1,0 0)))", "POINT(2 2)" }
+    };
+
+    for ( size_t i = 0; i < sizeof( wkts ) / sizeof( wkts[0] ); i++ ) {
+        std::unique_ptr< Geometry > gA( io::readWkt( wkts[i][0] ) );
+        std::unique_ptr< Geometry > gB( io::readWkt( wkts[i][1] ) );
+        BOOST_CHECK_MESSAGE(
+            algorithm::intersects( *gA, *gB, algorithm::FastMode() ) == algorithm::intersects( *gA, *gB ),
+            wkts[i][0] << " " << wkts[i][1]
+        );
+        BOOST_CHECK_EQUAL(
+            algorithm::intersects( *gB, *gA, algorithm::FastMode() ),
+            algorithm::intersects( *gA, *gB, algorithm::FastMode() )
+        );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testDistance )
+{
+    const char* wkts[][2] = {
+        { "POINT(0 0)", "POINT(3 4)" },
+        { "POINT(0 3)", "LINESTRING(-1 0,1 0)" },
+        { "LINESTRING(0 0,1 1)", "LINESTRING(3 0,3 3)" },
+        { "POINT(0.5 0.5)", "POLYGON((0 0,1 0,1 1,0 1,0 0))" },
+        { "POLYGON((0 0,1 0,1 1,0 1,0 0))", "POLYGON((3 0,4 0,4 1,3 1,3 0))" },
+        { "MULTIPOINT((10 10),(0 2))", "POLYGON((0 0,1 0,1 1,0 1,0 0))" },
+        { "MULTILINESTRING((0 0,1 0),(5 5,6 5),(10 0,11 0))", "MULTIPOINT((5.5 7),(20 20),(-3 0))" },
+        { "POLYGON((0 0,4 0,4 4,0 4,0 0),(1 1,1 3,3 3,3 1,1 1))", "POLYGON((1.5 1.5,2.5 1.5,2.5 2.5,1.5 2.5,1.5 1.5))" }
+    };
+
+    for ( size_t i = 0; i < sizeof( wkts ) / sizeof( wkts[0] ); i++ ) {
+        std::unique_ptr< Geometry > gA( io::readWkt( wkts[i][0] ) );
+        std::unique_ptr< Geometry > gB( io::readWkt( wkts[i][1] ) );
+        BOOST_CHECK_CLOSE( algorithm::distance( *gA, *gB, algorithm::FastMode() ), algorithm::distance( *gA, *gB ), 1e-12 );
+    }
+}
+
+//
+// fast mode does not check the validity of the inputs (see FastMode)
+BOOST_AUTO_TEST_CASE( testNoValidityCheck )
+{
+    std::unique_ptr< Geometry > bowtie( io::readWkt( "POLYGON((0 0,2 2,2 0,0 2,0 0))" ) );
+    std::unique_ptr< Geometry > point( io::readWkt( "POINT(5 1)" ) );
+
+    BOOST_CHECK_THROW( algorithm::intersects( *bowtie, *point ), GeometryInvalidityException );
+
+    BOOST_CHECK( ! algorithm::intersects( *bowtie, *point, algorithm::FastMode() ) );
+    BOOST_CHECK_CLOSE( algorithm::distance( *bowtie, *point, algorithm::FastMode() ), 3.0, 1e-12 );
+    BOOST_CHECK_NO_THROW( algorithm::area( *bowtie, algorithm::FastMode() ) );
+}
+
+BOOST_AUTO_TEST_CASE( testConvexHull )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "MULTIPOINT((0 0),(1 0),(1 1),(0 1),(0.5 0.5))" ) );
+    std::unique_ptr< Geometry > hull( algorithm::convexHull( *g, algorithm::FastMode() ) );
+    BOOST_CHECK_EQUAL( hull->asText( 1 ), algorithm::convexHull( *g )->asText( 1 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testTesselate )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON((0 0 1,4 0 1,4 4 2,0 4 2,0 0 1),(1 1 1.25,1 2 1.5,2 2 1.5,2 1 1.25,1 1 1.25))" ) );
+    std::unique_ptr< Geometry > tin( algorithm::tesselate( *g, algorithm::FastMode() ) );
+    BOOST_REQUIRE( tin->is< TriangulatedSurface >() );
+    BOOST_CHECK_EQUAL( tin->as< TriangulatedSurface >().numTriangles(), 8U );
+    BOOST_CHECK( tin->is3D() );
+    BOOST_CHECK_CLOSE( algorithm::area( *tin ), 15.0, 1e-12 );
+
+    // vertical polygon, fallback to the exact triangulation
+    std::unique_ptr< Geometry > v( io::readWkt( "POLYGON((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0))" ) );
+    std::unique_ptr< Geometry > vtin( algorithm::tesselate( *v, algorithm::FastMode() ) );
+    BOOST_CHECK_EQUAL( vtin->as< TriangulatedSurface >().numTriangles(), 2U );
+}
+
+BOOST_AUTO_TEST_CASE( testTriangulate2DZ )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "MULTIPOINT((0 0 1),(1 0 2),(1 1 3),(0 1 4))" ) );
+    std::unique_ptr< TriangulatedSurface > tin( triangulate::triangulate2DZ( *g, algorithm::FastMode() ) );
+    BOOST_CHECK_EQUAL( tin->numTriangles(), 2U );
+    BOOST_CHECK_EQUAL( tin->numTriangles(), triangulate::triangulate2DZ( *g ).numTriangles() );
+}
+
+BOOST_AUTO_TEST_CASE( testGlobalMode )
+{
+    std::unique_ptr< Geometry > gA( io::readWkt( "LINESTRING(0 0,1 1)" ) );
+    std::unique_ptr< Geometry > gB( io::readWkt( "LINESTRING(0 1,1 0)" ) );
+
+    algorithm::setComputationMode( algorithm::FAST_COMPUTATION );
+    BOOST_CHECK_EQUAL( algorithm::computationMode(), algorithm::FAST_COMPUTATION );
+    const bool fast = algorithm::intersects( *gA, *gB );
+    const double fastLength = algorithm::length( *gA );
+    algorithm::setComputationMode( algorithm::EXACT_COMPUTATION );
+
+    BOOST_CHECK( fast );
+    BOOST_CHECK_CLOSE( fastLength, algorithm::length( *gA ), 1e-12 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
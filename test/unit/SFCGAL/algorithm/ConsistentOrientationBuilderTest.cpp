@@ -32,6 +32,7 @@
 #include <SFCGAL/MultiLineString.h>
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/Exception.h>
 #include <SFCGAL/io/wkt.h>
 #include <SFCGAL/algorithm/ConsistentOrientationBuilder.h>
 #include <SFCGAL/algorithm/orientation.h>
@@ -101,5 +102,49 @@ BOOST_AUTO_TEST_CASE( testFourTriangle )
 }
 
 
+BOOST_AUTO_TEST_CASE( testGridWithFlippedTriangles )
+{
+    const int N = 10 ;
+    TriangulatedSurface tin ;
+
+    for ( int i = 0; i < N; i++ ) {
+        for ( int j = 0; j < N; j++ ) {
+            const Point a( i, j, 0.0 ), b( i + 1, j, 0.0 ), c( i + 1, j + 1, 0.0 ), d( i, j + 1, 0.0 ) ;
+            tin.addTriangle( Triangle( a, b, c ) );
+
+            if ( ( i + j ) % 3 == 0 ) {
+                tin.addTriangle( Triangle( a, c, d ) );
+            }
+            else {
+                tin.addTriangle( Triangle( a, d, c ) );
+            }
+        }
+    }
+
+    BOOST_REQUIRE( ! algorithm::hasConsistentOrientation3D( tin ) );
+
+    algorithm::ConsistentOrientationBuilder builder ;
+    builder.addTriangulatedSurface( tin );
+    TriangulatedSurface triangulatedSurface = builder.buildTriangulatedSurface();
+    BOOST_CHECK_EQUAL( triangulatedSurface.numGeometries(), 2U * N * N );
+    BOOST_CHECK( algorithm::hasConsistentOrientation3D( triangulatedSurface ) );
+    // the first triangle is the reference
+    BOOST_CHECK_EQUAL( triangulatedSurface.triangleN( 0 ).asText( 0 ), tin.triangleN( 0 ).asText( 0 ) );
+
+    // corner triangle and inner triangle
+    BOOST_CHECK_EQUAL( builder.neighbors( 0 ).size(), 2U );
+    BOOST_CHECK_EQUAL( builder.neighbors( 2 * N + 3 ).size(), 3U );
+}
+
+BOOST_AUTO_TEST_CASE( testNonOrientable )
+{
+    // three triangles on the same edge
+    algorithm::ConsistentOrientationBuilder builder ;
+    builder.addTriangle( Triangle( Point( 0.0, 0.0, 0.0 ), Point( 1.0, 0.0, 0.0 ), Point( 0.0, 1.0, 0.0 ) ) );
+    builder.addTriangle( Triangle( Point( 1.0, 0.0, 0.0 ), Point( 0.0, 0.0, 0.0 ), Point( 0.0, -1.0, 0.0 ) ) );
+    builder.addTriangle( Triangle( Point( 0.0, 0.0, 0.0 ), Point( 1.0, 0.0, 0.0 ), Point( 0.0, 0.0, 1.0 ) ) );
+    BOOST_CHECK_THROW( builder.buildTriangulatedSurface(), Exception );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -19,6 +19,9 @@
  */
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <limits>
+
 #include <SFCGAL/Point.h>
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/Polygon.h>
@@ -33,6 +36,7 @@
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/io/wkt.h>
 #include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/distance3d.h>
 
 #include <SFCGAL/detail/tools/Registry.h>
 #include <SFCGAL/detail/tools/Log.h>
@@ -182,6 +186,13 @@ BOOST_AUTO_TEST_CASE( testDistanceLineStringLineString_zeroLengthSegments )
     std::unique_ptr< Geometry > gB( io::readWkt( "LINESTRING(3.0 4.0,4.0 5.0)" ) );
     BOOST_CHECK_EQUAL( gA->distance( *gB ), 5.0 );
 }
+BOOST_AUTO_TEST_CASE( testDistanceLineStringLineString_repeatedPoints )
+{
+    std::unique_ptr< Geometry > gA( io::readWkt( "LINESTRING(0.0 0.0,0.0 0.0,-1.0 -1.0,-1.0 -1.0)" ) );
+    std::unique_ptr< Geometry > gB( io::readWkt( "LINESTRING(3.0 4.0,3.0 4.0,4.0 5.0)" ) );
+    BOOST_CHECK_EQUAL( gA->distance( *gB ), 5.0 );
+    BOOST_CHECK_EQUAL( algorithm::distanceLineStringLineString( gA->as< LineString >(), gB->as< LineString >() ), 5.0 );
+}
 // LineString / LineString 3D
 BOOST_AUTO_TEST_CASE( testDistanceLineStringLineString3D_zeroLengthSegments )
 {
@@ -227,6 +238,93 @@ BOOST_AUTO_TEST_CASE( testDistancePolygonPolygon_disjoint )
     BOOST_CHECK_EQUAL( gA->distance( *gB ), 1.0 );
 }
 
+namespace {
+// zigzag of n segments, starting at (x0,y0)
+std::unique_ptr< LineString > zigzag( size_t n, double x0, double y0 )
+{
+    std::unique_ptr< LineString > result( new LineString() );
+
+    for ( size_t i = 0; i <= n; i++ ) {
+        result->addPoint( Point( x0 + 0.5 * i, y0 + ( i % 2 ) * 0.7 ) );
+    }
+
+    return result;
+}
+
+double bruteForceDistance( const LineString& a, const LineString& b )
+{
+    double dMin = std::numeric_limits< double >::infinity();
+
+    for ( size_t i = 0; i + 1 < a.numPoints(); i++ ) {
+        for ( size_t j = 0; j + 1 < b.numPoints(); j++ ) {
+            dMin = std::min( dMin, algorithm::distanceSegmentSegment( a.pointN( i ), a.pointN( i + 1 ), b.pointN( j ), b.pointN( j + 1 ) ) );
+        }
+    }
+
+    return dMin;
+}
+}
+
+// large LineStrings, the segments are searched in a tree
+BOOST_AUTO_TEST_CASE( testDistanceLineStringLineString_large )
+{
+    std::unique_ptr< LineString > gA = zigzag( 500, 0.0, 0.0 );
+    std::unique_ptr< LineString > gB = zigzag( 300, 100.25, 2.0 );
+    BOOST_CHECK_EQUAL( gA->distance( *gB ), bruteForceDistance( *gA, *gB ) );
+    BOOST_CHECK_EQUAL( gB->distance( *gA ), bruteForceDistance( *gA, *gB ) );
+
+    std::unique_ptr< LineString > gC = zigzag( 300, 100.25, 0.5 );
+    BOOST_CHECK_EQUAL( gA->distance( *gC ), 0.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testDistanceLineStringPolygon_large )
+{
+    std::unique_ptr< LineString > gA = zigzag( 500, 0.0, 0.0 );
+    std::unique_ptr< LineString > ring = zigzag( 200, 10.0, 3.0 );
+    ring->addPoint( Point( 110.0, 10.0 ) );
+    ring->addPoint( Point( 10.0, 10.0 ) );
+    ring->addPoint( Point( 10.0, 3.0 ) );
+    Polygon polygon( *ring );
+
+    BOOST_CHECK_EQUAL( gA->distance( polygon ), bruteForceDistance( *gA, *ring ) );
+    BOOST_CHECK_EQUAL( polygon.distance( polygon ), 0.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testDistanceMultiPolygon_islandChain )
+{
+    MultiPolygon islands ;
+
+    for ( size_t i = 0; i < 200; i++ ) {
+        const double x = 3.0 * i ;
+        const double y = ( i % 7 ) * 0.5 ;
+        std::unique_ptr< LineString > ring( new LineString() );
+        ring->addPoint( Point( x, y ) );
+        ring->addPoint( Point( x + 1.0, y ) );
+        ring->addPoint( Point( x + 1.0, y + 1.0 ) );
+        ring->addPoint( Point( x, y + 1.0 ) );
+        ring->addPoint( Point( x, y ) );
+        islands.addGeometry( new Polygon( ring.release() ) );
+    }
+
+    std::unique_ptr< Geometry > others[] = {
+        std::unique_ptr< Geometry >( io::readWkt( "POINT(100.5 10)" ) ),
+        std::unique_ptr< Geometry >( io::readWkt( "LINESTRING(-10 -10,700 -5)" ) ),
+        std::unique_ptr< Geometry >( io::readWkt( "MULTIPOINT((2 2),(300 -3))" ) ),
+        std::unique_ptr< Geometry >( io::readWkt( "POINT(30.5 0.5)" ) )
+    };
+
+    for ( size_t k = 0; k < 4; k++ ) {
+        double expected = std::numeric_limits< double >::infinity() ;
+
+        for ( size_t i = 0; i < islands.numGeometries(); i++ ) {
+            expected = std::min( expected, islands.geometryN( i ).distance( *others[k] ) );
+        }
+
+        BOOST_CHECK_CLOSE( islands.distance( *others[k] ), expected, 1e-9 );
+        BOOST_CHECK_CLOSE( others[k]->distance( islands ), expected, 1e-9 );
+    }
+}
+
 BOOST_AUTO_TEST_CASE( testDistanceMultiPointMultiPoint_disjoint )
 {
     std::unique_ptr< Geometry > gA( io::readWkt( "MULTIPOINT((0.0 0.0),(1.0 0.0),(1.0 1.0),(0.0 1.0))" ) );
@@ -243,5 +341,98 @@ BOOST_AUTO_TEST_CASE( testDistancePolygonSolid )
 }
 
 
+BOOST_AUTO_TEST_CASE( testDistancePointSolid_inside )
+{
+    std::unique_ptr< Geometry > gA( io::readWkt( "POINT(0.5 0.5 0.5)" ) );
+    std::unique_ptr< Geometry > gB( io::readWkt( "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" ) );
+    BOOST_CHECK_EQUAL( gA->distance3D( *gB ), 0.0 );
+    BOOST_CHECK_EQUAL( gB->distance3D( *gA ), 0.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testDistanceSolidSolid_disjoint )
+{
+    std::unique_ptr< Geometry > gA( io::readWkt( "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" ) );
+    std::unique_ptr< Geometry > gB( io::readWkt( "SOLID((((3 0 0,3 1 0,4 1 0,4 0 0,3 0 0)),((3 0 0,3 0 1,3 1 1,3 1 0,3 0 0)),((3 0 0,4 0 0,4 0 1,3 0 1,3 0 0)),((4 1 1,3 1 1,3 0 1,4 0 1,4 1 1)),((4 1 1,4 0 1,4 0 0,4 1 0,4 1 1)),((4 1 1,4 1 0,3 1 0,3 1 1,4 1 1))))" ) );
+    BOOST_CHECK_EQUAL( gA->distance3D( *gB ), 2.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testDistanceTINTIN )
+{
+    std::unique_ptr< Geometry > gA( io::readWkt( "TIN(((0 0 0,1 0 0,0 1 0,0 0 0)),((1 0 0,1 1 0,0 1 0,1 0 0)))" ) );
+    std::unique_ptr< Geometry > gB( io::readWkt( "TIN(((0 0 3,1 0 3,0 1 3,0 0 3)),((1 0 3,1 1 3,0 1 3,1 0 3)))" ) );
+    BOOST_CHECK_EQUAL( gA->distance3D( *gB ), 3.0 );
+}
+
+
+BOOST_AUTO_TEST_CASE( testDWithin )
+{
+    std::unique_ptr< Geometry > polygon( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0),(2 2,2 8,8 8,8 2,2 2))" ) );
+
+    const char* others[] = {
+        "POINT(12 5)",
+        "POINT(5 5)",
+        "LINESTRING(12 0,12 10)",
+        "LINESTRING(4 4,6 6)",
+        "POLYGON((4 4,6 4,6 6,4 6,4 4))",
+        "POLYGON((-5 -5,15 -5,15 15,-5 15,-5 -5))",
+        "MULTIPOINT((20 20),(10 12))"
+    };
+
+    for ( size_t i = 0; i < sizeof( others ) / sizeof( others[0] ); i++ ) {
+        std::unique_ptr< Geometry > g( io::readWkt( others[i] ) );
+        const double d = polygon->distance( *g );
+
+        BOOST_CHECK_MESSAGE( algorithm::dwithin( *polygon, *g, d ), others[i] );
+        BOOST_CHECK_MESSAGE( algorithm::dwithin( *g, *polygon, d + 0.5 ), others[i] );
+
+        if ( d > 0.0 ) {
+            BOOST_CHECK_MESSAGE( ! algorithm::dwithin( *polygon, *g, d * 0.99 ), others[i] );
+            BOOST_CHECK_MESSAGE( ! algorithm::dwithin( *g, *polygon, d * 0.99 ), others[i] );
+        }
+    }
+
+    BOOST_CHECK( ! algorithm::dwithin( *polygon, *polygon, -1.0 ) );
+    BOOST_CHECK( ! algorithm::dwithin( *polygon, Point(), 100.0 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testDWithinPointLineString )
+{
+    std::unique_ptr< Geometry > gA( io::readWkt( "POINT(0 3)" ) );
+    std::unique_ptr< Geometry > gB( io::readWkt( "LINESTRING(-5 0,5 0)" ) );
+    BOOST_CHECK( algorithm::dwithin( *gA, *gB, 3.0 ) );
+    BOOST_CHECK( algorithm::dwithin( *gB, *gA, 3.0 ) );
+    BOOST_CHECK( ! algorithm::dwithin( *gA, *gB, 2.9 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testDWithin3D )
+{
+    std::unique_ptr< Geometry > solid( io::readWkt( "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" ) );
+
+    const char* others[] = {
+        "POINT(0.5 0.5 3)",
+        "POINT(0.5 0.5 0.5)",
+        "LINESTRING(3 0 0,3 1 1)",
+        "TRIANGLE((0 0 2,1 0 2,0 1 2,0 0 2))",
+        "TIN(((3 0 0,4 0 0,3 1 0,3 0 0)))"
+    };
+
+    for ( size_t i = 0; i < sizeof( others ) / sizeof( others[0] ); i++ ) {
+        std::unique_ptr< Geometry > g( io::readWkt( others[i] ) );
+        const double d = solid->distance3D( *g );
+
+        BOOST_CHECK_MESSAGE( algorithm::dwithin3D( *solid, *g, d ), others[i] );
+        BOOST_CHECK_MESSAGE( algorithm::dwithin3D( *g, *solid, d ), others[i] );
+
+        if ( d > 0.0 ) {
+            BOOST_CHECK_MESSAGE( ! algorithm::dwithin3D( *solid, *g, d * 0.99 ), others[i] );
+        }
+    }
+
+    std::unique_ptr< Geometry > gA( io::readWkt( "POINT(0 0 0)" ) );
+    std::unique_ptr< Geometry > gB( io::readWkt( "POINT(0 3 4)" ) );
+    BOOST_CHECK( algorithm::dwithin3D( *gA, *gB, 5.0 ) );
+    BOOST_CHECK( ! algorithm::dwithin3D( *gA, *gB, 4.9 ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,133 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/algorithm/fastPredicates.h>
+
+using namespace SFCGAL ;
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_FastPredicatesTest )
+
+namespace {
+const char* pairs2D[][2] = {
+    { "POINT(1 1)", "POINT(1 1)" },
+    { "POINT(1 1)", "POINT(1 2)" },
+    { "POINT(1 1)", "LINESTRING(0 0,2 2)" },
+    { "POINT(1 1)", "LINESTRING(0 0,2 0,2 2)" },
+    { "POINT(1 1)", "LINESTRING(0 0,1 1,1 1,2 0)" },
+    { "POINT(3 3)", "POLYGON((0 0,10 0,10 10,0 10,0 0),(2 2,2 4,4 4,4 2,2 2))" },
+    { "POINT(2 3)", "POLYGON((0 0,10 0,10 10,0 10,0 0),(2 2,2 4,4 4,4 2,2 2))" },
+    { "POINT(1 1)", "POLYGON((0 0,10 0,10 10,0 10,0 0),(2 2,2 4,4 4,4 2,2 2))" },
+    { "POINT(10 5)", "POLYGON((0 0,10 0,10 10,0 10,0 0))" },
+    { "POINT(11 5)", "POLYGON((0 0,10 0,10 10,0 10,0 0))" },
+    { "POINT(0.25 0.25)", "TRIANGLE((0 0,1 0,0 1,0 0))" },
+    { "POINT(1 1)", "TRIANGLE((0 0,1 0,0 1,0 0))" },
+    { "POINT(5 5)", "MULTIPOLYGON(((0 0,1 0,1 1,0 0)),((4 4,6 4,6 6,4 6,4 4)))" },
+    { "POINT(3 3)", "MULTIPOLYGON(((0 0,1 0,1 1,0 0)),((4 4,6 4,6 6,4 6,4 4)))" },
+    { "LINESTRING(0 0,2 2)", "LINESTRING(0 2,2 0)" },
+    { "LINESTRING(0 0,2 2)", "LINESTRING(3 3,4 5)" },
+    { "LINESTRING(0 0,1 0,2 1,3 0,4 1,5 0)", "LINESTRING(0 2,5 2,5 0.5)" },
+    { "LINESTRING(0 0,1 0,2 1,3 0,4 1,5 0)", "LINESTRING(0 2,5 2,5 -0.5)" },
+    { "LINESTRING(0 0,2 2)", "POLYGON((0 0,10 0,10 10,0 10,0 0))" }
+};
+
+const char* pairs3D[][2] = {
+    { "POINT(1 1 1)", "POINT(1 1 1)" },
+    { "POINT(1 1 1)", "POINT(1 1 2)" },
+    { "POINT(1 1 1)", "LINESTRING(0 0 0,2 2 2)" },
+    { "POINT(1 1 0)", "LINESTRING(0 0 0,2 2 2)" },
+    { "LINESTRING(0 0 0,2 2 2)", "LINESTRING(0 2 0,2 0 2)" },
+    { "LINESTRING(0 0 0,2 2 2)", "LINESTRING(0 2 1,2 0 1.5)" },
+    { "POINT(0.5 0.5 0.5)", "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" },
+    { "POINT(1 0.5 0.5)", "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" },
+    { "POINT(0.5 0.5 1.5)", "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" }
+};
+}
+
+//
+// the fast paths agree with the GeometrySet based tests
+BOOST_AUTO_TEST_CASE( testIntersectsFastPath )
+{
+    for ( size_t i = 0; i < sizeof( pairs2D ) / sizeof( pairs2D[0] ); i++ ) {
+        std::unique_ptr< Geometry > ga( io::readWkt( pairs2D[i][0] ) );
+        std::unique_ptr< Geometry > gb( io::readWkt( pairs2D[i][1] ) );
+
+        const bool expected = algorithm::intersects( detail::GeometrySet<2>( *ga ), detail::GeometrySet<2>( *gb ) );
+
+        BOOST_CHECK_MESSAGE( algorithm::intersects( *ga, *gb ) == expected, pairs2D[i][0] << " " << pairs2D[i][1] );
+        BOOST_CHECK_MESSAGE( algorithm::intersects( *gb, *ga ) == expected, pairs2D[i][1] << " " << pairs2D[i][0] );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testIntersects3DFastPath )
+{
+    for ( size_t i = 0; i < sizeof( pairs3D ) / sizeof( pairs3D[0] ); i++ ) {
+        std::unique_ptr< Geometry > ga( io::readWkt( pairs3D[i][0] ) );
+        std::unique_ptr< Geometry > gb( io::readWkt( pairs3D[i][1] ) );
+
+        const bool expected = algorithm::intersects( detail::GeometrySet<3>( *ga ), detail::GeometrySet<3>( *gb ) );
+
+        BOOST_CHECK_MESSAGE( algorithm::intersects3D( *ga, *gb ) == expected, pairs3D[i][0] << " " << pairs3D[i][1] );
+        BOOST_CHECK_MESSAGE( algorithm::intersects3D( *gb, *ga ) == expected, pairs3D[i][1] << " " << pairs3D[i][0] );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testCoversFastPath )
+{
+    for ( size_t i = 0; i < sizeof( pairs2D ) / sizeof( pairs2D[0] ); i++ ) {
+        std::unique_ptr< Geometry > ga( io::readWkt( pairs2D[i][0] ) );
+        std::unique_ptr< Geometry > gb( io::readWkt( pairs2D[i][1] ) );
+
+        const bool expected = algorithm::covers( detail::GeometrySet<2>( *gb ), detail::GeometrySet<2>( *ga ) );
+
+        BOOST_CHECK_MESSAGE( algorithm::covers( *gb, *ga ) == expected, pairs2D[i][1] << " " << pairs2D[i][0] );
+    }
+
+    for ( size_t i = 0; i < sizeof( pairs3D ) / sizeof( pairs3D[0] ); i++ ) {
+        std::unique_ptr< Geometry > ga( io::readWkt( pairs3D[i][0] ) );
+        std::unique_ptr< Geometry > gb( io::readWkt( pairs3D[i][1] ) );
+
+        const bool expected = algorithm::covers( detail::GeometrySet<3>( *gb ), detail::GeometrySet<3>( *ga ) );
+
+        BOOST_CHECK_MESSAGE( algorithm::covers3D( *gb, *ga ) == expected, pairs3D[i][1] << " " << pairs3D[i][0] );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testUnhandledPairs )
+{
+    std::unique_ptr< Geometry > ga( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0))" ) );
+    std::unique_ptr< Geometry > gb( io::readWkt( "POLYGON((5 5,15 5,15 15,5 15,5 5))" ) );
+    std::unique_ptr< Geometry > gc( io::readWkt( "POLYGON((20 20,30 20,30 30,20 20))" ) );
+
+    BOOST_CHECK( ! detail::algorithm::intersectsFastPath( *ga, *gb ) );
+    // rejected on the envelopes
+    BOOST_CHECK( detail::algorithm::intersectsFastPath( *ga, *gc ) );
+    BOOST_CHECK( ! *detail::algorithm::intersectsFastPath( *ga, *gc ) );
+    BOOST_CHECK( detail::algorithm::coversFastPath( *ga, *gb ) );
+    BOOST_CHECK( ! *detail::algorithm::coversFastPath( *ga, *gb ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
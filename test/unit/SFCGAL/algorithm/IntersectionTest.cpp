@@ -21,6 +21,7 @@
 
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/computationMode.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
 #include <SFCGAL/io/wkt.h>
 #include <SFCGAL/io/GeometryStreams.h>
@@ -239,5 +240,27 @@ BOOST_AUTO_TEST_CASE( testFileIntersectionTest )
     }
 }
 
+BOOST_AUTO_TEST_CASE( testParallelIntersection )
+{
+    // grids of triangles, each triangle of A overlaps one triangle of B
+    MultiPolygon a, b;
+
+    for ( int i = 0; i < 8; i++ ) {
+        for ( int j = 0; j < 8; j++ ) {
+            a.addGeometry( Polygon( Triangle( Point( 2 * i, 2 * j ), Point( 2 * i + 1.5, 2 * j ), Point( 2 * i, 2 * j + 1.5 ) ) ) );
+            b.addGeometry( Polygon( Triangle( Point( 2 * i + 1, 2 * j + 1 ), Point( 2 * i + 1, 2 * j - 0.5 ), Point( 2 * i - 0.5, 2 * j + 1 ) ) ) );
+        }
+    }
+
+    std::unique_ptr<Geometry> sequential = algorithm::intersection( a, b );
+
+    algorithm::setNumThreads( 4 );
+    std::unique_ptr<Geometry> parallel = algorithm::intersection( a, b );
+    algorithm::setNumThreads( 1 );
+
+    BOOST_CHECK( ! sequential->isEmpty() );
+    BOOST_CHECK( *sequential == *parallel );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
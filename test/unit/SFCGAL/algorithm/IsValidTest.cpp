@@ -19,6 +19,8 @@
  */
 #include <boost/test/unit_test.hpp>
 
+#include <cmath>
+
 #include <SFCGAL/Point.h>
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/Polygon.h>
@@ -32,6 +34,7 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/io/wkt.h>
+#include <SFCGAL/Exception.h>
 #include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/detail/TestGeometry.h>
 
@@ -81,4 +84,84 @@ BOOST_AUTO_TEST_CASE( disconnectedTIN )
     Validity v = algorithm::isValid( *g );
     BOOST_CHECK( !v );
 }
+
+BOOST_AUTO_TEST_CASE( largeRing )
+{
+    // star shaped ring, the vertices are far from their non adjacent neighbors
+    const size_t N = 2000 ;
+    LineString ring ;
+
+    for ( size_t i = 0; i < N; i++ ) {
+        const double angle = 2 * M_PI * i / N ;
+        const double radius = i % 2 ? 10.0 : 9.0 ;
+        ring.addPoint( Point( radius * cos( angle ), radius * sin( angle ) ) );
+    }
+
+    ring.addPoint( ring.startPoint() );
+    BOOST_CHECK( algorithm::isValid( Polygon( ring ) ) );
+
+    // swapping two far away vertices makes the ring cross itself
+    std::swap( ring.pointN( 10 ), ring.pointN( N / 2 ) );
+    BOOST_CHECK( ! algorithm::isValid( Polygon( ring ) ) );
+}
+
+BOOST_AUTO_TEST_CASE( projectedValidity )
+{
+    // isValid2D gives the verdict of isValid on a 2D copy
+    const std::vector< TestGeometry > testGeometry( createTestGeometries() );
+
+    for ( std::size_t t=0; t<testGeometry.size(); t++ ) {
+        const TestGeometry& tg = testGeometry[t];
+        std::unique_ptr< Geometry > g;
+
+        try {
+            g = io::readWkt( tg.wkt );
+        }
+        catch ( WktParseException& ) {
+            continue;
+        }
+
+        if ( g->geometryTypeId() == TYPE_SOLID || g->geometryTypeId() == TYPE_MULTISOLID ) {
+            continue;
+        }
+
+        std::unique_ptr< Geometry > g2D( g->clone() );
+        algorithm::force2D( *g2D );
+
+        BOOST_CHECK_MESSAGE( bool( algorithm::isValid2D( *g ) ) == bool( algorithm::isValid( *g2D ) ),
+                             ( boost::format( "%d: %s" ) % t % tg.wkt ) );
+    }
+
+    // vertical square, valid in 3D, its projection has no area
+    std::unique_ptr< Geometry > vertical( io::readWkt( "POLYGON((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0))" ) );
+    BOOST_CHECK( algorithm::isValid( *vertical ) );
+    BOOST_CHECK( ! algorithm::isValid2D( *vertical ) );
+
+    // two triangles sharing an edge in projection only
+    std::unique_ptr< Geometry > tin( io::readWkt( "TIN(((0 0 0,1 0 0,0 1 0,0 0 0)),((1 0 1,1 1 1,0 1 1,1 0 1)))" ) );
+    BOOST_CHECK( ! algorithm::isValid( *tin ) );
+    BOOST_CHECK( algorithm::isValid2D( *tin ) );
+}
+
+//
+// the validity flag is only set explicitly, passing an assertion doesn't set it
+BOOST_AUTO_TEST_CASE( validityFlagIsExplicit )
+{
+    algorithm::ValidationPolicyScope scope( algorithm::VALIDATION_TRUST_FLAG );
+
+    // vertical square, valid in 3D, its projection has no area
+    std::unique_ptr< Geometry > vertical( io::readWkt( "POLYGON((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0))" ) );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( *vertical );
+    BOOST_CHECK( ! vertical->hasValidityFlag() );
+    BOOST_CHECK_THROW( SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( *vertical ), GeometryInvalidityException );
+
+    // trusted once flagged
+    LineString l ;
+    l.addPoint( Point( 0.0, 0.0 ) );
+    l.addPoint( Point( 0.0, 0.0 ) );
+    BOOST_CHECK_THROW( SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( l ), GeometryInvalidityException );
+    algorithm::propagateValidityFlag( l, true );
+    BOOST_CHECK_NO_THROW( SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( l ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
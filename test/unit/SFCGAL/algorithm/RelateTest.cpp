@@ -0,0 +1,128 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/relate.h>
+
+using namespace SFCGAL ;
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_RelateTest )
+
+namespace {
+const char* cube = "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" ;
+
+//
+// geometry A, geometry B, expected matrix
+const char* matrices2D[][3] = {
+    { "POINT(0 0)", "POINT(0 0)", "0FFFFFFF2" },
+    { "POINT(0 0)", "POINT(1 1)", "FF0FFF0F2" },
+    { "POLYGON((0 0,4 0,4 4,0 4,0 0))", "POINT(1 1)", "0F2FF1FF2" },
+    { "POLYGON((0 0,4 0,4 4,0 4,0 0))", "POINT(4 1)", "FF20F1FF2" },
+    { "POLYGON((0 0,4 0,4 4,0 4,0 0))", "POLYGON((0 0,4 0,4 4,0 4,0 0))", "2FFF1FFF2" },
+    { "POLYGON((0 0,2 0,2 2,0 2,0 0))", "POLYGON((1 1,3 1,3 3,1 3,1 1))", "212101212" },
+    { "POLYGON((0 0,1 0,1 1,0 1,0 0))", "POLYGON((1 0,2 0,2 1,1 1,1 0))", "FF2F11212" },
+    { "POLYGON((0 0,1 0,1 1,0 1,0 0))", "POLYGON((5 5,6 5,6 6,5 6,5 5))", "FF2FF1212" },
+    { "LINESTRING(0 0,2 2)", "LINESTRING(0 2,2 0)", "0F1FF0102" },
+    { "LINESTRING(0 0,1 1)", "LINESTRING(1 1,2 0)", "FF1F00102" },
+    { "LINESTRING(1 1,2 2)", "POLYGON((0 0,4 0,4 4,0 4,0 0))", "1FF0FF212" },
+    { "LINESTRING(-1 1,1 1)", "POLYGON((0 0,4 0,4 4,0 4,0 0))", "1010F0212" },
+    // closed, without boundary
+    { "LINESTRING(0 0,1 0,1 1,0 0)", "POINT(0 0)", "0F1FFFFF2" },
+    // mod-2 rule, (1 0) is not on the boundary
+    { "MULTILINESTRING((0 0,1 0),(1 0,2 0))", "POINT(1 0)", "0F1FF0FF2" }
+};
+
+const char* matrices3D[][3] = {
+    { cube, "POINT(0.5 0.5 0.5)", "0F3FF2FF3" },
+    { cube, "POINT(0.5 0.5 1)", "FF30F2FF3" },
+    { cube, "POINT(0.5 0.5 2)", "FF3FF20F3" },
+    { "LINESTRING(0 0 0,2 2 2)", "LINESTRING(0 2 1,2 0 1)", "0F1FF0103" }
+};
+
+std::string transpose( const std::string& matrix )
+{
+    std::string result( matrix );
+
+    for ( size_t i = 0; i < 3; i++ ) {
+        for ( size_t j = 0; j < 3; j++ ) {
+            result[ 3 * i + j ] = matrix[ 3 * j + i ];
+        }
+    }
+
+    return result;
+}
+}
+
+BOOST_AUTO_TEST_CASE( testRelate )
+{
+    for ( size_t i = 0; i < sizeof( matrices2D ) / sizeof( matrices2D[0] ); i++ ) {
+        std::unique_ptr< Geometry > ga( io::readWkt( matrices2D[i][0] ) );
+        std::unique_ptr< Geometry > gb( io::readWkt( matrices2D[i][1] ) );
+
+        BOOST_CHECK_MESSAGE( algorithm::relate( *ga, *gb ) == matrices2D[i][2], matrices2D[i][0] << " " << matrices2D[i][1] << " : " << algorithm::relate( *ga, *gb ) );
+        BOOST_CHECK_EQUAL( algorithm::relate( *gb, *ga ), transpose( matrices2D[i][2] ) );
+        BOOST_CHECK( algorithm::relate( *ga, *gb, matrices2D[i][2] ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testRelate3D )
+{
+    for ( size_t i = 0; i < sizeof( matrices3D ) / sizeof( matrices3D[0] ); i++ ) {
+        std::unique_ptr< Geometry > ga( io::readWkt( matrices3D[i][0] ) );
+        std::unique_ptr< Geometry > gb( io::readWkt( matrices3D[i][1] ) );
+
+        BOOST_CHECK_MESSAGE( algorithm::relate3D( *ga, *gb ) == matrices3D[i][2], matrices3D[i][1] << " : " << algorithm::relate3D( *ga, *gb ) );
+        BOOST_CHECK( algorithm::relate3D( *ga, *gb, matrices3D[i][2] ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testRelatePattern )
+{
+    std::unique_ptr< Geometry > line( io::readWkt( "LINESTRING(1 1,2 2)" ) );
+    std::unique_ptr< Geometry > polygon( io::readWkt( "POLYGON((0 0,4 0,4 4,0 4,0 0))" ) );
+
+    // within
+    BOOST_CHECK( algorithm::relate( *line, *polygon, "T*F**F***" ) );
+    // contains
+    BOOST_CHECK( algorithm::relate( *polygon, *line, "T*****FF*" ) );
+    BOOST_CHECK( ! algorithm::relate( *line, *polygon, "T*****FF*" ) );
+    // touches
+    BOOST_CHECK( ! algorithm::relate( *line, *polygon, "FT*******" ) );
+    // disjoint
+    BOOST_CHECK( ! algorithm::relate( *line, *polygon, "FF*FF****" ) );
+    BOOST_CHECK( algorithm::relate( *line, *polygon, "1*F0*****" ) );
+}
+
+BOOST_AUTO_TEST_CASE( testRelateMatches )
+{
+    BOOST_CHECK( algorithm::relateMatches( "212101212", "T*T***T**" ) );
+    BOOST_CHECK( ! algorithm::relateMatches( "212101212", "FF*FF****" ) );
+    BOOST_CHECK( algorithm::relateMatches( "0F3FF2FF3", "0*3**2**3" ) );
+
+    std::unique_ptr< Geometry > g( io::readWkt( "POINT(0 0)" ) );
+    BOOST_CHECK_THROW( algorithm::relate( *g, *g, "T*F" ), Exception );
+    BOOST_CHECK_THROW( algorithm::relate( *g, *g, "T*F**F**X" ), Exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,179 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/algorithm/spatialJoin.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/distance3d.h>
+#include <SFCGAL/io/wkt.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace SFCGAL;
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_SpatialJoinTest )
+
+namespace {
+typedef std::vector< std::pair< size_t, size_t > > Pairs;
+
+// 8 x 8 grid of squares of size 1.5 spaced by 1 (they overlap their neighbours)
+std::unique_ptr< GeometryCollection > squares()
+{
+    std::unique_ptr< GeometryCollection > collection( new GeometryCollection() );
+
+    for ( int i = 0; i < 8; i++ ) {
+        for ( int j = 0; j < 8; j++ ) {
+            LineString ring;
+            ring.addPoint( Point( i, j ) );
+            ring.addPoint( Point( i + 1.5, j ) );
+            ring.addPoint( Point( i + 1.5, j + 1.5 ) );
+            ring.addPoint( Point( i, j + 1.5 ) );
+            ring.addPoint( Point( i, j ) );
+            collection->addGeometry( Polygon( ring ) );
+        }
+    }
+
+    return collection;
+}
+
+// points and segments scattered over the grid, with an empty member
+std::unique_ptr< GeometryCollection > probes()
+{
+    std::unique_ptr< GeometryCollection > collection( new GeometryCollection() );
+
+    for ( int i = 0; i < 20; i++ ) {
+        const double x = ( i * 37 % 100 ) / 10.0 ;
+        const double y = ( i * 61 % 100 ) / 10.0 ;
+
+        if ( i % 2 ) {
+            collection->addGeometry( Point( x, y ) );
+        }
+        else {
+            collection->addGeometry( LineString( Point( x, y ), Point( x + 0.3, y - 0.2 ) ) );
+        }
+    }
+
+    collection->addGeometry( Point() );
+    return collection;
+}
+
+template < typename Predicate >
+Pairs nestedLoop( const Geometry& a, const Geometry& b, Predicate predicate )
+{
+    Pairs pairs;
+
+    for ( size_t i = 0; i < a.numGeometries(); i++ ) {
+        for ( size_t j = 0; j < b.numGeometries(); j++ ) {
+            if ( predicate( a.geometryN( i ), b.geometryN( j ) ) ) {
+                pairs.push_back( std::make_pair( i, j ) );
+            }
+        }
+    }
+
+    return pairs;
+}
+
+bool intersectsPredicate( const Geometry& a, const Geometry& b )
+{
+    return algorithm::intersects( a, b );
+}
+bool coversPredicate( const Geometry& a, const Geometry& b )
+{
+    return algorithm::covers( a, b );
+}
+bool dwithinPredicate( const Geometry& a, const Geometry& b )
+{
+    return ! a.isEmpty() && ! b.isEmpty() && algorithm::distance( a, b ) <= 0.4;
+}
+bool dwithin3DPredicate( const Geometry& a, const Geometry& b )
+{
+    return ! a.isEmpty() && ! b.isEmpty() && algorithm::distance3D( a, b ) <= 0.4;
+}
+}
+
+BOOST_AUTO_TEST_CASE( testIntersects )
+{
+    std::unique_ptr< GeometryCollection > a = squares();
+    std::unique_ptr< GeometryCollection > b = probes();
+
+    Pairs expected = nestedLoop( *a, *b, intersectsPredicate );
+    BOOST_CHECK( ! expected.empty() );
+    BOOST_CHECK( algorithm::spatialJoinPairs( *a, *b, algorithm::JOIN_INTERSECTS ) == expected );
+    BOOST_CHECK( algorithm::spatialJoinPairs( *a, *b, algorithm::JOIN_INTERSECTS_3D ) == expected );
+}
+
+BOOST_AUTO_TEST_CASE( testCovers )
+{
+    std::unique_ptr< GeometryCollection > a = squares();
+    std::unique_ptr< GeometryCollection > b = probes();
+
+    Pairs expected = nestedLoop( *a, *b, coversPredicate );
+    BOOST_CHECK( ! expected.empty() );
+    BOOST_CHECK( algorithm::spatialJoinPairs( *a, *b, algorithm::JOIN_COVERS ) == expected );
+}
+
+BOOST_AUTO_TEST_CASE( testDWithin )
+{
+    std::unique_ptr< GeometryCollection > a = probes();
+    std::unique_ptr< GeometryCollection > b = probes();
+
+    Pairs expected = nestedLoop( *a, *b, dwithinPredicate );
+    BOOST_CHECK( algorithm::spatialJoinPairs( *a, *b, algorithm::JOIN_DWITHIN, 0.4 ) == expected );
+    BOOST_CHECK( algorithm::spatialJoinPairs( *a, *b, algorithm::JOIN_DWITHIN_3D, 0.4 ) == nestedLoop( *a, *b, dwithin3DPredicate ) );
+    BOOST_CHECK( algorithm::spatialJoinPairs( *a, *b, algorithm::JOIN_DWITHIN, -1.0 ).empty() );
+}
+
+BOOST_AUTO_TEST_CASE( testCallbackOrder )
+{
+    std::unique_ptr< GeometryCollection > a = squares();
+    std::unique_ptr< GeometryCollection > b = probes();
+
+    Pairs streamed;
+    algorithm::spatialJoin( *a, *b, algorithm::JOIN_INTERSECTS, [&streamed]( size_t i, size_t j ) {
+        streamed.push_back( std::make_pair( i, j ) );
+    } );
+    BOOST_CHECK( streamed == nestedLoop( *a, *b, intersectsPredicate ) );
+}
+
+BOOST_AUTO_TEST_CASE( testParallel )
+{
+    std::unique_ptr< GeometryCollection > a = squares();
+    std::unique_ptr< GeometryCollection > b = probes();
+
+    BOOST_CHECK( algorithm::spatialJoinPairs( *a, *b, algorithm::JOIN_INTERSECTS, 0.0, 4 ) == nestedLoop( *a, *b, intersectsPredicate ) );
+}
+
+BOOST_AUTO_TEST_CASE( testNotCollections )
+{
+    std::unique_ptr< Geometry > a( io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0))" ) );
+    std::unique_ptr< Geometry > b( io::readWkt( "POINT(0.5 0.5)" ) );
+
+    Pairs pairs = algorithm::spatialJoinPairs( *a, *b, algorithm::JOIN_COVERS );
+    BOOST_REQUIRE_EQUAL( pairs.size(), 1U );
+    BOOST_CHECK_EQUAL( pairs[0].first, 0U );
+    BOOST_CHECK_EQUAL( pairs[0].second, 0U );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
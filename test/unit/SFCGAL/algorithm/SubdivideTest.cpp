@@ -0,0 +1,132 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/subdivide.h>
+#include <SFCGAL/algorithm/area.h>
+
+#include <cmath>
+
+using namespace SFCGAL ;
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_SubdivideTest )
+
+namespace {
+//
+// star shaped polygon with a square hole
+std::unique_ptr< Polygon > star( size_t n )
+{
+    std::unique_ptr< LineString > ring( new LineString() );
+
+    for ( size_t i = 0; i < n; i++ ) {
+        const double angle = 2.0 * M_PI * i / n ;
+        const double radius = ( i % 2 == 0 ) ? 10.0 : 6.0 ;
+        ring->addPoint( Point( radius * std::cos( angle ), radius * std::sin( angle ) ) );
+    }
+
+    const Point start = ring->startPoint();
+    ring->addPoint( start );
+
+    std::unique_ptr< Polygon > polygon( new Polygon( ring.release() ) );
+    std::unique_ptr< Geometry > hole( io::readWkt( "LINESTRING(-1 -1,-1 1,1 1,1 -1,-1 -1)" ) );
+    polygon->addInteriorRing( hole->as< LineString >() );
+    return polygon;
+}
+
+size_t numVertices( const Polygon& polygon )
+{
+    size_t n = 0 ;
+
+    for ( size_t i = 0; i < polygon.numRings(); i++ ) {
+        n += polygon.ringN( i ).numPoints();
+    }
+
+    return n;
+}
+}
+
+BOOST_AUTO_TEST_CASE( testSmallPolygon )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0))" ) );
+    std::unique_ptr< MultiPolygon > result = algorithm::subdivide( *g, 5 );
+
+    BOOST_REQUIRE_EQUAL( result->numGeometries(), 1U );
+    BOOST_CHECK( result->polygonN( 0 ) == *g );
+}
+
+BOOST_AUTO_TEST_CASE( testBoundedVertices )
+{
+    std::unique_ptr< Polygon > g = star( 200 );
+    std::unique_ptr< MultiPolygon > result = algorithm::subdivide( *g, 16 );
+
+    BOOST_CHECK( result->numGeometries() > 1U );
+
+    for ( size_t i = 0; i < result->numGeometries(); i++ ) {
+        BOOST_CHECK_LE( numVertices( result->polygonN( i ) ), 16U );
+    }
+
+    BOOST_CHECK_CLOSE( algorithm::area( *result ), algorithm::area( *g ), 1e-6 );
+}
+
+BOOST_AUTO_TEST_CASE( testMultiPolygon )
+{
+    std::unique_ptr< MultiPolygon > g( new MultiPolygon() );
+    g->addGeometry( star( 40 ).release() );
+    std::unique_ptr< Geometry > square( io::readWkt( "POLYGON((20 0,30 0,30 10,20 10,20 0))" ) );
+    g->addGeometry( *square );
+
+    std::unique_ptr< MultiPolygon > result = algorithm::subdivide( *g, 8 );
+
+    for ( size_t i = 0; i < result->numGeometries(); i++ ) {
+        BOOST_CHECK_LE( numVertices( result->polygonN( i ) ), 8U );
+    }
+
+    BOOST_CHECK_CLOSE( algorithm::area( *result ), algorithm::area( *g ), 1e-6 );
+}
+
+BOOST_AUTO_TEST_CASE( testParallel )
+{
+    std::unique_ptr< Polygon > g = star( 400 );
+    std::unique_ptr< MultiPolygon > sequential = algorithm::subdivide( *g, 12 );
+    std::unique_ptr< MultiPolygon > parallel = algorithm::subdivide( *g, 12, 4 );
+
+    // same pieces in the same order
+    BOOST_CHECK( *sequential == *parallel );
+}
+
+BOOST_AUTO_TEST_CASE( testInvalidArguments )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0))" ) );
+    BOOST_CHECK_THROW( algorithm::subdivide( *g, 4 ), Exception );
+
+    std::unique_ptr< Geometry > line( io::readWkt( "LINESTRING(0 0,10 0)" ) );
+    BOOST_CHECK_THROW( algorithm::subdivide( *line, 10 ), InappropriateGeometryException );
+
+    std::unique_ptr< Geometry > empty( io::readWkt( "MULTIPOLYGON EMPTY" ) );
+    BOOST_CHECK( algorithm::subdivide( *empty, 10 )->isEmpty() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
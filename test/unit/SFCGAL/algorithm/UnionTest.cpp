@@ -18,6 +18,8 @@
  *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
  */
 #include <SFCGAL/Exception.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Polygon.h>
 #include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/algorithm/union.h>
 #include <SFCGAL/algorithm/volume.h>
@@ -31,6 +33,7 @@
 #include <SFCGAL/io/vtk.h>
 
 #include <boost/test/unit_test.hpp>
+#include <boost/format.hpp>
 
 namespace SFCGAL {
 namespace algorithm {
@@ -397,5 +400,37 @@ BOOST_AUTO_TEST_CASE( VolumeVolume )
     }
 }
 
+BOOST_AUTO_TEST_CASE( UnaryUnion )
+{
+    // 10x10 overlapping squares
+    GeometryCollection squares;
+
+    for ( int i = 0; i < 10; i++ ) {
+        for ( int j = 0; j < 10; j++ ) {
+            squares.addGeometry( io::readWkt( ( boost::format( "POLYGON((%1% %2%,%3% %2%,%3% %4%,%1% %4%,%1% %2%))" )
+                                                % i % j % ( i + 1.5 ) % ( j + 1.5 ) ).str() ).release() );
+        }
+    }
+
+    std::unique_ptr<Geometry> u = algorithm::unaryUnion( squares );
+    BOOST_CHECK( u->is< Polygon >() );
+    BOOST_CHECK_CLOSE( algorithm::area( *u ), 10.5 * 10.5, 1e-9 );
+
+    // same reduction tree whatever the number of threads
+    std::unique_ptr<Geometry> u4 = algorithm::unaryUnion( squares, 4 );
+    BOOST_CHECK( *u == *u4 );
+}
+
+BOOST_AUTO_TEST_CASE( UnaryUnionDegenerated )
+{
+    BOOST_CHECK( algorithm::unaryUnion( GeometryCollection() )->isEmpty() );
+
+    std::unique_ptr<Geometry> polygon = io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0))" );
+    BOOST_CHECK_CLOSE( algorithm::area( *algorithm::unaryUnion( *polygon ) ), 1.0, 1e-9 );
+
+    std::unique_ptr<Geometry> single = io::readWkt( "GEOMETRYCOLLECTION(POLYGON EMPTY,POLYGON((0 0,1 0,1 1,0 1,0 0)))" );
+    BOOST_CHECK_CLOSE( algorithm::area( *algorithm::unaryUnion( *single ) ), 1.0, 1e-9 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
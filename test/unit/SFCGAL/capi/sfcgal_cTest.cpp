@@ -136,6 +136,63 @@ BOOST_AUTO_TEST_CASE( testCovers )
     BOOST_CHECK( sfcgal_geometry_covers( g1.get(), g2.get() ) );
 }
 
+BOOST_AUTO_TEST_CASE( testDWithin )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    std::unique_ptr<Geometry> g1( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0))" ) );
+    std::unique_ptr<Geometry> g2( io::readWkt( "LINESTRING(13 0,13 10)" ) );
+
+    BOOST_CHECK_EQUAL( sfcgal_geometry_dwithin( g1.get(), g2.get(), 3.0 ), 1 );
+    BOOST_CHECK_EQUAL( sfcgal_geometry_dwithin( g1.get(), g2.get(), 2.5 ), 0 );
+    BOOST_CHECK_EQUAL( sfcgal_geometry_dwithin_3d( g1.get(), g2.get(), 3.0 ), 1 );
+    BOOST_CHECK_EQUAL( sfcgal_geometry_dwithin_3d( g1.get(), g2.get(), 2.5 ), 0 );
+}
+
+BOOST_AUTO_TEST_CASE( testClip )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    std::unique_ptr<Geometry> g1( io::readWkt( "LINESTRING(-1 1,3 1)" ) );
+    std::unique_ptr<Geometry> expected( io::readWkt( "LINESTRING(0 1,2 1)" ) );
+
+    hasError = false;
+    std::unique_ptr<Geometry> clipped( reinterpret_cast<Geometry*>( sfcgal_geometry_clip( g1.get(), 0.0, 0.0, 2.0, 2.0 ) ) );
+    BOOST_CHECK( hasError == false );
+    BOOST_CHECK( *clipped == *expected );
+}
+
+BOOST_AUTO_TEST_CASE( testRelate )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    std::unique_ptr<Geometry> g1( io::readWkt( "POLYGON((0 0,2 0,2 2,0 2,0 0))" ) );
+    std::unique_ptr<Geometry> g2( io::readWkt( "POLYGON((1 1,3 1,3 3,1 3,1 1))" ) );
+
+    char* matrix;
+    size_t len;
+    sfcgal_geometry_relate( g1.get(), g2.get(), &matrix, &len );
+    BOOST_CHECK_EQUAL( std::string( matrix, len ), "212101212" );
+    free( matrix );
+
+    BOOST_CHECK_EQUAL( sfcgal_geometry_relate_pattern( g1.get(), g2.get(), "T*T***T**" ), 1 );
+    BOOST_CHECK_EQUAL( sfcgal_geometry_relate_pattern( g1.get(), g2.get(), "FF*FF****" ), 0 );
+
+    hasError = false;
+    BOOST_CHECK_EQUAL( sfcgal_geometry_relate_pattern( g1.get(), g2.get(), "TT" ), -1 );
+    BOOST_CHECK( hasError == true );
+
+    // on error, no buffer is returned
+    std::unique_ptr<Geometry> invalid( io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0),(2 2,3 2,3 3,2 3,2 2))" ) );
+    hasError = false;
+    matrix = ( char* )1;
+    len = 9;
+    sfcgal_geometry_relate( invalid.get(), g2.get(), &matrix, &len );
+    BOOST_CHECK( hasError == true );
+    BOOST_CHECK( matrix == NULL );
+    BOOST_CHECK_EQUAL( len, 0U );
+}
+
 BOOST_AUTO_TEST_CASE( testLineSubstring )
 {
     sfcgal_set_error_handlers( printf, on_error );
@@ -147,4 +204,77 @@ BOOST_AUTO_TEST_CASE( testLineSubstring )
 
     BOOST_CHECK( sfcgal_geometry_covers_3d( ls, g2.get() ) );
 }
+BOOST_AUTO_TEST_CASE( testValidationPolicy )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+    // hole outside of the exterior ring
+    std::unique_ptr<Geometry> invalid( io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0),(2 2,3 2,3 3,2 3,2 2))" ) );
+    std::unique_ptr<Geometry> point( io::readWkt( "POINT(0.5 0.5)" ) );
+
+    BOOST_CHECK_EQUAL( sfcgal_geometry_validation_policy(), SFCGAL_VALIDATION_TRUST_FLAG );
+
+    hasError = false;
+    sfcgal_geometry_intersects( invalid.get(), point.get() );
+    BOOST_CHECK( hasError == true );
+
+    sfcgal_set_geometry_validation( 0 );
+    hasError = false;
+    BOOST_CHECK_EQUAL( sfcgal_geometry_intersects( invalid.get(), point.get() ), 1 );
+    BOOST_CHECK( hasError == false );
+
+    // the thread policy overrides the global one, and ignores the flag
+    sfcgal_geometry_force_valid( invalid.get(), 1 );
+    sfcgal_set_thread_geometry_validation_policy( SFCGAL_VALIDATION_ON );
+    hasError = false;
+    sfcgal_geometry_intersects( invalid.get(), point.get() );
+    BOOST_CHECK( hasError == true );
+
+    sfcgal_reset_thread_geometry_validation_policy();
+    BOOST_CHECK_EQUAL( sfcgal_geometry_validation_policy(), SFCGAL_VALIDATION_OFF );
+
+    sfcgal_set_geometry_validation( 1 );
+    hasError = false;
+    BOOST_CHECK_EQUAL( sfcgal_geometry_intersects( invalid.get(), point.get() ), 1 );
+    BOOST_CHECK( hasError == false );
+}
+
+BOOST_AUTO_TEST_CASE( testSpatialIndex )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+    std::unique_ptr<Geometry> g( io::readWkt( "GEOMETRYCOLLECTION(POINT(0 0),LINESTRING(5 5,6 6),POLYGON((10 0,11 0,11 1,10 0)))" ) );
+
+    hasError = false;
+    BOOST_CHECK( sfcgal_index_create( 4 ) == 0 );
+    BOOST_CHECK( hasError == true );
+
+    sfcgal_index_t* index = sfcgal_index_create_from_geometry( g.get(), 2 );
+    BOOST_CHECK_EQUAL( sfcgal_index_dimension( index ), 2 );
+    BOOST_CHECK_EQUAL( sfcgal_index_size( index ), 3U );
+
+    const double minCoords[2] = { 4.0, 4.0 };
+    const double maxCoords[2] = { 7.0, 7.0 };
+    size_t* ids;
+    size_t len;
+    sfcgal_index_query_box( index, minCoords, maxCoords, &ids, &len );
+    BOOST_REQUIRE_EQUAL( len, 1U );
+    BOOST_CHECK_EQUAL( ids[0], 1U );
+    free( ids );
+
+    char* buffer;
+    size_t bufferLen;
+    sfcgal_io_write_binary_index( index, &buffer, &bufferLen );
+    sfcgal_index_delete( index );
+
+    index = sfcgal_io_read_binary_index( buffer, bufferLen );
+    free( buffer );
+    BOOST_REQUIRE( index != 0 );
+
+    std::unique_ptr<Geometry> point( io::readWkt( "POINT(9 0)" ) );
+    sfcgal_index_nearest_geometry( index, point.get(), 1, &ids, &len );
+    BOOST_REQUIRE_EQUAL( len, 1U );
+    BOOST_CHECK_EQUAL( ids[0], 2U );
+    free( ids );
+
+    sfcgal_index_delete( index );
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,133 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/detail/BoxIntersection.h>
+
+#include <CGAL/box_intersection_d.h>
+
+#include <vector>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_BoxIntersectionTest )
+
+namespace {
+typedef CGAL::Box_intersection_d::Box_d< double, 2 > Box ;
+
+struct CountCallback {
+    CountCallback( size_t stopAt_ = 0 ): count( 0 ), stopAt( stopAt_ ) {}
+
+    bool operator()( const Box&, const Box& ) {
+        ++count;
+        return count != stopAt ;
+    }
+
+    size_t count ;
+    size_t stopAt ;
+};
+
+bool overlap( const Box& a, const Box& b )
+{
+    for ( int i = 0; i < 2; i++ ) {
+        if ( a.max_coord( i ) < b.min_coord( i ) || b.max_coord( i ) < a.min_coord( i ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// pseudo random boxes in [0,100]x[0,100]
+std::vector< Box > randomBoxes( size_t n, unsigned int seed )
+{
+    std::vector< Box > boxes ;
+
+    for ( size_t i = 0; i < n; i++ ) {
+        seed = seed * 1103515245 + 12345 ;
+        const double x = ( seed >> 8 ) % 100 ;
+        seed = seed * 1103515245 + 12345 ;
+        const double y = ( seed >> 8 ) % 100 ;
+        seed = seed * 1103515245 + 12345 ;
+        const double size = ( seed >> 8 ) % 10 ;
+        const double lo[2] = { x, y };
+        const double hi[2] = { x + size, y + size };
+        boxes.push_back( Box( lo, hi ) );
+    }
+
+    return boxes ;
+}
+}
+
+BOOST_AUTO_TEST_CASE( testBipartite )
+{
+    std::vector< Box > a = randomBoxes( 200, 1 );
+    std::vector< Box > b = randomBoxes( 300, 2 );
+
+    size_t expected = 0 ;
+
+    for ( size_t i = 0; i < a.size(); i++ ) {
+        for ( size_t j = 0; j < b.size(); j++ ) {
+            expected += overlap( a[i], b[j] ) ? 1 : 0 ;
+        }
+    }
+
+    BOOST_REQUIRE( expected > 2 );
+
+    CountCallback callback ;
+    BOOST_CHECK( detail::visitIntersectingBoxes( a.begin(), a.end(), b.begin(), b.end(), callback ) );
+    BOOST_CHECK_EQUAL( callback.count, expected );
+
+    CountCallback stopping( 2 );
+    BOOST_CHECK( ! detail::visitIntersectingBoxes( a.begin(), a.end(), b.begin(), b.end(), stopping ) );
+    BOOST_CHECK_EQUAL( stopping.count, 2U );
+}
+
+BOOST_AUTO_TEST_CASE( testSelf )
+{
+    std::vector< Box > a = randomBoxes( 300, 3 );
+
+    size_t expected = 0 ;
+
+    for ( size_t i = 0; i < a.size(); i++ ) {
+        for ( size_t j = i + 1; j < a.size(); j++ ) {
+            expected += overlap( a[i], a[j] ) ? 1 : 0 ;
+        }
+    }
+
+    CountCallback callback ;
+    BOOST_CHECK( detail::visitIntersectingBoxes( a.begin(), a.end(), callback ) );
+    BOOST_CHECK_EQUAL( callback.count, expected );
+}
+
+BOOST_AUTO_TEST_CASE( testTouchingBoxes )
+{
+    const double lo1[2] = { 0, 0 }, hi1[2] = { 1, 1 };
+    const double lo2[2] = { 1, 1 }, hi2[2] = { 2, 2 };
+    std::vector< Box > a( 1, Box( lo1, hi1 ) );
+    std::vector< Box > b( 1, Box( lo2, hi2 ) );
+
+    CountCallback callback ;
+    detail::visitIntersectingBoxes( a.begin(), a.end(), b.begin(), b.end(), callback );
+    BOOST_CHECK_EQUAL( callback.count, 1U );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
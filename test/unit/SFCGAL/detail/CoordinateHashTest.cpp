@@ -0,0 +1,67 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/detail/CoordinateHash.h>
+#include <SFCGAL/Coordinate.h>
+
+using namespace SFCGAL ;
+using namespace SFCGAL::detail ;
+
+// always after CGAL
+using namespace boost::unit_test ;
+
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_CoordinateHashTest )
+
+BOOST_AUTO_TEST_CASE( testEqualExactValues )
+{
+    // same exact value, computed in two ways (different approximations)
+    const Kernel::FT a = Kernel::FT( 1 ) / 3;
+    const Kernel::FT b = ( Kernel::FT( 1 ) - Kernel::FT( 2 ) / 3 ) * 1;
+    BOOST_REQUIRE( a == b );
+
+    CoordinateHash hash;
+    BOOST_CHECK_EQUAL( hash( Kernel::Point_2( a, 2 ) ), hash( Kernel::Point_2( b, 2 ) ) );
+    BOOST_CHECK_EQUAL( hash( Kernel::Point_3( a, 2, a ) ), hash( Kernel::Point_3( b, 2, b ) ) );
+    BOOST_CHECK_EQUAL( hash( Kernel::Point_2( 0.0, 1 ) ), hash( Kernel::Point_2( -0.0, 1 ) ) );
+}
+
+BOOST_AUTO_TEST_CASE( testMixedDimension )
+{
+    // Coordinate == treats a 2D coordinate as z = 0
+    CoordinateHash hash;
+    BOOST_REQUIRE( Coordinate( 1.0, 2.0 ) == Coordinate( 1.0, 2.0, 0.0 ) );
+    BOOST_CHECK_EQUAL( hash( Coordinate( 1.0, 2.0 ) ), hash( Coordinate( 1.0, 2.0, 0.0 ) ) );
+    BOOST_CHECK_EQUAL( hash( Coordinate( 1.0, 2.0, 3.0 ) ), hash( Kernel::Point_3( 1, 2, 3 ) ) );
+}
+
+BOOST_AUTO_TEST_CASE( testWelding )
+{
+    CoordinateIndex< Kernel::Point_2, int >::Type index;
+    const Kernel::FT third = Kernel::FT( 1 ) / 3;
+    index.insert( std::make_pair( Kernel::Point_2( third, 0 ), 0 ) );
+    index.insert( std::make_pair( Kernel::Point_2( CGAL::to_double( third ), 0 ), 1 ) );
+    index.insert( std::make_pair( Kernel::Point_2( Kernel::FT( 2 ) / 6, 0 ), 2 ) );
+    BOOST_CHECK_EQUAL( index.size(), 2U );
+    BOOST_CHECK_EQUAL( index[ Kernel::Point_2( third, 0 ) ], 0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,183 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/io/wkt.h>
+
+using namespace SFCGAL ;
+using namespace SFCGAL::detail ;
+
+// always after CGAL
+using namespace boost::unit_test ;
+
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_GeometrySetTest )
+
+BOOST_AUTO_TEST_CASE( testPointsAreSortedAndUnique )
+{
+    GeometrySet<2> gs( *io::readWkt( "MULTIPOINT((3 1),(1 2),(3 1),(1 1),(1 2))" ) );
+    BOOST_REQUIRE_EQUAL( gs.points().size(), 3U );
+
+    GeometrySet<2>::PointCollection::const_iterator it = gs.points().begin();
+    BOOST_CHECK_EQUAL( it->primitive(), Kernel::Point_2( 1, 1 ) );
+    ++it;
+    BOOST_CHECK_EQUAL( it->primitive(), Kernel::Point_2( 1, 2 ) );
+    ++it;
+    BOOST_CHECK_EQUAL( it->primitive(), Kernel::Point_2( 3, 1 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testExactComparison )
+{
+    // 1/3 and 0.333... have overlapping approximations, the exact comparison decides
+    const Kernel::FT third = Kernel::FT( 1 ) / 3;
+    GeometrySet<2> gs;
+    gs.addPrimitive( Kernel::Point_2( third, 0 ) );
+    gs.addPrimitive( Kernel::Point_2( CGAL::to_double( third ), 0 ) );
+    gs.addPrimitive( Kernel::Point_2( Kernel::FT( 2 ) / 6, 0 ) );
+    BOOST_CHECK_EQUAL( gs.points().size(), 2U );
+}
+
+BOOST_AUTO_TEST_CASE( testSegmentsAreUnique )
+{
+    GeometrySet<3> gs( *io::readWkt( "MULTILINESTRING((0 0 0,1 0 0,1 1 0),(1 0 0,1 1 0,2 2 2))" ) );
+    BOOST_CHECK_EQUAL( gs.segments().size(), 3U );
+}
+
+BOOST_AUTO_TEST_CASE( testMerge )
+{
+    GeometrySet<2> gs( *io::readWkt( "GEOMETRYCOLLECTION(POINT(0 0),LINESTRING(0 0,1 1),POLYGON((0 0,1 0,1 1,0 0)))" ) );
+    GeometrySet<2> other( *io::readWkt( "GEOMETRYCOLLECTION(POINT(0 0),POINT(2 2),LINESTRING(0 0,1 1),POLYGON((0 0,1 0,1 1,0 0)))" ) );
+    gs.merge( other );
+    BOOST_CHECK_EQUAL( gs.points().size(), 2U );
+    BOOST_CHECK_EQUAL( gs.segments().size(), 1U );
+    // surfaces are not made unique
+    BOOST_CHECK_EQUAL( gs.surfaces().size(), 2U );
+}
+
+BOOST_AUTO_TEST_CASE( testCollectPoints )
+{
+    GeometrySet<2> surface( *io::readWkt( "POLYGON((0 0,4 0,4 4,0 4,0 0),(1 1,1 2,2 2,2 1,1 1))" ) );
+    GeometrySet<2> gs;
+    gs.addPrimitive( Kernel::Point_2( 0, 0 ) );
+    gs.collectPoints( PrimitiveHandle<2>( &surface.surfaces().front().primitive() ) );
+    BOOST_CHECK_EQUAL( gs.points().size(), 8U );
+}
+
+BOOST_AUTO_TEST_CASE( testHandlesAreStable )
+{
+    GeometrySet<2> gs( *io::readWkt( "GEOMETRYCOLLECTION(POINT(0 0),LINESTRING(0 0,1 1,2 0),POLYGON((0 0,1 0,1 1,0 0)))" ) );
+    HandleCollection<2>::Type handles;
+    BoxCollection<2>::Type boxes;
+    gs.computeBoundingBoxes( handles, boxes );
+    BOOST_REQUIRE_EQUAL( boxes.size(), 4U );
+
+    HandleCollection<2>::Type::const_iterator it = handles.begin();
+
+    for ( size_t i = 0; i < boxes.size(); ++i, ++it ) {
+        BOOST_CHECK_EQUAL( boxes[i].handle(), &*it );
+    }
+}
+
+//
+// points and segments added one at a time are staged and merged in one pass
+BOOST_AUTO_TEST_CASE( testAddPrimitiveLarge )
+{
+    const int N = 100000 ;
+    GeometrySet<2> gs;
+
+    // reverse order, each primitive twice, the first one is flagged
+    for ( int i = N - 1; i >= 0; --i ) {
+        gs.addPrimitive( Kernel::Point_2( i, i % 7 ), 1 );
+        gs.addPrimitive( Kernel::Segment_2( Kernel::Point_2( i, 0 ), Kernel::Point_2( i + 1, 1 ) ), 1 );
+    }
+
+    for ( int i = 0; i < N; ++i ) {
+        gs.addPrimitive( Kernel::Point_2( i, i % 7 ) );
+        gs.addPrimitive( Kernel::Segment_2( Kernel::Point_2( i, 0 ), Kernel::Point_2( i + 1, 1 ) ) );
+    }
+
+    BOOST_REQUIRE_EQUAL( gs.points().size(), size_t( N ) );
+    BOOST_REQUIRE_EQUAL( gs.segments().size(), size_t( N ) );
+    BOOST_CHECK_EQUAL( gs.dimension(), 1 );
+
+    int i = 0 ;
+
+    for ( GeometrySet<2>::PointCollection::const_iterator it = gs.points().begin(); it != gs.points().end(); ++it, ++i ) {
+        BOOST_CHECK_EQUAL( it->primitive(), Kernel::Point_2( i, i % 7 ) );
+        BOOST_CHECK_EQUAL( it->flags(), 1 );
+    }
+
+    // adding after a read merges again
+    gs.addPrimitive( Kernel::Point_2( -1, 0 ) );
+    BOOST_CHECK_EQUAL( gs.points().size(), size_t( N + 1 ) );
+    BOOST_CHECK_EQUAL( gs.points().begin()->primitive(), Kernel::Point_2( -1, 0 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testHandlesStableWhileAdding )
+{
+    GeometrySet<2> gs( *io::readWkt( "GEOMETRYCOLLECTION(POINT(1 1),LINESTRING(1 1,2 2))" ) );
+    HandleCollection<2>::Type handles;
+    BoxCollection<2>::Type boxes;
+    gs.computeBoundingBoxes( handles, boxes );
+    BOOST_REQUIRE_EQUAL( handles.size(), 2U );
+
+    const Kernel::Point_2* point = handles[0].as< Kernel::Point_2 >();
+    const Kernel::Segment_2* segment = handles[1].as< Kernel::Segment_2 >();
+
+    for ( int i = 0; i < 1000; ++i ) {
+        gs.addPrimitive( Kernel::Point_2( -i, 0 ) );
+        gs.addPrimitive( Kernel::Segment_2( Kernel::Point_2( -i, 0 ), Kernel::Point_2( -i, 1 ) ) );
+    }
+
+    // the staged primitives are not merged yet
+    BOOST_CHECK_EQUAL( *point, Kernel::Point_2( 1, 1 ) );
+    BOOST_CHECK_EQUAL( *segment, Kernel::Segment_2( Kernel::Point_2( 1, 1 ), Kernel::Point_2( 2, 2 ) ) );
+}
+
+BOOST_AUTO_TEST_CASE( testFilterCovered )
+{
+    GeometrySet<2> gs( *io::readWkt( "GEOMETRYCOLLECTION("
+                                     "POLYGON((0 0,4 0,4 4,0 4,0 0)),"
+                                     "LINESTRING(1 1,2 2),LINESTRING(10 10,11 11),"
+                                     "LINESTRING(20 0,30 0),LINESTRING(22 0,23 0),"
+                                     "POINT(3 3),POINT(20 20),POINT(10 10))" ) );
+    GeometrySet<2> filtered;
+    gs.filterCovered( filtered );
+    BOOST_CHECK_EQUAL( filtered.surfaces().size(), 1U );
+    BOOST_CHECK_EQUAL( filtered.segments().size(), 2U );
+    BOOST_REQUIRE_EQUAL( filtered.points().size(), 1U );
+    BOOST_CHECK_EQUAL( filtered.points().begin()->primitive(), Kernel::Point_2( 20, 20 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testFilterCovered3D )
+{
+    GeometrySet<3> gs( *io::readWkt( "GEOMETRYCOLLECTION("
+                                     "LINESTRING(0 0 0,4 0 0),LINESTRING(1 0 0,2 0 0),"
+                                     "POINT(3 0 0),POINT(3 0 1))" ) );
+    GeometrySet<3> filtered;
+    gs.filterCovered( filtered );
+    BOOST_CHECK_EQUAL( filtered.segments().size(), 1U );
+    BOOST_REQUIRE_EQUAL( filtered.points().size(), 1U );
+    BOOST_CHECK_EQUAL( filtered.points().begin()->primitive(), Kernel::Point_3( 3, 0, 1 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,127 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/detail/tools/ParallelFor.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_ParallelForTest )
+
+namespace {
+
+struct CountTask {
+    CountTask( size_t n ): counts( n ) {}
+
+    void operator()( size_t i ) {
+        ++counts[i];
+    }
+
+    std::vector< int > counts ;
+};
+
+//
+// records the thread of the nested tasks
+struct NestedTask {
+    NestedTask( size_t n ): threads( n ), inside( n ), innerThreads( n ) {}
+
+    struct Inner {
+        std::vector< std::thread::id >* ids ;
+
+        void operator()( size_t j ) {
+            ( *ids )[j] = std::this_thread::get_id();
+        }
+    };
+
+    void operator()( size_t i ) {
+        threads[i] = std::this_thread::get_id();
+        // Boost.Test assertions are not thread-safe, checked afterwards
+        inside[i] = tools::insideParallelFor();
+
+        innerThreads[i].resize( 64 );
+        Inner inner = { &innerThreads[i] };
+        tools::parallelFor( innerThreads[i].size(), 4, inner );
+    }
+
+    std::vector< std::thread::id > threads ;
+    std::vector< char > inside ;
+    std::vector< std::vector< std::thread::id > > innerThreads ;
+};
+
+struct ThrowingTask {
+    void operator()( size_t i ) {
+        if ( i == 10 ) {
+            throw std::runtime_error( "task 10" );
+        }
+    }
+};
+
+}
+
+BOOST_AUTO_TEST_CASE( testAllTasksRunOnce )
+{
+    CountTask task( 1000 );
+    tools::parallelFor( task.counts.size(), 4, task );
+
+    for ( size_t i = 0; i < task.counts.size(); i++ ) {
+        BOOST_CHECK_EQUAL( task.counts[i], 1 );
+    }
+
+    BOOST_CHECK( ! tools::insideParallelFor() );
+}
+
+BOOST_AUTO_TEST_CASE( testNestedIsSequential )
+{
+    NestedTask task( 32 );
+    tools::parallelFor( task.threads.size(), 4, task );
+
+    for ( size_t i = 0; i < task.threads.size(); i++ ) {
+        BOOST_CHECK( task.inside[i] );
+
+        for ( size_t j = 0; j < task.innerThreads[i].size(); j++ ) {
+            BOOST_CHECK( task.innerThreads[i][j] == task.threads[i] );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testFewTasksAreSequential )
+{
+    std::vector< std::thread::id > ids( tools::PARALLEL_FOR_MIN_TASKS_PER_THREAD );
+    NestedTask::Inner task = { &ids };
+    tools::parallelFor( ids.size(), 4, task );
+
+    for ( size_t i = 0; i < ids.size(); i++ ) {
+        BOOST_CHECK( ids[i] == std::this_thread::get_id() );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testException )
+{
+    ThrowingTask task ;
+    BOOST_CHECK_THROW( tools::parallelFor( 100, 4, task ), std::runtime_error );
+    BOOST_CHECK( ! tools::insideParallelFor() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,112 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/detail/StrTree.h>
+
+#include <cmath>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_StrTreeTest )
+
+namespace {
+struct CountVisitor {
+    CountVisitor( size_t stopAt_ = 0 ): count( 0 ), stopAt( stopAt_ ) {}
+
+    bool operator()( const std::pair< CGAL::Bbox_2, int >& ) {
+        ++count;
+        return count != stopAt ;
+    }
+
+    size_t count ;
+    size_t stopAt ;
+};
+
+struct BoxDistance {
+    BoxDistance( const CGAL::Bbox_2& box_ ): box( box_ ) {}
+    double operator()( const CGAL::Bbox_2& other ) const {
+        return detail::squaredDistance( box, other );
+    }
+    CGAL::Bbox_2 box ;
+};
+
+struct ItemDistance {
+    ItemDistance( const CGAL::Bbox_2& box_ ): box( box_ ) {}
+    double operator()( const std::pair< CGAL::Bbox_2, int >& item ) const {
+        return detail::squaredDistance( box, item.first );
+    }
+    CGAL::Bbox_2 box ;
+};
+
+// 100 x 100 grid of unit boxes separated by 1
+void fillGrid( detail::StrTree< CGAL::Bbox_2, int >& tree )
+{
+    for ( int i = 0; i < 100; i++ ) {
+        for ( int j = 0; j < 100; j++ ) {
+            tree.insert( CGAL::Bbox_2( 2 * i, 2 * j, 2 * i + 1, 2 * j + 1 ), i * 100 + j );
+        }
+    }
+
+    tree.build();
+}
+}
+
+BOOST_AUTO_TEST_CASE( testEmpty )
+{
+    detail::StrTree< CGAL::Bbox_2, int > tree ;
+    tree.build();
+    CountVisitor visitor ;
+    BOOST_CHECK( tree.query( CGAL::Bbox_2( 0, 0, 1, 1 ), visitor ) );
+    BOOST_CHECK_EQUAL( visitor.count, 0U );
+    BOOST_CHECK( std::isinf( tree.minimum( BoxDistance( CGAL::Bbox_2( 0, 0, 1, 1 ) ), ItemDistance( CGAL::Bbox_2( 0, 0, 1, 1 ) ) ) ) );
+}
+
+BOOST_AUTO_TEST_CASE( testQuery )
+{
+    detail::StrTree< CGAL::Bbox_2, int > tree ;
+    fillGrid( tree );
+    BOOST_CHECK_EQUAL( tree.size(), 10000U );
+    BOOST_CHECK_EQUAL( tree.bbox().xmax(), 199.0 );
+
+    CountVisitor visitor ;
+    BOOST_CHECK( tree.query( CGAL::Bbox_2( 0.5, 0.5, 4.5, 2.5 ), visitor ) );
+    BOOST_CHECK_EQUAL( visitor.count, 6U );
+
+    // early exit
+    CountVisitor stopping( 2 );
+    BOOST_CHECK( ! tree.query( CGAL::Bbox_2( 0.5, 0.5, 4.5, 2.5 ), stopping ) );
+    BOOST_CHECK_EQUAL( stopping.count, 2U );
+}
+
+BOOST_AUTO_TEST_CASE( testMinimum )
+{
+    detail::StrTree< CGAL::Bbox_2, int > tree ;
+    fillGrid( tree );
+
+    const CGAL::Bbox_2 query( 250.0, 3.5, 250.0, 3.5 );
+    BOOST_CHECK_EQUAL( tree.minimum( BoxDistance( query ), ItemDistance( query ) ), 51.0 * 51.0 );
+
+    // upper bound smaller than the minimum
+    BOOST_CHECK_EQUAL( tree.minimum( BoxDistance( query ), ItemDistance( query ), 1.0 ), 1.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,136 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/index/SpatialIndex.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/io/wkt.h>
+
+#include <algorithm>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_index_SpatialIndexTest )
+
+namespace {
+// 10 x 10 grid of unit squares separated by 1, identified by i * 10 + j
+void fillGrid( index::SpatialIndex2D& idx )
+{
+    for ( int i = 0; i < 10; i++ ) {
+        for ( int j = 0; j < 10; j++ ) {
+            idx.insert( Envelope( 2 * i, 2 * i + 1, 2 * j, 2 * j + 1 ), i * 10 + j );
+        }
+    }
+
+    idx.build();
+}
+}
+
+BOOST_AUTO_TEST_CASE( testEmpty )
+{
+    index::SpatialIndex2D idx ;
+    idx.insert( Envelope(), 0 );
+    idx.build();
+    BOOST_CHECK( idx.isEmpty() );
+    BOOST_CHECK( idx.query( Envelope( 0, 1, 0, 1 ) ).empty() );
+    BOOST_CHECK( idx.nearest( Envelope( 0, 1, 0, 1 ), 3 ).empty() );
+}
+
+BOOST_AUTO_TEST_CASE( testNotBuilt )
+{
+    index::SpatialIndex2D idx ;
+    idx.insert( Envelope( 0, 1, 0, 1 ), 0 );
+    BOOST_CHECK_THROW( idx.query( Envelope( 0, 1, 0, 1 ) ), Exception );
+    idx.build();
+    BOOST_CHECK_THROW( idx.insert( Envelope( 0, 1, 0, 1 ), 1 ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE( testWindowQuery )
+{
+    index::SpatialIndex2D idx( 4 );
+    fillGrid( idx );
+    BOOST_CHECK_EQUAL( idx.size(), 100U );
+
+    // covers the squares (1,1), (1,2), (2,1) and (2,2)
+    std::vector< size_t > ids = idx.query( Envelope( 2.5, 4.5, 2.5, 4.5 ) );
+    std::sort( ids.begin(), ids.end() );
+    BOOST_REQUIRE_EQUAL( ids.size(), 4U );
+    BOOST_CHECK_EQUAL( ids[0], 11U );
+    BOOST_CHECK_EQUAL( ids[1], 12U );
+    BOOST_CHECK_EQUAL( ids[2], 21U );
+    BOOST_CHECK_EQUAL( ids[3], 22U );
+
+    // in the gaps
+    BOOST_CHECK( idx.query( Envelope( 1.2, 1.8, 1.2, 1.8 ) ).empty() );
+}
+
+BOOST_AUTO_TEST_CASE( testNearest )
+{
+    index::SpatialIndex2D idx( 4 );
+    fillGrid( idx );
+
+    std::vector< size_t > ids = idx.nearest( Envelope( 4.5, 4.5, 6.2, 6.2 ), 1 );
+    BOOST_REQUIRE_EQUAL( ids.size(), 1U );
+    BOOST_CHECK_EQUAL( ids[0], 23U );
+
+    // far away on the diagonal, the corner square comes first
+    ids = idx.nearest( Envelope( 100, 100, 100, 100 ), 3 );
+    BOOST_REQUIRE_EQUAL( ids.size(), 3U );
+    BOOST_CHECK_EQUAL( ids[0], 99U );
+
+    BOOST_CHECK_EQUAL( idx.nearest( Envelope( 0, 0, 0, 0 ), 1000 ).size(), 100U );
+}
+
+BOOST_AUTO_TEST_CASE( testCollection )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "GEOMETRYCOLLECTION(POINT(0 0),POINT EMPTY,LINESTRING(5 5,6 6),POLYGON((10 0,11 0,11 1,10 0)))" ) );
+    index::SpatialIndex2D idx( *g );
+    BOOST_CHECK_EQUAL( idx.size(), 3U );
+
+    std::unique_ptr< Geometry > query( io::readWkt( "LINESTRING(4 6,10.5 0.5)" ) );
+    std::vector< size_t > ids = idx.candidates( *query );
+    std::sort( ids.begin(), ids.end() );
+    BOOST_REQUIRE_EQUAL( ids.size(), 2U );
+    BOOST_CHECK_EQUAL( ids[0], 2U );
+    BOOST_CHECK_EQUAL( ids[1], 3U );
+}
+
+BOOST_AUTO_TEST_CASE( test3D )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "MULTIPOINT(0 0 0,0 0 10,0 0 20)" ) );
+    index::SpatialIndex3D idx( *g );
+
+    std::vector< size_t > ids = idx.query( Envelope( -1, 1, -1, 1, 5, 15 ) );
+    BOOST_REQUIRE_EQUAL( ids.size(), 1U );
+    BOOST_CHECK_EQUAL( ids[0], 1U );
+
+    ids = idx.nearest( Envelope( 0, 0, 0, 0, 19, 19 ), 2 );
+    BOOST_REQUIRE_EQUAL( ids.size(), 2U );
+    BOOST_CHECK_EQUAL( ids[0], 2U );
+    BOOST_CHECK_EQUAL( ids[1], 1U );
+
+    // 2D query envelopes lie in the z = 0 plane
+    ids = idx.query( Envelope( -1, 1, -1, 1 ) );
+    BOOST_REQUIRE_EQUAL( ids.size(), 1U );
+    BOOST_CHECK_EQUAL( ids[0], 0U );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
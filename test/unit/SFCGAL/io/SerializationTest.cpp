@@ -151,6 +151,23 @@ BOOST_AUTO_TEST_CASE( preparedGeometryTest )
     BOOST_CHECK( io::readBinaryPrepared( io::writeBinaryPrepared( *g3 ) )->asEWKT() == g3->asEWKT() );
 }
 
+BOOST_AUTO_TEST_CASE( spatialIndexTest )
+{
+    std::unique_ptr<Geometry> g( io::readWkt( "GEOMETRYCOLLECTION(POINT(0 0),LINESTRING(5 5,6 6),POLYGON((10 0,11 0,11 1,10 0)))" ) );
+    index::SpatialIndex2D idx( *g );
+
+    std::string str = io::writeBinaryIndex( idx );
+    BOOST_CHECK_EQUAL( io::readBinaryIndexDimension( str ), 2 );
+    BOOST_CHECK_THROW( io::readBinaryIndex<3>( str ), Exception );
+
+    std::unique_ptr<index::SpatialIndex2D> ridx = io::readBinaryIndex<2>( str );
+    BOOST_CHECK( ridx->isBuilt() );
+    BOOST_CHECK_EQUAL( ridx->size(), 3U );
+    std::vector<size_t> ids = ridx->query( Envelope( 4, 7, 4, 7 ) );
+    BOOST_REQUIRE_EQUAL( ids.size(), 1U );
+    BOOST_CHECK_EQUAL( ids[0], 1U );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 